@@ -27,6 +27,8 @@ static void utc_net_nfc_close_internal_secure_element_p(void);
 static void utc_net_nfc_close_internal_secure_element_n(void);
 static void utc_net_nfc_send_apdu_p(void);
 static void utc_net_nfc_send_apdu_n(void);
+static void utc_net_nfc_send_apdu_script_p(void);
+static void utc_net_nfc_send_apdu_script_n(void);
 
 
 
@@ -41,6 +43,8 @@ struct tet_testlist tet_testlist[] = {
 	{ utc_net_nfc_close_internal_secure_element_n, 2},
 	{ utc_net_nfc_send_apdu_p, 1},
 	{ utc_net_nfc_send_apdu_n, 2},
+	{ utc_net_nfc_send_apdu_script_p, 1},
+	{ utc_net_nfc_send_apdu_script_n, 2},
 	{ NULL, 0 },
 };
 
@@ -150,3 +154,32 @@ static void utc_net_nfc_send_apdu_n(void)
 
 	dts_pass(__func__, "PASS");
 }
+
+static void utc_net_nfc_send_apdu_script_p(void)
+{
+	int ret ;
+	net_nfc_target_handle_h data = NULL;
+	data_h apdus[2] = { NULL, NULL };
+	uint16_t expected_sw[2] = { 0x9000, 0x9000 };
+	uint16_t sw_mask[2] = { 0xFFFF, 0x0000 };
+	uint8_t select_cmd[4] = {0x00, 0xA4, 0x00, 0x0C} ;
+	uint8_t get_data_cmd[5] = {0x80, 0xCA, 0x9F, 0x7F, 0x00} ;
+
+	net_nfc_create_data(&apdus[0], select_cmd, 4);
+	net_nfc_create_data(&apdus[1], get_data_cmd, 5);
+	ret = net_nfc_send_apdu_script((net_nfc_target_handle_h)(data), apdus, expected_sw, sw_mask, 2, data);
+
+	net_nfc_free_data(apdus[0]);
+	net_nfc_free_data(apdus[1]);
+
+	dts_pass(__func__, "PASS");
+}
+
+static void utc_net_nfc_send_apdu_script_n(void)
+{
+	int ret ;
+
+	ret = net_nfc_send_apdu_script(NULL, NULL, NULL, NULL, 0, NULL);
+
+	dts_check_eq(__func__, ret, NET_NFC_NULL_PARAMETER, "net_nfc_send_apdu_script not allow null");
+}
@@ -24,6 +24,8 @@ static void utc_net_nfc_get_tag_filter_p(void);
 static void utc_net_nfc_get_tag_filter_n(void);
 static void utc_net_nfc_transceive_p(void);
 static void utc_net_nfc_transceive_n(void);
+static void utc_net_nfc_transceive_sequence_p(void);
+static void utc_net_nfc_transceive_sequence_n(void);
 static void utc_net_nfc_read_ndef_p(void);
 static void utc_net_nfc_read_ndef_n(void);
 static void utc_net_nfc_write_ndef_p(void);
@@ -41,6 +43,8 @@ struct tet_testlist tet_testlist[] = {
 	{ utc_net_nfc_get_tag_filter_n, 2 },
 	{ utc_net_nfc_transceive_p, 1},
 	{ utc_net_nfc_transceive_n, 2},
+	{ utc_net_nfc_transceive_sequence_p, 1},
+	{ utc_net_nfc_transceive_sequence_n, 2},
 	{ utc_net_nfc_read_ndef_p, 1},
 	{ utc_net_nfc_read_ndef_n, 2},
 	{ utc_net_nfc_write_ndef_p, 1},
@@ -170,6 +174,45 @@ static void utc_net_nfc_transceive_n(void)
 	dts_pass(__func__, "PASS");
 }
 
+static void utc_net_nfc_transceive_sequence_p(void)
+{
+	int ret ;
+	unsigned char read_buffer[2] = {0x30, 0x04};
+	unsigned char ack_buffer[1] = {0x00};
+	data_s command;
+	data_s prefix;
+	data_h commands[2];
+	data_h prefixes[2];
+
+	command.buffer = read_buffer;
+	command.length = 2;
+
+	prefix.buffer = ack_buffer;
+	prefix.length = 1;
+
+	commands[0] = (data_h)&command;
+	commands[1] = (data_h)&command;
+	prefixes[0] = NULL;
+	prefixes[1] = (data_h)&prefix;
+
+	net_nfc_initialize();
+
+	ret = net_nfc_transceive_sequence((net_nfc_target_handle_h) 0x302023, commands, prefixes, 2, true, NULL);
+
+	net_nfc_deinitialize();
+
+	dts_pass(__func__, "PASS");
+}
+
+static void utc_net_nfc_transceive_sequence_n(void)
+{
+	int ret ;
+
+	ret = net_nfc_transceive_sequence(NULL, NULL, NULL, 0, true, NULL);
+
+	dts_check_eq(__func__, ret, NET_NFC_NULL_PARAMETER, "net_nfc_transceive_sequence not allow null parameter");
+}
+
 static void utc_net_nfc_read_ndef_p(void)
 {
 	int ret ;
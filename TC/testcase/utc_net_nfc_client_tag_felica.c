@@ -26,6 +26,8 @@ static void utc_net_nfc_felica_request_response_p(void);
 static void utc_net_nfc_felica_request_response_n(void);
 static void utc_net_nfc_felica_read_without_encryption_p(void);
 static void utc_net_nfc_felica_read_without_encryption_n(void);
+static void utc_net_nfc_felica_read_blocks_p(void);
+static void utc_net_nfc_felica_read_blocks_n(void);
 static void utc_net_nfc_felica_write_without_encryption_p(void);
 static void utc_net_nfc_felica_write_without_encryption_n(void);
 static void utc_net_nfc_felica_request_system_code_p(void);
@@ -41,6 +43,8 @@ struct tet_testlist tet_testlist[] = {
 	{ utc_net_nfc_felica_request_response_n, 2 },
 	{ utc_net_nfc_felica_read_without_encryption_p, 1},
 	{ utc_net_nfc_felica_read_without_encryption_n, 2},
+	{ utc_net_nfc_felica_read_blocks_p, 1},
+	{ utc_net_nfc_felica_read_blocks_n, 2},
 	{ utc_net_nfc_felica_write_without_encryption_p, 1},
 	{ utc_net_nfc_felica_write_without_encryption_n, 2},
 	{ utc_net_nfc_felica_request_system_code_p, 1},
@@ -157,6 +161,34 @@ static void utc_net_nfc_felica_read_without_encryption_n(void)
 	dts_pass(__func__, "PASS");
 }
 
+static void utc_net_nfc_felica_read_blocks_p(void)
+{
+	int ret=0;
+	unsigned short service_code = 0x090f;
+	unsigned short blocks[20];
+	int i;
+
+	for (i = 0; i < 20; i++)
+		blocks[i] = i;
+
+	net_nfc_initialize();
+
+	ret = net_nfc_felica_read_blocks((net_nfc_target_handle_h) 0x302023, 1, &service_code, 20, NULL, blocks, 0, NULL);
+
+	net_nfc_deinitialize();
+
+	dts_pass(__func__, "PASS");
+}
+
+static void utc_net_nfc_felica_read_blocks_n(void)
+{
+	int ret=0;
+
+	ret = net_nfc_felica_read_blocks(NULL, 1, NULL, 1, NULL, NULL, 0, NULL);
+
+	dts_check_eq(__func__, ret, NET_NFC_NULL_PARAMETER, "net_nfc_felica_read_blocks not allow null parameter");
+}
+
 static void utc_net_nfc_felica_write_without_encryption_p(void)
 {
 	int ret=0;
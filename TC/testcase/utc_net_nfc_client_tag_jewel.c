@@ -26,6 +26,8 @@ static void utc_net_nfc_jewel_read_byte_p(void);
 static void utc_net_nfc_jewel_read_byte_n(void);
 static void utc_net_nfc_jewel_read_all_p(void);
 static void utc_net_nfc_jewel_read_all_n(void);
+static void utc_net_nfc_jewel_read_memory_p(void);
+static void utc_net_nfc_jewel_read_memory_n(void);
 static void utc_net_nfc_jewel_write_with_erase_p(void);
 static void utc_net_nfc_jewel_write_with_erase_n(void);
 static void utc_net_nfc_jewel_write_with_no_erase_p(void);
@@ -39,6 +41,8 @@ struct tet_testlist tet_testlist[] = {
 	{ utc_net_nfc_jewel_read_byte_n , NEGATIVE_TC_IDX},
 	{ utc_net_nfc_jewel_read_all_p, 1},
 	{ utc_net_nfc_jewel_read_all_n, 2 },
+	{ utc_net_nfc_jewel_read_memory_p, 1},
+	{ utc_net_nfc_jewel_read_memory_n, 2},
 	{ utc_net_nfc_jewel_write_with_erase_p, 1},
 	{ utc_net_nfc_jewel_write_with_erase_n, 2},
 	{ utc_net_nfc_jewel_write_with_no_erase_p, 1},
@@ -123,6 +127,28 @@ static void utc_net_nfc_jewel_read_all_n(void)
 	dts_pass(__func__, "PASS");
 }
 
+static void utc_net_nfc_jewel_read_memory_p(void)
+{
+	int ret=0;
+
+	net_nfc_initialize();
+
+	ret = net_nfc_jewel_read_memory((net_nfc_target_handle_h) 0x302023, 0x08, 8, NULL);
+
+	net_nfc_deinitialize();
+
+	dts_pass(__func__, "PASS");
+}
+
+static void utc_net_nfc_jewel_read_memory_n(void)
+{
+	int ret=0;
+
+	ret = net_nfc_jewel_read_memory(NULL, 0, 0, NULL);
+
+	dts_check_eq(__func__, ret, NET_NFC_NULL_PARAMETER, "net_nfc_jewel_read_memory not allow null parameter");
+}
+
 static void utc_net_nfc_jewel_write_with_erase_p(void)
 {
 	int ret=0;
@@ -44,6 +44,10 @@ static void utc_net_nfc_mifare_transfer_p(void);
 static void utc_net_nfc_mifare_transfer_n(void);
 static void utc_net_nfc_mifare_restore_p(void);
 static void utc_net_nfc_mifare_restore_n(void);
+static void utc_net_nfc_mifare_read_blocks_p(void);
+static void utc_net_nfc_mifare_read_blocks_n(void);
+static void utc_net_nfc_mifare_write_blocks_p(void);
+static void utc_net_nfc_mifare_write_blocks_n(void);
 
 
 
@@ -72,6 +76,10 @@ struct tet_testlist tet_testlist[] = {
 	{ utc_net_nfc_mifare_transfer_n, 2},
 	{ utc_net_nfc_mifare_restore_p, 1},
 	{ utc_net_nfc_mifare_restore_n, 2},
+	{ utc_net_nfc_mifare_read_blocks_p, 1},
+	{ utc_net_nfc_mifare_read_blocks_n, 2},
+	{ utc_net_nfc_mifare_write_blocks_p, 1},
+	{ utc_net_nfc_mifare_write_blocks_n, 2},
 	{ NULL, 0 },
 };
 
@@ -350,3 +358,55 @@ static void utc_net_nfc_mifare_restore_n(void)
 
 	dts_pass(__func__, "PASS");
 }
+
+static void utc_net_nfc_mifare_read_blocks_p(void)
+{
+	data_h key = NULL;
+
+	net_nfc_initialize();
+
+	net_nfc_mifare_create_default_key(&key);
+	net_nfc_mifare_read_blocks((net_nfc_target_handle_h) 0x302023 , 0, 64, NET_NFC_MIFARE_KEY_A, key, NULL);
+	net_nfc_free_data(key);
+
+	net_nfc_deinitialize();
+
+	dts_pass(__func__, "PASS");
+}
+
+static void utc_net_nfc_mifare_read_blocks_n(void)
+{
+	int ret=0;
+
+	ret = net_nfc_mifare_read_blocks(NULL , 0 , 64 , NET_NFC_MIFARE_KEY_A , NULL , NULL);
+
+	dts_check_eq(__func__, ret, NET_NFC_NULL_PARAMETER, "net_nfc_mifare_read_blocks not allow null");
+}
+
+static void utc_net_nfc_mifare_write_blocks_p(void)
+{
+	data_h key = NULL;
+	data_h blocks = NULL;
+	uint8_t buffer[32] = { 0, };
+
+	net_nfc_initialize();
+
+	net_nfc_mifare_create_default_key(&key);
+	net_nfc_create_data(&blocks, buffer, sizeof(buffer));
+	net_nfc_mifare_write_blocks((net_nfc_target_handle_h) 0x302023 , 4, blocks, NET_NFC_MIFARE_KEY_A, key, NULL);
+	net_nfc_free_data(blocks);
+	net_nfc_free_data(key);
+
+	net_nfc_deinitialize();
+
+	dts_pass(__func__, "PASS");
+}
+
+static void utc_net_nfc_mifare_write_blocks_n(void)
+{
+	int ret=0;
+
+	ret = net_nfc_mifare_write_blocks(NULL , 4 , NULL , NET_NFC_MIFARE_KEY_A , NULL , NULL);
+
+	dts_check_eq(__func__, ret, NET_NFC_NULL_PARAMETER, "net_nfc_mifare_write_blocks not allow null");
+}
@@ -39,6 +39,8 @@
         @li @c #net_nfc_open_internal_secure_element	open selected secure element
         @li @c #net_nfc_close_internal_secure_element	close selected secure element
         @li @c #net_nfc_send_apdu						send apdu
+        @li @c #net_nfc_send_apdu_script				send several apdus in one request
+        @li @c #net_nfc_get_atr						get answer to reset of secure element
 
 
 
@@ -81,6 +83,8 @@ net_nfc_error_e net_nfc_get_secure_element_type(void* trans_param);
 
 /**
 	open and intialize the type of secure element. if the type of secure element is selected, then change mode as MODE OFF to prevent to be detected by external reader
+	if eSE is already opened by other application, new logical channel is assigned to this handle. class byte of apdu sent with this handle is changed to address its channel.
+	UICC can not be opened while eSE is opened, NET_NFC_BUSY is delivered to callback
 
 	\par Sync (or) Async: Sync
 	This is a Asynchronous API
@@ -98,6 +102,7 @@ net_nfc_error_e net_nfc_open_internal_secure_element(net_nfc_se_type_e se_type,
 
 /**
 	close opend secure element and change back to previous setting
+	previous setting is restored when all logical channels of eSE are closed
 
 	\par Sync (or) Async: Sync
 	This is a Asynchronous API
@@ -131,6 +136,64 @@ net_nfc_error_e net_nfc_close_internal_secure_element(net_nfc_target_handle_h ha
 
 net_nfc_error_e net_nfc_send_apdu(net_nfc_target_handle_h handle, data_h apdu, void* trans_param);
 
+/**
+	send several apdus to opend secure element in one request.
+	commands are executed in order by nfc-manager. a command is passed if (SW1SW2 & sw_mask[i]) == (expected_sw[i] & sw_mask[i]),
+	otherwise the script is aborted and rest of commands are not sent.
+
+	each response apdu is delivered with NET_NFC_MESSAGE_SEND_APDU_SE event,
+	and then NET_NFC_MESSAGE_SEND_APDU_SCRIPT_SE event is delivered with the number of executed commands.
+	the result of last event is NET_NFC_OPERATION_FAIL when the script is aborted by status word.
+
+	\par Sync (or) Async: Sync
+	This is a Asynchronous API
+
+	@param[in] 	handle			the handle of opend secure element
+	@param[in] 	apdus			apdu commands to send
+	@param[in] 	expected_sw		expected status word of each command, it can be NULL
+	@param[in] 	sw_mask			mask of status word to compare, 0 or NULL means that status word is not checked
+	@param[in] 	count			number of commands, up to NET_NFC_APDU_SCRIPT_MAX_COUNT (512)
+	@param[in]	trans_param		user data that will be delivered to callback
+
+	@return		return the result of the calling the function
+
+	@exception NET_NFC_NULL_PARAMETER 	parameter(s) has(have) illegal NULL pointer(s)
+	@exception NET_NFC_OUT_OF_BOUND 	too many commands
+
+	@code
+		uint8_t select[] = { 0x00, 0xA4, 0x04, 0x00, 0x07, 0xA0, 0x00, 0x00, 0x00, 0x03, 0x10, 0x10 };
+		uint8_t get_data[] = { 0x80, 0xCA, 0x9F, 0x7F, 0x00 };
+		data_h apdus[2] = { NULL, };
+		uint16_t expected_sw[2] = { 0x9000, 0x9000 };
+		uint16_t sw_mask[2] = { 0xFFFF, 0xFFFF };
+
+		net_nfc_create_data(&apdus[0], select, sizeof(select));
+		net_nfc_create_data(&apdus[1], get_data, sizeof(get_data));
+
+		net_nfc_send_apdu_script(handle, apdus, expected_sw, sw_mask, 2, NULL);
+	@endcode
+*/
+
+net_nfc_error_e net_nfc_send_apdu_script(net_nfc_target_handle_h handle, data_h *apdus, uint16_t *expected_sw, uint16_t *sw_mask, uint32_t count, void* trans_param);
+
+/**
+	get answer to reset of opend secure element. ATR is delivered with NET_NFC_MESSAGE_GET_ATR_SE event
+	ATR of UICC is kept by nfc manager until the state of sim card is changed, only UICC is supported now
+
+	\par Sync (or) Async: Sync
+	This is a Asynchronous API
+
+	@param[in] 	handle			the handle of opend secure element
+	@param[in]	trans_param		user data that will be delivered to callback
+
+	@return		return the result of the calling the function
+
+	@exception NET_NFC_NULL_PARAMETER 	parameter(s) has(have) illegal NULL pointer(s)
+
+*/
+
+net_nfc_error_e net_nfc_get_atr(net_nfc_target_handle_h handle, void *trans_param);
+
 
 #ifdef __cplusplus
 }
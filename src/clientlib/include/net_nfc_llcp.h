@@ -194,6 +194,73 @@ net_nfc_error_e net_nfc_send_llcp (net_nfc_llcp_socket_t socket, data_h  data ,
 
 net_nfc_error_e net_nfc_receive_llcp (net_nfc_llcp_socket_t socket, size_t req_length, void * trans_param);
 
+/**
+	switch connected socket to stream mode. In stream mode, "net_nfc_write_llcp_stream" and "net_nfc_read_llcp_stream" are used
+	instead of "net_nfc_send_llcp" and "net_nfc_receive_llcp". Received data is read ahead until "read_watermark" bytes are buffered.
+	calling this function again on the stream socket updates the watermark. This api is for connection oriented socket
+
+	@param[in]		socket			socket handler
+	@param[in]		read_watermark	number of bytes to read ahead, 0 means data is received only when it is requested
+
+	@return 	return the result of the calling the function
+
+	@exception NET_NFC_LLCP_INVALID_SOCKET	invalied socket handler is recieved
+	@exception NET_NFC_NOT_SUPPORTED	socket is not connection oriented socket
+	@exception NET_NFC_ALLOC_FAIL	memory allocation is failed
+*/
+
+net_nfc_error_e net_nfc_enable_llcp_stream (net_nfc_llcp_socket_t socket, uint32_t read_watermark);
+
+/**
+	switch stream socket back to normal mode. buffered data which is not read or written is discarded
+
+	@param[in]		socket		socket handler
+
+	@return 	return the result of the calling the function
+
+	@exception NET_NFC_LLCP_INVALID_SOCKET	invalied socket handler is recieved
+	@exception NET_NFC_BUSY		send or receive request of stream is not completed yet
+*/
+
+net_nfc_error_e net_nfc_disable_llcp_stream (net_nfc_llcp_socket_t socket);
+
+/**
+	queue data to send to remote device. data written while previous sending is in progress is merged and sent together (up to miu of socket).
+	NET_NFC_MESSAGE_LLCP_STREAM_WRITE is delivered when all queued data is sent, the data pointer of event contains the number of sent bytes (Cast to uint32_t *).
+	if sending is failed, the remained data is discarded and the event is delivered with error.
+
+	@param[in]		socket		socket handler
+	@param[in]		data			raw data to send to remote device
+	@param[in]		trans_param	user parameter, the last one is delivered with the event
+
+	@return 	return the result of the calling the function
+
+	@exception NET_NFC_LLCP_INVALID_SOCKET	invalied socket handler is recieved
+	@exception NET_NFC_NULL_PARAMETER		parameter(s) has(have) illigal NULL pointer(s)
+	@exception NET_NFC_INVALID_STATE		socket is not in stream mode
+*/
+
+net_nfc_error_e net_nfc_write_llcp_stream (net_nfc_llcp_socket_t socket, data_h data, void * trans_param);
+
+/**
+	read exactly "length" bytes from remote device. NET_NFC_MESSAGE_LLCP_STREAM_READ is delivered when the bytes are received,
+	cast the data pointer into "data_h". if enough bytes are already buffered, the callback is called before this function returns.
+	if receiving is failed, the event is delivered with error and the bytes received so far.
+
+	@param[in]		socket		socket handler
+	@param[in]		length		length of data will be read
+	@param[in]		trans_param	user parameter
+
+	@return 	return the result of the calling the function
+
+	@exception NET_NFC_LLCP_INVALID_SOCKET	invalied socket handler is recieved
+	@exception NET_NFC_OUT_OF_BOUND		length is 0
+	@exception NET_NFC_INVALID_STATE		socket is not in stream mode
+	@exception NET_NFC_BUSY		previous read is not completed yet
+*/
+
+net_nfc_error_e net_nfc_read_llcp_stream (net_nfc_llcp_socket_t socket, uint32_t length, void * trans_param);
+
 
 
 /**
@@ -239,6 +306,48 @@ net_nfc_error_e net_nfc_send_to_llcp (net_nfc_llcp_socket_t socket,sap_t dsap, d
 
 net_nfc_error_e net_nfc_receive_from_llcp (net_nfc_llcp_socket_t socket, sap_t ssap, size_t req_length, void * trans_param);
 
+/**
+	send several datagrams to remote device with one request. NET_NFC_MESSAGE_LLCP_SEND_TO_BATCH is delivered once
+	when all datagrams are processed, the data pointer of event contains the number of sent datagrams (Cast to uint32_t *).
+	the result of event is the first error while sending datagrams.
+	this API is for connectionless socket
+
+	@param[in]		socket		socket handler
+	@param[in]		dsap			destination sap of all datagrams
+	@param[in]		datagrams	array of raw data to send to remote device
+	@param[in]		count		number of datagrams, up to NET_NFC_LLCP_BATCH_MAX_COUNT (64)
+	@param[in]		trans_param	user parameter
+
+	@return 	return the result of the calling the function
+
+	@exception NET_NFC_LLCP_INVALID_SOCKET	invalied socket handler is recieved
+	@exception NET_NFC_NULL_PARAMETER		parameter(s) has(have) illigal NULL pointer(s)
+	@exception NET_NFC_OUT_OF_BOUND		too many datagrams are requested
+	@exception NET_NFC_ALLOC_FAIL	memory allocation is failed
+*/
+
+net_nfc_error_e net_nfc_send_to_llcp_batch (net_nfc_llcp_socket_t socket, sap_t dsap, data_h * datagrams, uint32_t count, void * trans_param);
+
+/**
+	recieve several datagrams from remote device with one request. each received datagram is delivered with
+	NET_NFC_MESSAGE_LLCP_RECEIVE_FROM event (cast the data pointer into "data_h"), and then NET_NFC_MESSAGE_LLCP_RECEIVE_FROM_BATCH
+	is delivered, the data pointer of event contains the number of received datagrams (Cast to uint32_t *).
+	this API is for connectionless socket
+
+	@param[in]		socket		socket handler
+	@param[in]		ssap			source sap
+	@param[in]		req_length	max length of each datagram
+	@param[in]		count		number of datagrams, up to NET_NFC_LLCP_BATCH_MAX_COUNT (64)
+	@param[in]		trans_param	user parameter
+
+	@return 	return the result of the calling the function
+
+	@exception NET_NFC_LLCP_INVALID_SOCKET	invalied socket handler is recieved
+	@exception NET_NFC_OUT_OF_BOUND		count is 0 or too many datagrams are requested
+*/
+
+net_nfc_error_e net_nfc_receive_from_llcp_batch (net_nfc_llcp_socket_t socket, sap_t ssap, size_t req_length, uint32_t count, void * trans_param);
+
 
 /**
 	connect to the remote device with destiantion sap number you should know the sap number (0 ~ 61)
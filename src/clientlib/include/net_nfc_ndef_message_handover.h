@@ -42,6 +42,7 @@ net_nfc_error_e net_nfc_create_carrier_config (net_nfc_carrier_config_h * config
 /**
 	Add property key and value for configuration.
 	the data will be copied to config handle, you should free used data array.
+	network key and vendor extension can be added more than once, other attributes are registered only once.
 
 	@param[in] 	config 		instance handler
 	@param[in] 	attribute 				attribue key for value.
@@ -73,6 +74,7 @@ net_nfc_error_e net_nfc_add_carrier_config_property (net_nfc_carrier_config_h co
 net_nfc_error_e net_nfc_remove_carrier_config_property (net_nfc_carrier_config_h config, uint16_t attribute);
 /**
 	Get the property value by attribute.
+	the first one is returned if the attribute has been added more than once.
 
 	@param[in] 	config 		instance handler
 	@param[in] 	attribute 				attribue key for value.
@@ -168,13 +170,14 @@ net_nfc_error_e net_nfc_create_carrier_config_group (net_nfc_property_group_h *
 
 	@exception NET_NFC_NULL_PARAMETER		parameter(s) has(have) illigal NULL pointer(s)
 	@exception NET_NFC_ALLOC_FAIL			allocation is failed
-	@exception NET_NFC_ALREADY_REGISTERED	the given key is already registered
+	@exception NET_NFC_ALREADY_REGISTERED	the given key is already registered, except network key and vendor extension
 */
 
 net_nfc_error_e net_nfc_add_carrier_config_group_property (net_nfc_property_group_h group, uint16_t attribute, uint16_t size, uint8_t * data);
 
 /**
 	get property from group handle
+	the first one is returned if the attribute has been added more than once.
 
 	@param[in] 	group 		instance group handler
 	@param[in]	attribute		attribute of the property
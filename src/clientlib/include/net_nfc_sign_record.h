@@ -85,6 +85,74 @@ net_nfc_error_e net_nfc_sign_records(ndef_message_h msg, int begin_index, int en
 */
 net_nfc_error_e net_nfc_sign_ndef_message(ndef_message_h msg, char *cert_file, char *password);
 
+/**
+	this function loads the private key and certificate chain of cert_file once, so that many messages can be signed with it.
+	a key can be used by several threads, signing with one key is serialized.
+
+	@param[out]		key					key handle. it should be released by net_nfc_free_sign_key
+	@param[in]		cert_file			PKCS #12 type certificate file (.p12). And the file should be encoded in DER type. (NOT PEM type)
+	@param[in]		passowrd			the password of cert_file
+
+	@return		return the result of the calling the function
+
+	@exception NET_NFC_NULL_PARAMETER		parameter(s) has(have) illegal NULL pointer(s)
+	@exception NET_NFC_UNKNOWN_ERROR		cert_file cannot be loaded
+
+	@code
+		net_nfc_sign_key_h key = NULL;
+
+		if (net_nfc_create_sign_key(&key, "/tmp/cert.p12", "abcdef") == NET_NFC_OK)
+		{
+			// sign messages
+			net_nfc_sign_ndef_message_with_key(msg, key);
+			// ...
+
+			net_nfc_free_sign_key(key);
+		}
+	@endcode
+*/
+net_nfc_error_e net_nfc_create_sign_key(net_nfc_sign_key_h *key, char *cert_file, char *password);
+
+/**
+	this function releases the key created by net_nfc_create_sign_key
+
+	@param[in]		key					key handle
+
+	@return		return the result of the calling the function
+
+	@exception NET_NFC_NULL_PARAMETER		parameter(s) has(have) illegal NULL pointer(s)
+*/
+net_nfc_error_e net_nfc_free_sign_key(net_nfc_sign_key_h key);
+
+/**
+	this function make the signature of some continuous records with loaded key
+
+	@param[in/out]	msg					NDEF message handler. After executing this function, a signature record will be added.
+	@param[in]		begin_index			the index of beginning record that will be signed.
+	@param[in]		end_index			the last index of record that will be signed.
+	@param[in]		key					key handle created by net_nfc_create_sign_key
+
+	@return		return the result of the calling the function
+
+	@exception NET_NFC_NULL_PARAMETER		parameter(s) has(have) illegal NULL pointer(s)
+	@exception NET_NFC_INVALID_PARAM		index is out of range
+	@exception NET_NFC_ALLOC_FAIL			memory allocation is failed
+*/
+net_nfc_error_e net_nfc_sign_records_with_key(ndef_message_h msg, int begin_index, int end_index, net_nfc_sign_key_h key);
+
+/**
+	this function make the signature of whole records in NDEF message with loaded key
+
+	@param[in/out]	msg					NDEF message handler. After executing this function, a signature record will be added.
+	@param[in]		key					key handle created by net_nfc_create_sign_key
+
+	@return		return the result of the calling the function
+
+	@exception NET_NFC_NULL_PARAMETER		parameter(s) has(have) illegal NULL pointer(s)
+	@exception NET_NFC_ALLOC_FAIL			memory allocation is failed
+*/
+net_nfc_error_e net_nfc_sign_ndef_message_with_key(ndef_message_h msg, net_nfc_sign_key_h key);
+
 /**
 	This function does verify signature of records
 	record MUST be continuous.
@@ -34,6 +34,7 @@
         NFC Manager defines are defined in <net_nfc_typedef.h>
 
         @li @c #net_nfc_transceive					provide low level tag access
+        @li @c #net_nfc_transceive_sequence			send several raw commands in one request
         @li @c #net_nfc_format_ndef					format to NDEF tag type
         @li @c #net_nfc_read_tag						read ndef message
         @li @c #net_nfc_write_ndef					write ndef message
@@ -131,6 +132,37 @@
 
 net_nfc_error_e net_nfc_transceive (net_nfc_target_handle_h handle, data_h rawdata, void* trans_param);
 
+/**
+	transceive sequence sends several raw commands to the tag in one request.
+	commands are sent by the nfc daemon in order, so the client does not wait a round trip for each command.
+	each command is framed for the tag type in the same way with "net_nfc_transceive". <BR>
+	if prefix of a command is given, the response of the command should start with the prefix.
+	if not, the sequence is stopped and NET_NFC_OPERATION_FAIL is returned.
+
+	\par Sync (or) Async: Async
+	This is a Asynchronous API
+
+	@param[in] 	handle		target ID that has been delivered from callback
+	@param[in]	commands		array of raw commands
+	@param[in]	prefixes		array of expected response prefixes, it can be NULL. each item can be NULL also.
+	@param[in]	count		the number of commands
+	@param[in]	stop_on_error	if true, the sequence is stopped when a command is failed
+	@param[in]	trans_param	user data that will be delivered to callback
+
+	@return return the result of the calling this function
+
+	@exception NET_NFC_NULL_PARAMETER	parameter(s) has(have) illegal NULL pointer(s)
+	@exception NET_NFC_OUT_OF_BOUND	count is bigger than NET_NFC_TRANSCEIVE_SEQUENCE_MAX_COUNT
+	@exception NET_NFC_ALLOC_FAIL 	memory allocation is failed
+	@exception NET_NFC_NOT_INITIALIZED	Try to operate without initialization
+	@exception NET_NFC_INVALID_PARAM	command is too long for the tag type
+
+	response of each command is delivered with NET_NFC_MESSAGE_TRANSCEIVE message in order,
+	and NET_NFC_MESSAGE_TRANSCEIVE_SEQUENCE message is delivered at last with the number of responses (uint32_t *).
+*/
+
+net_nfc_error_e net_nfc_transceive_sequence (net_nfc_target_handle_h handle, data_h *commands, data_h *prefixes, uint32_t count, bool stop_on_error, void* trans_param);
+
 /**
 	This API formats the detected tag that can store NDEF message.
 	some tags are required authentication. if the detected target does need authentication, set NULL.
@@ -166,6 +166,38 @@ net_nfc_error_e net_nfc_felica_request_response (net_nfc_target_handle_h handle,
 
 net_nfc_error_e net_nfc_felica_read_without_encryption (net_nfc_target_handle_h handle, uint8_t number_of_services, uint16_t service_list[], uint8_t number_of_blocks, uint8_t block_list[], void* trans_param);
 
+/**
+	Use this command to read many blocks from Services that require no authentification.
+	blocks are packed into as few read without encryption commands as the card allows (up to 16 services and 15 blocks in a command),
+	and the commands are sent by nfc daemon at once.
+
+	\par Sync (or) Async: Sync
+	This is a Asynchronous API
+
+	@param[in] 	handle					target handle of detected tag
+	@param[in] 	number_of_services			the number of service list
+	@param[in] 	service_list				Service codes that blocks belong to
+	@param[in] 	number_of_blocks			the number of blocks to read
+	@param[in] 	service_index				index of service_list for each block, if NULL, all blocks belong to service_list[0]
+	@param[in] 	block_list					block number of each block
+	@param[in] 	max_blocks_per_command		the max number of blocks that the card accepts in a command, 0 means 15
+
+	@return		return the result of the calling the function
+
+	@exception NET_NFC_NULL_PARAMETER	parameter has illigal NULL pointer
+	@exception NET_NFC_INVALID_PARAM	service index is not in service list, or nothing to read
+	@exception NET_NFC_ALLOC_FAIL 	memory allocation is failed
+	@exception NET_NFC_NOT_INITIALIZED	Try to operate without initialization
+	@exception NET_NFC_NO_DATA_FOUND	mendantory tag info (IDm, etc) is not founded
+	@exception NET_NFC_OUT_OF_BOUND		the length of IDm is not correct, or too many commands are required
+
+	response of each command is delivered with NET_NFC_MESSAGE_TRANSCEIVE message in order of block_list,
+	and NET_NFC_MESSAGE_TRANSCEIVE_SEQUENCE message is delivered at last.
+	the sequence is stopped when a command is failed.
+*/
+
+net_nfc_error_e net_nfc_felica_read_blocks (net_nfc_target_handle_h handle, uint8_t number_of_services, uint16_t service_list[], uint16_t number_of_blocks, uint8_t service_index[], uint16_t block_list[], uint8_t max_blocks_per_command, void* trans_param);
+
 /**
 	Use this command to write block data to a Service that requires no authentification
 
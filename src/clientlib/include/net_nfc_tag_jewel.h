@@ -107,6 +107,33 @@ net_nfc_error_e net_nfc_jewel_read_byte (net_nfc_target_handle_h handle, uint8_t
 
 net_nfc_error_e net_nfc_jewel_read_all (net_nfc_target_handle_h handle, void* trans_param);
 
+/**
+	read bytes from memory image of tag.
+	nfc daemon reads the whole memory once (RALL, and RSEG or READ8 for dynamic memory) and keeps it while the tag is connected,
+	so byte or block read does not access the tag again. writes by "net_nfc_jewel_write_with_erase" and "net_nfc_jewel_write_with_no_erase" update the image also.
+	byte address is (block * 8 + byte).
+
+	\par Sync (or) Async: Sync
+	This is a Asynchronous API
+
+	@param[in] 	handle		target handle of detected tag
+	@param[in] 	offset		byte address to read
+	@param[in] 	length		the number of bytes to read, 0 means to the end of memory
+
+	@return		return the result of the calling the function
+
+	@exception NET_NFC_NULL_PARAMETER	parameter has illigal NULL pointer
+	@exception NET_NFC_ALLOC_FAIL 	memory allocation is failed
+	@exception NET_NFC_NOT_INITIALIZED	Try to operate without initialization
+	@exception NET_NFC_BUSY		Device is too busy to handle your request
+	@exception NET_NFC_OPERATION_FAIL	Operation is failed because of the internal oal error
+	@exception NET_NFC_NO_DATA_FOUND	mendantory tag info (UID, etc) is not founded
+
+	NET_NFC_MESSAGE_JEWEL_READ_MEMORY is delivered with the bytes, NET_NFC_OUT_OF_BOUND is given if the range is out of memory.
+*/
+
+net_nfc_error_e net_nfc_jewel_read_memory (net_nfc_target_handle_h handle, uint16_t offset, uint16_t length, void* trans_param);
+
 
 /**
 	operate erase and write cycle . If any of BLOCK-0 to BLOCK-D is locked then write with erase is barred form thoes blocks.
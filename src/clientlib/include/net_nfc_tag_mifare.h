@@ -290,6 +290,71 @@ net_nfc_error_e net_nfc_mifare_transfer(net_nfc_target_handle_h handle, uint8_t
 
 net_nfc_error_e net_nfc_mifare_restore(net_nfc_target_handle_h handle, uint8_t addr, void* trans_param);
 
+/**
+	read count blocks from addr in one request. The server authenticates each sector of the range once with the given key.
+	NET_NFC_MESSAGE_MIFARE_READ_BLOCKS event is delivered with the blocks read before an error (cast the data pointer into "data_h").
+	This API is only available for MIFARE classic
+
+	\par Sync (or) Async: Sync
+	This is a Asynchronous API
+
+	@param[in] 	handle		target handle of detected tag
+	@param[in] 	addr			first block
+	@param[in] 	count		number of blocks to read
+	@param[in] 	key_type		NET_NFC_MIFARE_KEY_A or NET_NFC_MIFARE_KEY_B
+	@param[in] 	auth_key		key of the sectors (6 bytes)
+
+	@return		return the result of the calling the function
+
+	@exception NET_NFC_NULL_PARAMETER	parameter has illigal NULL pointer
+	@exception NET_NFC_INVALID_PARAM	count is zero or key type is not valid
+	@exception NET_NFC_OUT_OF_BOUND	range is out of the card, or key is not 6 bytes
+	@exception NET_NFC_ALLOC_FAIL 	memory allocation is failed
+	@exception NET_NFC_NOT_INITIALIZED	Try to operate without initialization
+	@exception NET_NFC_BUSY		Device is too busy to handle your request
+	@exception NET_NFC_OPERATION_FAIL	Operation is failed because of the internal oal error
+	@exception NET_NFC_RF_TIMEOUT	Timeout is raised while communicate with tag
+	@exception NET_NFC_NOT_SUPPORTED	you may recieve this error if you request not supported command
+	@exception NET_NFC_INVALID_HANDLE	target handle is not valid
+	@exception NET_NFC_TAG_READ_FAILED	received chunked data is not valied (damaged data is recieved) or error ack is recieved
+
+*/
+
+net_nfc_error_e net_nfc_mifare_read_blocks(net_nfc_target_handle_h handle, uint8_t addr, uint32_t count, net_nfc_mifare_key_type_e key_type, data_h auth_key, void* trans_param);
+
+/**
+	write blocks (multiple of 16 bytes) from addr in one request. The server authenticates each sector of the range once with the given key.
+	Sector trailers can not be written by this API, use net_nfc_mifare_write_block for them.
+	NET_NFC_MESSAGE_MIFARE_WRITE_BLOCKS event is delivered with the number of written blocks (cast the data pointer into "uint32_t *").
+	This API is only available for MIFARE classic
+
+	\par Sync (or) Async: Sync
+	This is a Asynchronous API
+
+	@param[in] 	handle		target handle of detected tag
+	@param[in] 	addr			first block
+	@param[in] 	data			blocks to write
+	@param[in] 	key_type		NET_NFC_MIFARE_KEY_A or NET_NFC_MIFARE_KEY_B
+	@param[in] 	auth_key		key of the sectors (6 bytes)
+
+	@return		return the result of the calling the function
+
+	@exception NET_NFC_NULL_PARAMETER	parameter has illigal NULL pointer
+	@exception NET_NFC_INVALID_PARAM	length of data is not multiple of block size, or key type is not valid
+	@exception NET_NFC_OUT_OF_BOUND	range is out of the card, or key is not 6 bytes
+	@exception NET_NFC_ALLOC_FAIL 	memory allocation is failed
+	@exception NET_NFC_NOT_INITIALIZED	Try to operate without initialization
+	@exception NET_NFC_BUSY		Device is too busy to handle your request
+	@exception NET_NFC_OPERATION_FAIL	Operation is failed because of the internal oal error
+	@exception NET_NFC_RF_TIMEOUT	Timeout is raised while communicate with tag
+	@exception NET_NFC_NOT_SUPPORTED	you may recieve this error if you request not supported command
+	@exception NET_NFC_INVALID_HANDLE	target handle is not valid
+	@exception NET_NFC_TAG_WRITE_FAILED	read only tag, or error ack is received from tag
+
+*/
+
+net_nfc_error_e net_nfc_mifare_write_blocks(net_nfc_target_handle_h handle, uint8_t addr, data_h data, net_nfc_mifare_key_type_e key_type, data_h auth_key, void* trans_param);
+
 /**
 	create default factory key. The key is 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
 
@@ -39,7 +39,10 @@ net_nfc_llcp_internal_socket_s * _find_internal_socket_info (net_nfc_llcp_socket
 net_nfc_llcp_internal_socket_s * _find_internal_socket_info_by_oal_socket (net_nfc_llcp_socket_t socket);
 void _append_internal_socket (net_nfc_llcp_internal_socket_s * data);
 void _remove_internal_socket (net_nfc_llcp_internal_socket_s * data);
+void _set_internal_socket_oal_socket (net_nfc_llcp_internal_socket_s * data, net_nfc_llcp_socket_t oal_socket);
 void _net_nfc_llcp_close_all_socket ();
+bool _net_nfc_llcp_stream_on_send (net_nfc_llcp_internal_socket_s * psocket_data, net_nfc_error_e result);
+bool _net_nfc_llcp_stream_on_receive (net_nfc_llcp_internal_socket_s * psocket_data, net_nfc_error_e result, data_s * received);
 void _net_nfc_set_llcp_remote_configure (net_nfc_llcp_config_info_s * remote_data);
 
 extern unsigned int socket_handle ;
@@ -202,6 +205,87 @@ static bool net_nfc_client_dispatch_response(client_dispatcher_param_t* param)
 		}
 		break;
 
+		case NET_NFC_MESSAGE_SEND_APDU_SCRIPT_SE:
+		{
+			net_nfc_response_send_apdu_script_t* detail_msg = (net_nfc_response_send_apdu_script_t *)msg->detail_message;
+			data_s apdu = { NULL, 0 };
+			uint32_t offset = 0;
+			uint32_t count = 0;
+
+			if(client_cb == NULL)
+				break;
+
+			/* deliver each response as if it was received by net_nfc_send_apdu */
+			while(count < detail_msg->count &&
+				net_nfc_util_get_llcp_batch_datagram(detail_msg->data.buffer, detail_msg->data.length, &offset, &apdu) == true)
+			{
+				client_cb(NET_NFC_MESSAGE_SEND_APDU_SE, NET_NFC_OK, &apdu, client_context->register_user_param, detail_msg->trans_param);
+				count++;
+			}
+
+			client_cb(msg->response_type, detail_msg->result, &count, client_context->register_user_param, detail_msg->trans_param);
+		}
+		break;
+
+		case NET_NFC_MESSAGE_GET_ATR_SE:
+		{
+			net_nfc_response_get_atr_t* detail_msg = (net_nfc_response_get_atr_t *)msg->detail_message;
+
+			if(client_cb != NULL)
+				client_cb(msg->response_type, detail_msg->result, (detail_msg->data.length > 0) ? &detail_msg->data : NULL, client_context->register_user_param, detail_msg->trans_param);
+		}
+		break;
+
+		case NET_NFC_MESSAGE_TRANSCEIVE_SEQUENCE:
+		{
+			net_nfc_response_transceive_sequence_t* detail_msg = (net_nfc_response_transceive_sequence_t *)msg->detail_message;
+			net_nfc_error_e result = NET_NFC_OK;
+			data_s response = { NULL, 0 };
+			uint32_t offset = 0;
+			uint32_t count = 0;
+
+			if(client_cb == NULL)
+				break;
+
+			/* deliver each response as if it was received by net_nfc_transceive */
+			while(count < detail_msg->count &&
+				net_nfc_util_get_transceive_sequence_response(detail_msg->data.buffer, detail_msg->data.length, &offset, &result, &response) == true)
+			{
+				client_cb(NET_NFC_MESSAGE_TRANSCEIVE, result, (response.length > 0) ? &response : NULL, client_context->register_user_param, detail_msg->trans_param);
+				count++;
+			}
+
+			client_cb(msg->response_type, detail_msg->result, &count, client_context->register_user_param, detail_msg->trans_param);
+		}
+		break;
+
+		case NET_NFC_MESSAGE_MIFARE_READ_BLOCKS:
+		{
+			net_nfc_response_mifare_blocks_t* detail_msg = (net_nfc_response_mifare_blocks_t *)msg->detail_message;
+
+			if(client_cb != NULL)
+				client_cb(msg->response_type, detail_msg->result, (detail_msg->data.length > 0) ? &detail_msg->data : NULL, client_context->register_user_param, detail_msg->trans_param);
+		}
+		break;
+
+		case NET_NFC_MESSAGE_MIFARE_WRITE_BLOCKS:
+		{
+			net_nfc_response_mifare_blocks_t* detail_msg = (net_nfc_response_mifare_blocks_t *)msg->detail_message;
+
+			if(client_cb != NULL)
+				client_cb(msg->response_type, detail_msg->result, &(detail_msg->count), client_context->register_user_param, detail_msg->trans_param);
+		}
+		break;
+
+		case NET_NFC_MESSAGE_JEWEL_READ_MEMORY:
+		{
+			net_nfc_response_jewel_read_memory_t* detail_msg = (net_nfc_response_jewel_read_memory_t *)msg->detail_message;
+
+			if(client_cb != NULL)
+				client_cb(msg->response_type, detail_msg->result, (detail_msg->data.length > 0) ? &detail_msg->data : NULL, client_context->register_user_param, detail_msg->trans_param);
+		}
+		break;
+
 		case NET_NFC_MESSAGE_SEND_APDU_SE:
 		{
 			data_s* apdu = &(((net_nfc_response_send_apdu_t *)msg->detail_message)->data);
@@ -635,6 +719,30 @@ static bool net_nfc_client_dispatch_response(client_dispatcher_param_t* param)
 		}
 		break;
 
+		case NET_NFC_MESSAGE_SERVICE_SE_EVENT_BATCH :
+		{
+			net_nfc_response_se_event_batch_t* batch = (net_nfc_response_se_event_batch_t *)msg->detail_message;
+			net_nfc_se_event_info_s info;
+			uint32_t offset = 0;
+			uint32_t count = 0;
+			uint32_t type = 0;
+
+			if (batch->dropped > 0)
+			{
+				DEBUG_CLIENT_MSG("[%d] se events are dropped by server", batch->dropped);
+			}
+
+			/* deliver each event as if it was sent alone */
+			while (count < batch->count &&
+				net_nfc_util_get_se_batch_event(batch->data.buffer, batch->data.length, &offset, &type, &info.aid, &info.param) == true)
+			{
+				if(client_cb != NULL)
+					client_cb(type, NET_NFC_OK, (void*)&info, client_context->register_user_param, NULL);
+				count++;
+			}
+		}
+		break;
+
 		case NET_NFC_MESSAGE_LLCP_LISTEN:
 		{
 			net_nfc_response_listen_socket_t* detail_msg = (net_nfc_response_listen_socket_t *)msg->detail_message;
@@ -644,7 +752,7 @@ static bool net_nfc_client_dispatch_response(client_dispatcher_param_t* param)
 				DEBUG_ERR_MSG ("Wrong client socket is returned from server..");
 				break;
 			}
-			psocket_info->oal_socket = detail_msg->oal_socket;
+			_set_internal_socket_oal_socket (psocket_info, detail_msg->oal_socket);
 			DEBUG_CLIENT_MSG ("BJDEBUG: oal socket %d", detail_msg->oal_socket)
 			if (psocket_info->cb != NULL){
 				psocket_info->cb(msg->response_type, detail_msg->result, NULL, psocket_info->register_param, detail_msg->trans_param);
@@ -660,7 +768,7 @@ static bool net_nfc_client_dispatch_response(client_dispatcher_param_t* param)
 				DEBUG_ERR_MSG ("Wrong client socket is returned from server..");
 				break;
 			}
-			psocket_info->oal_socket = detail_msg->oal_socket;
+			_set_internal_socket_oal_socket (psocket_info, detail_msg->oal_socket);
 			if (psocket_info->cb != NULL){
 				psocket_info->cb(msg->response_type, detail_msg->result, NULL,psocket_info->register_param,  detail_msg->trans_param);
 			}
@@ -676,7 +784,7 @@ static bool net_nfc_client_dispatch_response(client_dispatcher_param_t* param)
 				DEBUG_ERR_MSG ("Wrong client socket is returned from server..");
 				break;
 			}
-			psocket_info->oal_socket = detail_msg->oal_socket;
+			_set_internal_socket_oal_socket (psocket_info, detail_msg->oal_socket);
 			if (psocket_info->cb != NULL){
 				psocket_info->cb(msg->response_type, detail_msg->result, NULL,psocket_info->register_param,  detail_msg->trans_param);
 			}
@@ -692,6 +800,9 @@ static bool net_nfc_client_dispatch_response(client_dispatcher_param_t* param)
 				DEBUG_ERR_MSG ("Wrong client socket is returned from server..");
 				break;
 			}
+			if (_net_nfc_llcp_stream_on_send (psocket_info, detail_msg->result) == true){
+				break;
+			}
 			if (psocket_info->cb != NULL){
 				psocket_info->cb(msg->response_type, detail_msg->result, NULL,psocket_info->register_param,  detail_msg->trans_param);
 			}
@@ -701,11 +812,58 @@ static bool net_nfc_client_dispatch_response(client_dispatcher_param_t* param)
 		case NET_NFC_MESSAGE_LLCP_RECEIVE:
 		{
 			net_nfc_response_receive_socket_t* detail_msg = (net_nfc_response_receive_socket_t *)msg->detail_message;
+			net_nfc_llcp_internal_socket_s * psocket_info = NULL;
+
+			psocket_info = _find_internal_socket_info (detail_msg->client_socket);
+			if (psocket_info != NULL && _net_nfc_llcp_stream_on_receive (psocket_info, detail_msg->result, &(detail_msg->data)) == true){
+				break;
+			}
 
 			if(client_cb != NULL)
 				client_cb(msg->response_type, detail_msg->result, &(detail_msg->data), client_context->register_user_param, NULL);
 		}
 		break;
+		case NET_NFC_MESSAGE_LLCP_SEND_TO_BATCH:
+		{
+			net_nfc_response_send_to_batch_socket_t* detail_msg = (net_nfc_response_send_to_batch_socket_t *)msg->detail_message;
+			net_nfc_llcp_internal_socket_s * psocket_info = NULL;
+			psocket_info = _find_internal_socket_info (detail_msg->client_socket);
+			if (psocket_info == NULL){
+				DEBUG_ERR_MSG ("Wrong client socket is returned from server..");
+				break;
+			}
+			if (psocket_info->cb != NULL){
+				psocket_info->cb(msg->response_type, detail_msg->result, &(detail_msg->count), psocket_info->register_param, detail_msg->trans_param);
+			}
+		}
+		break;
+		case NET_NFC_MESSAGE_LLCP_RECEIVE_FROM_BATCH:
+		{
+			net_nfc_response_receive_from_batch_socket_t* detail_msg = (net_nfc_response_receive_from_batch_socket_t *)msg->detail_message;
+			net_nfc_llcp_internal_socket_s * psocket_info = NULL;
+			data_s datagram = { NULL, 0 };
+			uint32_t offset = 0;
+			uint32_t count = 0;
+
+			psocket_info = _find_internal_socket_info (detail_msg->client_socket);
+			if (psocket_info == NULL){
+				DEBUG_ERR_MSG ("Wrong client socket is returned from server..");
+				break;
+			}
+			if (psocket_info->cb == NULL){
+				break;
+			}
+
+			/* deliver each datagram as if it was received by net_nfc_receive_from_llcp */
+			while (count < detail_msg->count &&
+				net_nfc_util_get_llcp_batch_datagram (detail_msg->data.buffer, detail_msg->data.length, &offset, &datagram) == true){
+				psocket_info->cb(NET_NFC_MESSAGE_LLCP_RECEIVE_FROM, NET_NFC_OK, &datagram, psocket_info->register_param, detail_msg->trans_param);
+				count++;
+			}
+
+			psocket_info->cb(msg->response_type, detail_msg->result, &count, psocket_info->register_param, detail_msg->trans_param);
+		}
+		break;
 		case NET_NFC_MESSAGE_P2P_RECEIVE:
 		{
 			net_nfc_response_p2p_receive_t* detail_msg = (net_nfc_response_p2p_receive_t *)msg->detail_message;
@@ -782,8 +940,8 @@ static bool net_nfc_client_dispatch_response(client_dispatcher_param_t* param)
 				socket_data->type = detail_msg->option.type;
 				socket_data->device_id = detail_msg->handle;
 				socket_data->close_requested = false;
-				socket_data->oal_socket = detail_msg->incomming_socket;
 				_append_internal_socket (socket_data);
+				_set_internal_socket_oal_socket (socket_data, detail_msg->incomming_socket);
 				psocket_info->cb(msg->response_type, detail_msg->result, (void*)&(socket_data->client_socket),psocket_info->register_param, NULL);
 			}
 		}
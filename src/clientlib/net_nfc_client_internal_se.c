@@ -139,3 +139,86 @@ NET_NFC_EXPORT_API net_nfc_error_e net_nfc_send_apdu(net_nfc_target_handle_h han
 	return ret;
 }
 
+NET_NFC_EXPORT_API net_nfc_error_e net_nfc_send_apdu_script(net_nfc_target_handle_h handle, data_h *apdus, uint16_t *expected_sw, uint16_t *sw_mask, uint32_t count, void* trans_param)
+{
+	net_nfc_error_e ret;
+	net_nfc_request_send_apdu_script_t *request = NULL;
+	uint32_t length = 0;
+	uint32_t data_length = 0;
+	uint32_t offset = 0;
+	uint32_t i;
+
+	if (handle == NULL || apdus == NULL || count == 0)
+	{
+		return NET_NFC_NULL_PARAMETER;
+	}
+
+	if (count > NET_NFC_APDU_SCRIPT_MAX_COUNT)
+	{
+		return NET_NFC_OUT_OF_BOUND;
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		data_s *apdu_data = (data_s *)apdus[i];
+
+		if (apdu_data == NULL || apdu_data->buffer == NULL || apdu_data->length == 0)
+		{
+			return NET_NFC_NULL_PARAMETER;
+		}
+
+		data_length += NET_NFC_APDU_SCRIPT_COMMAND_LENGTH(apdu_data->length);
+	}
+
+	/* all commands are carried in one message */
+	length = sizeof(net_nfc_request_send_apdu_script_t) + data_length;
+
+	_net_nfc_client_util_alloc_mem(request, length);
+	if (request == NULL)
+	{
+		return NET_NFC_ALLOC_FAIL;
+	}
+
+	request->length = length;
+	request->request_type = NET_NFC_MESSAGE_SEND_APDU_SCRIPT_SE;
+	request->handle = (net_nfc_target_handle_s *)handle;
+	request->trans_param = trans_param;
+	request->count = count;
+
+	request->data.length = data_length;
+	for (i = 0; i < count; i++)
+	{
+		data_s *apdu_data = (data_s *)apdus[i];
+
+		net_nfc_util_append_apdu_script_command(request->data.buffer, data_length, &offset,
+			(expected_sw != NULL) ? expected_sw[i] : 0, (sw_mask != NULL) ? sw_mask[i] : 0,
+			apdu_data->buffer, apdu_data->length);
+	}
+
+	ret = _net_nfc_client_send_reqeust((net_nfc_request_msg_t *)request, NULL);
+
+	_net_nfc_client_util_free_mem(request);
+
+	return ret;
+}
+
+NET_NFC_EXPORT_API net_nfc_error_e net_nfc_get_atr(net_nfc_target_handle_h handle, void *trans_param)
+{
+	net_nfc_error_e ret;
+	net_nfc_request_get_atr_t request = { 0, };
+
+	if (handle == NULL)
+	{
+		return NET_NFC_NULL_PARAMETER;
+	}
+
+	request.length = sizeof(net_nfc_request_get_atr_t);
+	request.request_type = NET_NFC_MESSAGE_GET_ATR_SE;
+	request.handle = (net_nfc_target_handle_s *)handle;
+	request.trans_param = trans_param;
+
+	ret = _net_nfc_client_send_reqeust((net_nfc_request_msg_t *)&request, NULL);
+
+	return ret;
+}
+
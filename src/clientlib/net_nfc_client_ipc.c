@@ -783,6 +783,147 @@ net_nfc_response_msg_t* net_nfc_client_read_response_msg(net_nfc_error_e* result
 		}
 		break;
 
+		case NET_NFC_MESSAGE_SEND_APDU_SCRIPT_SE:
+		{
+			net_nfc_response_send_apdu_script_t * resp_detail = NULL;
+			int res = 0;
+			res = __net_nfc_client_read_util ((void **)&resp_detail, sizeof (net_nfc_response_send_apdu_script_t));
+			if (res == 1){
+				if(resp_detail->data.length > 0){
+					res += __net_nfc_client_read_util ((void **)&(resp_detail->data.buffer),resp_detail->data.length);
+					if (res == 2){
+						resp_msg->detail_message = resp_detail;
+					}
+					else{
+						_net_nfc_client_util_free_mem (resp_detail);
+						res --;
+					}
+				}
+				else {
+					resp_msg->detail_message = resp_detail;
+					resp_detail->data.buffer = NULL;
+				}
+			}
+			if (res == 0){
+				_net_nfc_client_util_free_mem(resp_msg);
+				return NULL;
+			}
+		}
+		break;
+
+		case NET_NFC_MESSAGE_GET_ATR_SE:
+		{
+			net_nfc_response_get_atr_t * resp_detail = NULL;
+			int res = 0;
+			res = __net_nfc_client_read_util ((void **)&resp_detail, sizeof (net_nfc_response_get_atr_t));
+			if (res == 1){
+				if(resp_detail->data.length > 0){
+					res += __net_nfc_client_read_util ((void **)&(resp_detail->data.buffer),resp_detail->data.length);
+					if (res == 2){
+						resp_msg->detail_message = resp_detail;
+					}
+					else{
+						_net_nfc_client_util_free_mem (resp_detail);
+						res --;
+					}
+				}
+				else {
+					resp_msg->detail_message = resp_detail;
+					resp_detail->data.buffer = NULL;
+				}
+			}
+			if (res == 0){
+				_net_nfc_client_util_free_mem(resp_msg);
+				return NULL;
+			}
+		}
+		break;
+
+		case NET_NFC_MESSAGE_TRANSCEIVE_SEQUENCE:
+		{
+			net_nfc_response_transceive_sequence_t * resp_detail = NULL;
+			int res = 0;
+			res = __net_nfc_client_read_util ((void **)&resp_detail, sizeof (net_nfc_response_transceive_sequence_t));
+			if (res == 1){
+				if(resp_detail->data.length > 0){
+					res += __net_nfc_client_read_util ((void **)&(resp_detail->data.buffer),resp_detail->data.length);
+					if (res == 2){
+						resp_msg->detail_message = resp_detail;
+					}
+					else{
+						_net_nfc_client_util_free_mem (resp_detail);
+						res --;
+					}
+				}
+				else {
+					resp_msg->detail_message = resp_detail;
+					resp_detail->data.buffer = NULL;
+				}
+			}
+			if (res == 0){
+				_net_nfc_client_util_free_mem(resp_msg);
+				return NULL;
+			}
+		}
+		break;
+
+		case NET_NFC_MESSAGE_MIFARE_READ_BLOCKS:
+		case NET_NFC_MESSAGE_MIFARE_WRITE_BLOCKS:
+		{
+			net_nfc_response_mifare_blocks_t * resp_detail = NULL;
+			int res = 0;
+			res = __net_nfc_client_read_util ((void **)&resp_detail, sizeof (net_nfc_response_mifare_blocks_t));
+			if (res == 1){
+				if(resp_detail->data.length > 0){
+					res += __net_nfc_client_read_util ((void **)&(resp_detail->data.buffer),resp_detail->data.length);
+					if (res == 2){
+						resp_msg->detail_message = resp_detail;
+					}
+					else{
+						_net_nfc_client_util_free_mem (resp_detail);
+						res --;
+					}
+				}
+				else {
+					resp_msg->detail_message = resp_detail;
+					resp_detail->data.buffer = NULL;
+				}
+			}
+			if (res == 0){
+				_net_nfc_client_util_free_mem(resp_msg);
+				return NULL;
+			}
+		}
+		break;
+
+		case NET_NFC_MESSAGE_JEWEL_READ_MEMORY:
+		{
+			net_nfc_response_jewel_read_memory_t * resp_detail = NULL;
+			int res = 0;
+			res = __net_nfc_client_read_util ((void **)&resp_detail, sizeof (net_nfc_response_jewel_read_memory_t));
+			if (res == 1){
+				if(resp_detail->data.length > 0){
+					res += __net_nfc_client_read_util ((void **)&(resp_detail->data.buffer),resp_detail->data.length);
+					if (res == 2){
+						resp_msg->detail_message = resp_detail;
+					}
+					else{
+						_net_nfc_client_util_free_mem (resp_detail);
+						res --;
+					}
+				}
+				else {
+					resp_msg->detail_message = resp_detail;
+					resp_detail->data.buffer = NULL;
+				}
+			}
+			if (res == 0){
+				_net_nfc_client_util_free_mem(resp_msg);
+				return NULL;
+			}
+		}
+		break;
+
 		case NET_NFC_MESSAGE_SEND_APDU_SE:
 		{
 
@@ -1231,6 +1372,75 @@ net_nfc_response_msg_t* net_nfc_client_read_response_msg(net_nfc_error_e* result
 		}
 		break;
 
+		case NET_NFC_MESSAGE_LLCP_SEND_TO_BATCH:
+		{
+			net_nfc_response_send_to_batch_socket_t * resp_detail = NULL;
+			int res = 0;
+			res = __net_nfc_client_read_util ((void **)&resp_detail, sizeof (net_nfc_response_send_to_batch_socket_t));
+			if (res != 1){
+				_net_nfc_client_util_free_mem(resp_msg);
+				return NULL;
+			}
+			resp_msg->detail_message = resp_detail;
+		}
+		break;
+
+		case NET_NFC_MESSAGE_SERVICE_SE_EVENT_BATCH:
+		{
+			net_nfc_response_se_event_batch_t * resp_detail = NULL;
+			int res = 0;
+			res = __net_nfc_client_read_util ((void **)&resp_detail, sizeof (net_nfc_response_se_event_batch_t));
+			if (res == 1){
+				if(resp_detail->data.length > 0){
+					res += __net_nfc_client_read_util ((void **)&(resp_detail->data.buffer),resp_detail->data.length);
+					if (res == 2){
+						resp_msg->detail_message = resp_detail;
+					}
+					else{
+						_net_nfc_client_util_free_mem (resp_detail);
+						res --;
+					}
+				}
+				else {
+					resp_msg->detail_message = resp_detail;
+					resp_detail->data.buffer = NULL;
+				}
+			}
+			if (res == 0){
+				_net_nfc_client_util_free_mem(resp_msg);
+				return NULL;
+			}
+		}
+		break;
+
+		case NET_NFC_MESSAGE_LLCP_RECEIVE_FROM_BATCH:
+		{
+			net_nfc_response_receive_from_batch_socket_t * resp_detail = NULL;
+			int res = 0;
+			res = __net_nfc_client_read_util ((void **)&resp_detail, sizeof (net_nfc_response_receive_from_batch_socket_t));
+			if (res == 1){
+				if(resp_detail->data.length > 0){
+					res += __net_nfc_client_read_util ((void **)&(resp_detail->data.buffer),resp_detail->data.length);
+					if (res == 2){
+						resp_msg->detail_message = resp_detail;
+					}
+					else{
+						_net_nfc_client_util_free_mem (resp_detail);
+						res --;
+					}
+				}
+				else {
+					resp_msg->detail_message = resp_detail;
+					resp_detail->data.buffer = NULL;
+				}
+			}
+			if (res == 0){
+				_net_nfc_client_util_free_mem(resp_msg);
+				return NULL;
+			}
+		}
+		break;
+
 		case NET_NFC_MESSAGE_P2P_RECEIVE:
 		{
 			net_nfc_response_p2p_receive_t * resp_detail = NULL;
@@ -29,13 +29,15 @@
 #define NET_NFC_EXPORT_API __attribute__((visibility("default")))
 #endif
 
-GList * socket_list = NULL;
+/* client socket -> socket info, and oal socket -> socket info */
+static GHashTable * socket_table = NULL;
+static GHashTable * oal_socket_table = NULL;
 
 /*
 	Concept of the llcp_lock
 	1. this lock protects only between client thread (these are calling llcp apis) and callback thread queue (=dispatcher thread)
 	2. dispatcher thread is always serial it does not have to protect itself.
-	3. all internal function for example __free_socket_info, __socket_equal_to are used only inside of this file
+	3. all internal function for example __free_socket_info, __init_socket_table are used only inside of this file
 	(there is no way to access from client api) thread safe.
 	4. if the internal function calles from other thread (or changed to public) then you should consider use lock
 */
@@ -48,135 +50,142 @@ static net_nfc_target_handle_s * current_target = NULL;
 static net_nfc_llcp_config_info_s local_config = { 128, 1, 10, 0 };
 static net_nfc_llcp_config_info_s remote_config = { 128, 1, 10, 0 };
 
+/* stream mode context of connection oriented socket */
+typedef struct _net_nfc_llcp_stream_s
+{
+	GByteArray *write_buffer; /* bytes queued by application, head of buffer is in flight */
+	uint32_t write_in_flight; /* bytes of the send request which is not answered yet */
+	uint32_t write_completed; /* bytes sent since the last NET_NFC_MESSAGE_LLCP_STREAM_WRITE */
+	void *write_trans_param;
+
+	GByteArray *read_buffer; /* bytes received but not delivered to application */
+	uint32_t read_watermark; /* read ahead until this amount of bytes is buffered */
+	uint32_t read_requested; /* bytes requested by pending read, 0 if there is no pending read */
+	bool read_in_flight;
+	void *read_trans_param;
+} net_nfc_llcp_stream_s;
+
 /* =============================================================== */
 /* Socket info util */
 
+static void __free_stream(net_nfc_llcp_stream_s * stream)
+{
+	if (stream == NULL)
+		return;
+	g_byte_array_free(stream->write_buffer, TRUE);
+	g_byte_array_free(stream->read_buffer, TRUE);
+	_net_nfc_client_util_free_mem(stream);
+}
+
 static void __free_socket_info(net_nfc_llcp_internal_socket_s * data)
 {
 	net_nfc_llcp_internal_socket_s * socket_info = (net_nfc_llcp_internal_socket_s *)data;
 
 	if (socket_info == NULL)
 		return;
+	__free_stream((net_nfc_llcp_stream_s *)socket_info->stream);
 	_net_nfc_client_util_free_mem(socket_info->service_name);
 	_net_nfc_client_util_free_mem(socket_info);
 }
 
-static int __socket_equal_to(gconstpointer key1, gconstpointer key2)
+static void __socket_table_value_destroy(gpointer data)
 {
-	net_nfc_llcp_internal_socket_s * arg1 = (net_nfc_llcp_internal_socket_s *)key1;
-	net_nfc_llcp_internal_socket_s * arg2 = (net_nfc_llcp_internal_socket_s *)key2;
+	__free_socket_info((net_nfc_llcp_internal_socket_s *)data);
+}
 
-	if (arg1->client_socket < arg2->client_socket)
-	{
-		return -1;
-	}
-	else if (arg1->client_socket > arg2->client_socket)
-	{
-		return 1;
-	}
-	else
+static void __init_socket_table()
+{
+	if (socket_table == NULL)
 	{
-		return 0;
+		/* socket_table owns the socket info, oal_socket_table only refers to it */
+		socket_table = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL, __socket_table_value_destroy);
+		oal_socket_table = g_hash_table_new(g_direct_hash, g_direct_equal);
 	}
 }
 
 net_nfc_llcp_internal_socket_s * _find_internal_socket_info(net_nfc_llcp_socket_t socket)
 {
 	net_nfc_llcp_internal_socket_s * inter_socket = NULL;
-	net_nfc_llcp_internal_socket_s temp = { 0 };
-	GList * found = NULL;
 
 	DEBUG_CLIENT_MSG("Socket info search requested with #[ %d ]", socket);
 
-	temp.client_socket = socket;
-
-	if (socket_list != NULL)
+	if (socket_table != NULL)
 	{
-		found = g_list_find_custom(socket_list, &temp, __socket_equal_to);
+		inter_socket = (net_nfc_llcp_internal_socket_s *)g_hash_table_lookup(socket_table, GUINT_TO_POINTER(socket));
 	}
 
-	if (NULL == found)
+	if (NULL == inter_socket)
 	{
 		DEBUG_CLIENT_MSG("ERROR DATA IS NOT FOUND");
 		return NULL;
 	}
 	else
 	{
-		DEBUG_CLIENT_MSG("socket_info is found address [%X]", found->data);
-		inter_socket = (net_nfc_llcp_internal_socket_s *)found->data;
+		DEBUG_CLIENT_MSG("socket_info is found address [%X]", inter_socket);
 	}
 
 	return inter_socket;
 }
 
-static int __socket_equal_to_by_oal(gconstpointer key1, gconstpointer key2)
-{
-	net_nfc_llcp_internal_socket_s * arg1 = (net_nfc_llcp_internal_socket_s *)key1;
-	net_nfc_llcp_internal_socket_s * arg2 = (net_nfc_llcp_internal_socket_s *)key2;
-
-	if (arg1->oal_socket < arg2->oal_socket)
-	{
-		return -1;
-	}
-	else if (arg1->oal_socket > arg2->oal_socket)
-	{
-		return 1;
-	}
-	else
-	{
-		return 0;
-	}
-}
-
-static void __socket_foreach(gpointer data, gpointer user_data)
-{
-	__free_socket_info((net_nfc_llcp_internal_socket_s *)data);
-}
-
 void _net_nfc_llcp_close_all_socket()
 {
 	pthread_mutex_lock(&llcp_lock);
 
-	if (socket_list != NULL)
+	if (socket_table != NULL)
 	{
-		g_list_foreach(socket_list, __socket_foreach, NULL);
-		g_list_free(socket_list);
+		g_hash_table_remove_all(oal_socket_table);
+		g_hash_table_remove_all(socket_table);
 	}
 
-	socket_list = NULL;
-
 	pthread_mutex_unlock(&llcp_lock);
 }
 
 net_nfc_llcp_internal_socket_s * _find_internal_socket_info_by_oal_socket(net_nfc_llcp_socket_t socket)
 {
 	net_nfc_llcp_internal_socket_s * inter_socket = NULL;
-	net_nfc_llcp_internal_socket_s temp = { 0 };
-	GList * found = NULL;
-
-	temp.oal_socket = socket;
 
 	DEBUG_CLIENT_MSG("search by oal socket is called socket[ %d ] ", socket);
 
-	if (socket_list != NULL)
+	if (oal_socket_table != NULL)
 	{
-		found = g_list_find_custom(socket_list, &temp, __socket_equal_to_by_oal);
+		inter_socket = (net_nfc_llcp_internal_socket_s *)g_hash_table_lookup(oal_socket_table, GUINT_TO_POINTER(socket));
 	}
 
-	if (NULL == found)
+	if (NULL == inter_socket)
 	{
 		DEBUG_CLIENT_MSG("ERROR DATA IS NOT FOUND");
 		return NULL;
 	}
 	else
 	{
-		inter_socket = (net_nfc_llcp_internal_socket_s *)found->data;
 		DEBUG_CLIENT_MSG("oal socket_info is found address [%X]", inter_socket);
 	}
 
 	return inter_socket;
 }
 
+void _set_internal_socket_oal_socket(net_nfc_llcp_internal_socket_s * data, net_nfc_llcp_socket_t oal_socket)
+{
+	pthread_mutex_lock(&llcp_lock);
+
+	if (data == NULL || oal_socket_table == NULL)
+	{
+		pthread_mutex_unlock(&llcp_lock);
+		return;
+	}
+
+	/* drop the previous index only if it still points to this socket */
+	if (g_hash_table_lookup(oal_socket_table, GUINT_TO_POINTER(data->oal_socket)) == data)
+	{
+		g_hash_table_remove(oal_socket_table, GUINT_TO_POINTER(data->oal_socket));
+	}
+
+	data->oal_socket = oal_socket;
+	g_hash_table_insert(oal_socket_table, GUINT_TO_POINTER(oal_socket), data);
+
+	pthread_mutex_unlock(&llcp_lock);
+}
+
 void _remove_internal_socket(net_nfc_llcp_internal_socket_s * data)
 {
 	pthread_mutex_lock(&llcp_lock);
@@ -187,10 +196,19 @@ void _remove_internal_socket(net_nfc_llcp_internal_socket_s * data)
 		return;
 	}
 
-	if (socket_list != NULL)
+	if (socket_table != NULL)
 	{
+		if (g_hash_table_lookup(oal_socket_table, GUINT_TO_POINTER(data->oal_socket)) == data)
+		{
+			g_hash_table_remove(oal_socket_table, GUINT_TO_POINTER(data->oal_socket));
+		}
 
-		socket_list = g_list_remove(socket_list, data);
+		/* socket_table frees the socket info */
+		if (g_hash_table_remove(socket_table, GUINT_TO_POINTER(data->client_socket)) == TRUE)
+		{
+			pthread_mutex_unlock(&llcp_lock);
+			return;
+		}
 	}
 	__free_socket_info(data);
 
@@ -203,12 +221,61 @@ void _append_internal_socket(net_nfc_llcp_internal_socket_s * data)
 
 	if (data != NULL)
 	{
-		socket_list = g_list_append(socket_list, data);
+		__init_socket_table();
+		g_hash_table_insert(socket_table, GUINT_TO_POINTER(data->client_socket), data);
 	}
 
 	pthread_mutex_unlock(&llcp_lock);
 }
 
+/* these should be called with llcp_lock */
+static net_nfc_error_e __send_llcp_request(net_nfc_llcp_internal_socket_s * psocket_data, uint8_t * buffer, uint32_t buffer_length, void * trans_param)
+{
+	net_nfc_request_send_socket_t *request = NULL;
+	net_nfc_error_e ret;
+	uint32_t length = 0;
+
+	/* fill request message */
+	length = sizeof(net_nfc_request_send_socket_t) + buffer_length;
+
+	_net_nfc_client_util_alloc_mem(request, length);
+	if (request == NULL)
+	{
+		return NET_NFC_ALLOC_FAIL;
+	}
+
+	request->length = length;
+	request->request_type = NET_NFC_MESSAGE_LLCP_SEND;
+	request->handle = current_target;
+	request->oal_socket = psocket_data->oal_socket;
+	request->client_socket = psocket_data->client_socket;
+	request->trans_param = trans_param;
+
+	request->data.length = buffer_length;
+	memcpy(&request->data.buffer, buffer, request->data.length);
+
+	ret = _net_nfc_client_send_reqeust((net_nfc_request_msg_t *)request, NULL);
+
+	_net_nfc_client_util_free_mem(request);
+
+	return ret;
+}
+
+static net_nfc_error_e __receive_llcp_request(net_nfc_llcp_internal_socket_s * psocket_data, size_t req_length, void * trans_param)
+{
+	net_nfc_request_receive_socket_t request = { 0, };
+
+	request.length = sizeof(net_nfc_request_receive_socket_t);
+	request.request_type = NET_NFC_MESSAGE_LLCP_RECEIVE;
+	request.handle = current_target;
+	request.oal_socket = psocket_data->oal_socket;
+	request.client_socket = psocket_data->client_socket;
+	request.trans_param = trans_param;
+	request.req_length = req_length;
+
+	return _net_nfc_client_send_reqeust((net_nfc_request_msg_t *)&request, NULL);
+}
+
 /* =============================================================== */
 NET_NFC_EXPORT_API net_nfc_error_e net_nfc_create_llcp_socket(net_nfc_llcp_socket_t * socket, net_nfc_llcp_socket_option_h options)
 {
@@ -438,9 +505,510 @@ NET_NFC_EXPORT_API net_nfc_error_e net_nfc_close_llcp_socket(net_nfc_llcp_socket
 NET_NFC_EXPORT_API net_nfc_error_e net_nfc_send_llcp(net_nfc_llcp_socket_t socket, data_h data, void * trans_param)
 {
 	net_nfc_llcp_internal_socket_s *psocket_data;
-	net_nfc_request_send_socket_t *request = NULL;
 	data_s *data_private = (data_s *)data;
 	net_nfc_error_e ret;
+
+	if (data_private == NULL || data_private->buffer == NULL || data_private->length == 0)
+	{
+		return NET_NFC_NULL_PARAMETER;
+	}
+
+	DEBUG_CLIENT_MSG("function %s is called. socket#[ %d ]", __func__, socket);
+
+	pthread_mutex_lock(&llcp_lock);
+	psocket_data = _find_internal_socket_info(socket);
+	if (psocket_data == NULL)
+	{
+		pthread_mutex_unlock(&llcp_lock);
+		return NET_NFC_LLCP_INVALID_SOCKET;
+	}
+
+	/* responses of stream socket are consumed by stream layer */
+	if (psocket_data->stream != NULL)
+	{
+		pthread_mutex_unlock(&llcp_lock);
+		return NET_NFC_NOT_ALLOWED_OPERATION;
+	}
+
+	ret = __send_llcp_request(psocket_data, data_private->buffer, data_private->length, trans_param);
+
+	pthread_mutex_unlock(&llcp_lock);
+
+	return ret;
+}
+
+NET_NFC_EXPORT_API net_nfc_error_e net_nfc_receive_llcp(net_nfc_llcp_socket_t socket, size_t req_length, void * trans_param)
+{
+	net_nfc_llcp_internal_socket_s *psocket_data = NULL;
+	net_nfc_error_e ret;
+
+	DEBUG_CLIENT_MSG("function %s is called. socket#[ %d ]", __func__, socket);
+
+	pthread_mutex_lock(&llcp_lock);
+
+	psocket_data = _find_internal_socket_info(socket);
+	if (psocket_data == NULL)
+	{
+		pthread_mutex_unlock(&llcp_lock);
+		return NET_NFC_LLCP_INVALID_SOCKET;
+	}
+
+	if (psocket_data->stream != NULL)
+	{
+		pthread_mutex_unlock(&llcp_lock);
+		return NET_NFC_NOT_ALLOWED_OPERATION;
+	}
+
+	ret = __receive_llcp_request(psocket_data, req_length, trans_param);
+
+	pthread_mutex_unlock(&llcp_lock);
+
+	return ret;
+}
+
+/* =============================================================== */
+/* Stream mode */
+
+/*
+	Stream mode is built on the connection oriented send/receive requests.
+	1. only one send and one receive request of the socket is in flight at a time.
+	2. writes which are queued while a send is in flight are coalesced and sent as one PDU (up to socket miu).
+	3. receive requests are issued in advance until "read_watermark" bytes are buffered,
+	   or until the pending read can be completed.
+	4. NET_NFC_MESSAGE_LLCP_SEND/RECEIVE responses of stream socket are passed to
+	   _net_nfc_llcp_stream_on_send/_net_nfc_llcp_stream_on_receive by the dispatcher.
+*/
+
+static uint32_t __stream_pdu_length(net_nfc_llcp_internal_socket_s * psocket_data)
+{
+	return (psocket_data->miu > 0) ? psocket_data->miu : 128;
+}
+
+/* these should be called with llcp_lock */
+static net_nfc_error_e __stream_write_next(net_nfc_llcp_internal_socket_s * psocket_data, net_nfc_llcp_stream_s * stream)
+{
+	net_nfc_error_e ret;
+	uint32_t length;
+
+	if (stream->write_in_flight > 0 || stream->write_buffer->len == 0)
+		return NET_NFC_OK;
+
+	length = MIN(stream->write_buffer->len, __stream_pdu_length(psocket_data));
+
+	ret = __send_llcp_request(psocket_data, stream->write_buffer->data, length, NULL);
+	if (ret == NET_NFC_OK)
+	{
+		stream->write_in_flight = length;
+	}
+
+	return ret;
+}
+
+static net_nfc_error_e __stream_read_ahead(net_nfc_llcp_internal_socket_s * psocket_data, net_nfc_llcp_stream_s * stream)
+{
+	net_nfc_error_e ret;
+
+	if (stream->read_in_flight == true)
+		return NET_NFC_OK;
+
+	if (stream->read_buffer->len >= stream->read_watermark && stream->read_buffer->len >= stream->read_requested)
+		return NET_NFC_OK;
+
+	ret = __receive_llcp_request(psocket_data, __stream_pdu_length(psocket_data), NULL);
+	if (ret == NET_NFC_OK)
+	{
+		stream->read_in_flight = true;
+	}
+
+	return ret;
+}
+
+/* take the bytes of pending read out of read buffer, caller should free the returned buffer */
+static void __stream_take_read_data(net_nfc_llcp_stream_s * stream, data_s * data)
+{
+	data->length = MIN(stream->read_requested, stream->read_buffer->len);
+	data->buffer = NULL;
+
+	if (data->length > 0)
+	{
+		_net_nfc_client_util_alloc_mem(data->buffer, data->length);
+		if (data->buffer == NULL)
+		{
+			data->length = 0;
+		}
+		else
+		{
+			memcpy(data->buffer, stream->read_buffer->data, data->length);
+			g_byte_array_remove_range(stream->read_buffer, 0, data->length);
+		}
+	}
+
+	stream->read_requested = 0;
+}
+
+NET_NFC_EXPORT_API net_nfc_error_e net_nfc_enable_llcp_stream(net_nfc_llcp_socket_t socket, uint32_t read_watermark)
+{
+	net_nfc_llcp_internal_socket_s *psocket_data = NULL;
+	net_nfc_llcp_stream_s *stream = NULL;
+	net_nfc_error_e ret;
+
+	DEBUG_CLIENT_MSG("function %s is called. socket#[ %d ], watermark [%d]", __func__, socket, read_watermark);
+
+	pthread_mutex_lock(&llcp_lock);
+
+	psocket_data = _find_internal_socket_info(socket);
+	if (psocket_data == NULL)
+	{
+		pthread_mutex_unlock(&llcp_lock);
+		return NET_NFC_LLCP_INVALID_SOCKET;
+	}
+
+	if (psocket_data->type != NET_NFC_LLCP_SOCKET_TYPE_CONNECTIONORIENTED)
+	{
+		pthread_mutex_unlock(&llcp_lock);
+		return NET_NFC_NOT_SUPPORTED;
+	}
+
+	if (psocket_data->stream != NULL)
+	{
+		/* already in stream mode, just update the watermark */
+		stream = (net_nfc_llcp_stream_s *)psocket_data->stream;
+		stream->read_watermark = read_watermark;
+
+		ret = __stream_read_ahead(psocket_data, stream);
+
+		pthread_mutex_unlock(&llcp_lock);
+		return ret;
+	}
+
+	_net_nfc_client_util_alloc_mem(stream, sizeof(net_nfc_llcp_stream_s));
+	if (stream == NULL)
+	{
+		pthread_mutex_unlock(&llcp_lock);
+		return NET_NFC_ALLOC_FAIL;
+	}
+
+	stream->write_buffer = g_byte_array_new();
+	stream->read_buffer = g_byte_array_new();
+	stream->read_watermark = read_watermark;
+
+	ret = __stream_read_ahead(psocket_data, stream);
+	if (ret == NET_NFC_OK)
+	{
+		psocket_data->stream = stream;
+	}
+	else
+	{
+		__free_stream(stream);
+	}
+
+	pthread_mutex_unlock(&llcp_lock);
+
+	return ret;
+}
+
+NET_NFC_EXPORT_API net_nfc_error_e net_nfc_disable_llcp_stream(net_nfc_llcp_socket_t socket)
+{
+	net_nfc_llcp_internal_socket_s *psocket_data = NULL;
+	net_nfc_llcp_stream_s *stream = NULL;
+
+	DEBUG_CLIENT_MSG("function %s is called. socket#[ %d ]", __func__, socket);
+
+	pthread_mutex_lock(&llcp_lock);
+
+	psocket_data = _find_internal_socket_info(socket);
+	if (psocket_data == NULL)
+	{
+		pthread_mutex_unlock(&llcp_lock);
+		return NET_NFC_LLCP_INVALID_SOCKET;
+	}
+
+	stream = (net_nfc_llcp_stream_s *)psocket_data->stream;
+	if (stream == NULL)
+	{
+		pthread_mutex_unlock(&llcp_lock);
+		return NET_NFC_OK;
+	}
+
+	/* response of in flight request should be consumed by stream layer */
+	if (stream->write_in_flight > 0 || stream->read_in_flight == true)
+	{
+		pthread_mutex_unlock(&llcp_lock);
+		return NET_NFC_BUSY;
+	}
+
+	psocket_data->stream = NULL;
+	__free_stream(stream);
+
+	pthread_mutex_unlock(&llcp_lock);
+
+	return NET_NFC_OK;
+}
+
+NET_NFC_EXPORT_API net_nfc_error_e net_nfc_write_llcp_stream(net_nfc_llcp_socket_t socket, data_h data, void * trans_param)
+{
+	net_nfc_llcp_internal_socket_s *psocket_data = NULL;
+	net_nfc_llcp_stream_s *stream = NULL;
+	data_s *data_private = (data_s *)data;
+	net_nfc_error_e ret;
+	uint32_t prev_length;
+
+	if (data_private == NULL || data_private->buffer == NULL || data_private->length == 0)
+	{
+		return NET_NFC_NULL_PARAMETER;
+	}
+
+	DEBUG_CLIENT_MSG("function %s is called. socket#[ %d ], length [%d]", __func__, socket, data_private->length);
+
+	pthread_mutex_lock(&llcp_lock);
+
+	psocket_data = _find_internal_socket_info(socket);
+	if (psocket_data == NULL)
+	{
+		pthread_mutex_unlock(&llcp_lock);
+		return NET_NFC_LLCP_INVALID_SOCKET;
+	}
+
+	stream = (net_nfc_llcp_stream_s *)psocket_data->stream;
+	if (stream == NULL)
+	{
+		pthread_mutex_unlock(&llcp_lock);
+		return NET_NFC_INVALID_STATE;
+	}
+
+	prev_length = stream->write_buffer->len;
+	g_byte_array_append(stream->write_buffer, data_private->buffer, data_private->length);
+	stream->write_trans_param = trans_param;
+
+	/* if a send is in flight, data is sent together with other writes when it is answered */
+	ret = __stream_write_next(psocket_data, stream);
+	if (ret != NET_NFC_OK)
+	{
+		g_byte_array_set_size(stream->write_buffer, prev_length);
+	}
+
+	pthread_mutex_unlock(&llcp_lock);
+
+	return ret;
+}
+
+NET_NFC_EXPORT_API net_nfc_error_e net_nfc_read_llcp_stream(net_nfc_llcp_socket_t socket, uint32_t length, void * trans_param)
+{
+	net_nfc_llcp_internal_socket_s *psocket_data = NULL;
+	net_nfc_llcp_stream_s *stream = NULL;
+	net_nfc_llcp_socket_cb cb = NULL;
+	void *register_param = NULL;
+	data_s data = { NULL, 0 };
+	net_nfc_error_e ret;
+
+	if (length == 0)
+	{
+		return NET_NFC_OUT_OF_BOUND;
+	}
+
+	DEBUG_CLIENT_MSG("function %s is called. socket#[ %d ], length [%d]", __func__, socket, length);
+
+	pthread_mutex_lock(&llcp_lock);
+
+	psocket_data = _find_internal_socket_info(socket);
+	if (psocket_data == NULL)
+	{
+		pthread_mutex_unlock(&llcp_lock);
+		return NET_NFC_LLCP_INVALID_SOCKET;
+	}
+
+	stream = (net_nfc_llcp_stream_s *)psocket_data->stream;
+	if (stream == NULL)
+	{
+		pthread_mutex_unlock(&llcp_lock);
+		return NET_NFC_INVALID_STATE;
+	}
+
+	if (stream->read_requested > 0)
+	{
+		pthread_mutex_unlock(&llcp_lock);
+		return NET_NFC_BUSY;
+	}
+
+	stream->read_requested = length;
+	stream->read_trans_param = trans_param;
+
+	if (stream->read_buffer->len < length)
+	{
+		ret = __stream_read_ahead(psocket_data, stream);
+		if (ret != NET_NFC_OK)
+		{
+			stream->read_requested = 0;
+		}
+
+		pthread_mutex_unlock(&llcp_lock);
+		return ret;
+	}
+
+	/* enough bytes are already buffered, complete it without ipc */
+	__stream_take_read_data(stream, &data);
+	__stream_read_ahead(psocket_data, stream);
+
+	cb = psocket_data->cb;
+	register_param = psocket_data->register_param;
+
+	pthread_mutex_unlock(&llcp_lock);
+
+	if (cb != NULL)
+	{
+		cb(NET_NFC_MESSAGE_LLCP_STREAM_READ, (data.buffer != NULL) ? NET_NFC_OK : NET_NFC_ALLOC_FAIL, &data, register_param, trans_param);
+	}
+
+	_net_nfc_client_util_free_mem(data.buffer);
+
+	return NET_NFC_OK;
+}
+
+/* called in dispatcher thread, return false if the socket is not in stream mode */
+bool _net_nfc_llcp_stream_on_send(net_nfc_llcp_internal_socket_s * psocket_data, net_nfc_error_e result)
+{
+	net_nfc_llcp_stream_s *stream = NULL;
+	net_nfc_llcp_socket_cb cb = NULL;
+	void *register_param = NULL;
+	void *trans_param = NULL;
+	uint32_t completed = 0;
+	bool notify = false;
+
+	pthread_mutex_lock(&llcp_lock);
+
+	stream = (net_nfc_llcp_stream_s *)psocket_data->stream;
+	if (stream == NULL)
+	{
+		pthread_mutex_unlock(&llcp_lock);
+		return false;
+	}
+
+	if (result == NET_NFC_OK)
+	{
+		g_byte_array_remove_range(stream->write_buffer, 0, stream->write_in_flight);
+		stream->write_completed += stream->write_in_flight;
+		stream->write_in_flight = 0;
+
+		result = __stream_write_next(psocket_data, stream);
+	}
+
+	if (result != NET_NFC_OK)
+	{
+		DEBUG_ERR_MSG("stream write is failed [%d], drop [%d] bytes", result, stream->write_buffer->len);
+
+		g_byte_array_set_size(stream->write_buffer, 0);
+		stream->write_in_flight = 0;
+	}
+
+	/* notify only when all queued bytes are sent, or on error */
+	if (stream->write_in_flight == 0)
+	{
+		notify = true;
+		completed = stream->write_completed;
+		stream->write_completed = 0;
+		trans_param = stream->write_trans_param;
+		cb = psocket_data->cb;
+		register_param = psocket_data->register_param;
+	}
+
+	pthread_mutex_unlock(&llcp_lock);
+
+	if (notify == true && cb != NULL)
+	{
+		cb(NET_NFC_MESSAGE_LLCP_STREAM_WRITE, result, &completed, register_param, trans_param);
+	}
+
+	return true;
+}
+
+/* called in dispatcher thread, return false if the socket is not in stream mode */
+bool _net_nfc_llcp_stream_on_receive(net_nfc_llcp_internal_socket_s * psocket_data, net_nfc_error_e result, data_s * received)
+{
+	net_nfc_llcp_stream_s *stream = NULL;
+	net_nfc_llcp_socket_cb cb = NULL;
+	void *register_param = NULL;
+	void *trans_param = NULL;
+	data_s data = { NULL, 0 };
+	net_nfc_error_e ret;
+	bool notify = false;
+
+	pthread_mutex_lock(&llcp_lock);
+
+	stream = (net_nfc_llcp_stream_s *)psocket_data->stream;
+	if (stream == NULL)
+	{
+		pthread_mutex_unlock(&llcp_lock);
+		return false;
+	}
+
+	stream->read_in_flight = false;
+
+	if (result == NET_NFC_OK && received != NULL && received->buffer != NULL && received->length > 0)
+	{
+		g_byte_array_append(stream->read_buffer, received->buffer, received->length);
+	}
+
+	/* complete pending read when enough bytes are buffered */
+	if (result == NET_NFC_OK && stream->read_requested > 0 && stream->read_buffer->len >= stream->read_requested)
+	{
+		notify = true;
+		trans_param = stream->read_trans_param;
+		__stream_take_read_data(stream, &data);
+
+		if (data.buffer == NULL)
+		{
+			result = NET_NFC_ALLOC_FAIL;
+		}
+	}
+
+	if (result == NET_NFC_OK)
+	{
+		if ((ret = __stream_read_ahead(psocket_data, stream)) != NET_NFC_OK)
+		{
+			DEBUG_ERR_MSG("stream read ahead is failed [%d]", ret);
+
+			/* pending read can not be completed anymore */
+			if (stream->read_requested > 0)
+				result = ret;
+		}
+	}
+	else
+	{
+		DEBUG_ERR_MSG("stream read is failed [%d]", result);
+	}
+
+	/* on error, pending read is completed with the bytes we have */
+	if (result != NET_NFC_OK && stream->read_requested > 0)
+	{
+		notify = true;
+		trans_param = stream->read_trans_param;
+		__stream_take_read_data(stream, &data);
+	}
+
+	if (notify == true)
+	{
+		cb = psocket_data->cb;
+		register_param = psocket_data->register_param;
+	}
+
+	pthread_mutex_unlock(&llcp_lock);
+
+	if (notify == true && cb != NULL)
+	{
+		cb(NET_NFC_MESSAGE_LLCP_STREAM_READ, result, &data, register_param, trans_param);
+	}
+
+	_net_nfc_client_util_free_mem(data.buffer);
+
+	return true;
+}
+
+NET_NFC_EXPORT_API net_nfc_error_e net_nfc_send_to_llcp(net_nfc_llcp_socket_t socket, sap_t dsap, data_h data, void *trans_param)
+{
+	net_nfc_llcp_internal_socket_s *psocket_data = NULL;
+	net_nfc_request_send_to_socket_t *request = NULL;
+	data_s * data_private = (data_s *)data;
+	net_nfc_error_e ret;
 	uint32_t length = 0;
 
 	if (data_private == NULL || data_private->buffer == NULL || data_private->length == 0)
@@ -459,7 +1027,7 @@ NET_NFC_EXPORT_API net_nfc_error_e net_nfc_send_llcp(net_nfc_llcp_socket_t socke
 	}
 
 	/* fill request message */
-	length = sizeof(net_nfc_request_send_socket_t) + data_private->length;
+	length = sizeof(net_nfc_request_send_to_socket_t) + data_private->length;
 
 	_net_nfc_client_util_alloc_mem(request, length);
 	if (request == NULL)
@@ -469,7 +1037,7 @@ NET_NFC_EXPORT_API net_nfc_error_e net_nfc_send_llcp(net_nfc_llcp_socket_t socke
 	}
 
 	request->length = length;
-	request->request_type = NET_NFC_MESSAGE_LLCP_SEND;
+	request->request_type = NET_NFC_MESSAGE_LLCP_SEND_TO;
 	request->handle = current_target;
 	request->oal_socket = psocket_data->oal_socket;
 	request->client_socket = psocket_data->client_socket;
@@ -487,10 +1055,10 @@ NET_NFC_EXPORT_API net_nfc_error_e net_nfc_send_llcp(net_nfc_llcp_socket_t socke
 	return ret;
 }
 
-NET_NFC_EXPORT_API net_nfc_error_e net_nfc_receive_llcp(net_nfc_llcp_socket_t socket, size_t req_length, void * trans_param)
+NET_NFC_EXPORT_API net_nfc_error_e net_nfc_receive_from_llcp(net_nfc_llcp_socket_t socket, sap_t ssap, size_t req_length, void * trans_param)
 {
 	net_nfc_llcp_internal_socket_s *psocket_data = NULL;
-	net_nfc_request_receive_socket_t request = { 0, };
+	net_nfc_request_receive_from_socket_t request = { 0, };
 	net_nfc_error_e ret;
 
 	DEBUG_CLIENT_MSG("function %s is called. socket#[ %d ]", __func__, socket);
@@ -504,8 +1072,8 @@ NET_NFC_EXPORT_API net_nfc_error_e net_nfc_receive_llcp(net_nfc_llcp_socket_t so
 		return NET_NFC_LLCP_INVALID_SOCKET;
 	}
 
-	request.length = sizeof(net_nfc_request_receive_socket_t);
-	request.request_type = NET_NFC_MESSAGE_LLCP_RECEIVE;
+	request.length = sizeof(net_nfc_request_receive_from_socket_t);
+	request.request_type = NET_NFC_MESSAGE_LLCP_RECEIVE_FROM;
 	request.handle = current_target;
 	request.oal_socket = psocket_data->oal_socket;
 	request.client_socket = psocket_data->client_socket;
@@ -519,20 +1087,38 @@ NET_NFC_EXPORT_API net_nfc_error_e net_nfc_receive_llcp(net_nfc_llcp_socket_t so
 	return ret;
 }
 
-NET_NFC_EXPORT_API net_nfc_error_e net_nfc_send_to_llcp(net_nfc_llcp_socket_t socket, sap_t dsap, data_h data, void *trans_param)
+NET_NFC_EXPORT_API net_nfc_error_e net_nfc_send_to_llcp_batch(net_nfc_llcp_socket_t socket, sap_t dsap, data_h * datagrams, uint32_t count, void * trans_param)
 {
 	net_nfc_llcp_internal_socket_s *psocket_data = NULL;
-	net_nfc_request_send_to_socket_t *request = NULL;
-	data_s * data_private = (data_s *)data;
+	net_nfc_request_send_to_batch_socket_t *request = NULL;
 	net_nfc_error_e ret;
-	uint32_t length = 0;
+	uint32_t data_length = 0;
+	uint32_t offset = 0;
+	uint32_t i;
 
-	if (data_private == NULL || data_private->buffer == NULL || data_private->length == 0)
+	if (datagrams == NULL || count == 0)
 	{
 		return NET_NFC_NULL_PARAMETER;
 	}
 
-	DEBUG_CLIENT_MSG("function %s is called. socket#[ %d ]", __func__, socket);
+	if (count > NET_NFC_LLCP_BATCH_MAX_COUNT)
+	{
+		return NET_NFC_OUT_OF_BOUND;
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		data_s *data_private = (data_s *)datagrams[i];
+
+		if (data_private == NULL || data_private->buffer == NULL || data_private->length == 0)
+		{
+			return NET_NFC_NULL_PARAMETER;
+		}
+
+		data_length += NET_NFC_LLCP_BATCH_DATAGRAM_LENGTH(data_private->length);
+	}
+
+	DEBUG_CLIENT_MSG("function %s is called. socket#[ %d ], count [%d]", __func__, socket, count);
 
 	pthread_mutex_lock(&llcp_lock);
 	psocket_data = _find_internal_socket_info(socket);
@@ -542,25 +1128,30 @@ NET_NFC_EXPORT_API net_nfc_error_e net_nfc_send_to_llcp(net_nfc_llcp_socket_t so
 		return NET_NFC_LLCP_INVALID_SOCKET;
 	}
 
-	/* fill request message */
-	length = sizeof(net_nfc_request_send_to_socket_t) + data_private->length;
-
-	_net_nfc_client_util_alloc_mem(request, length);
+	/* fill request message, all datagrams are carried in one message */
+	_net_nfc_client_util_alloc_mem(request, sizeof(net_nfc_request_send_to_batch_socket_t) + data_length);
 	if (request == NULL)
 	{
 		pthread_mutex_unlock(&llcp_lock);
 		return NET_NFC_ALLOC_FAIL;
 	}
 
-	request->length = length;
-	request->request_type = NET_NFC_MESSAGE_LLCP_SEND_TO;
+	request->length = sizeof(net_nfc_request_send_to_batch_socket_t) + data_length;
+	request->request_type = NET_NFC_MESSAGE_LLCP_SEND_TO_BATCH;
 	request->handle = current_target;
 	request->oal_socket = psocket_data->oal_socket;
 	request->client_socket = psocket_data->client_socket;
 	request->trans_param = trans_param;
+	request->dsap = dsap;
+	request->count = count;
 
-	request->data.length = data_private->length;
-	memcpy(&request->data.buffer, data_private->buffer, request->data.length);
+	request->data.length = data_length;
+	for (i = 0; i < count; i++)
+	{
+		data_s *data_private = (data_s *)datagrams[i];
+
+		net_nfc_util_append_llcp_batch_datagram(request->data.buffer, data_length, &offset, data_private->buffer, data_private->length);
+	}
 
 	ret = _net_nfc_client_send_reqeust((net_nfc_request_msg_t *)request, NULL);
 
@@ -571,13 +1162,18 @@ NET_NFC_EXPORT_API net_nfc_error_e net_nfc_send_to_llcp(net_nfc_llcp_socket_t so
 	return ret;
 }
 
-NET_NFC_EXPORT_API net_nfc_error_e net_nfc_receive_from_llcp(net_nfc_llcp_socket_t socket, sap_t ssap, size_t req_length, void * trans_param)
+NET_NFC_EXPORT_API net_nfc_error_e net_nfc_receive_from_llcp_batch(net_nfc_llcp_socket_t socket, sap_t ssap, size_t req_length, uint32_t count, void * trans_param)
 {
 	net_nfc_llcp_internal_socket_s *psocket_data = NULL;
-	net_nfc_request_receive_from_socket_t request = { 0, };
+	net_nfc_request_receive_from_batch_socket_t request = { 0, };
 	net_nfc_error_e ret;
 
-	DEBUG_CLIENT_MSG("function %s is called. socket#[ %d ]", __func__, socket);
+	if (count == 0 || count > NET_NFC_LLCP_BATCH_MAX_COUNT)
+	{
+		return NET_NFC_OUT_OF_BOUND;
+	}
+
+	DEBUG_CLIENT_MSG("function %s is called. socket#[ %d ], count [%d]", __func__, socket, count);
 
 	pthread_mutex_lock(&llcp_lock);
 
@@ -588,13 +1184,14 @@ NET_NFC_EXPORT_API net_nfc_error_e net_nfc_receive_from_llcp(net_nfc_llcp_socket
 		return NET_NFC_LLCP_INVALID_SOCKET;
 	}
 
-	request.length = sizeof(net_nfc_request_receive_from_socket_t);
-	request.request_type = NET_NFC_MESSAGE_LLCP_RECEIVE_FROM;
+	request.length = sizeof(net_nfc_request_receive_from_batch_socket_t);
+	request.request_type = NET_NFC_MESSAGE_LLCP_RECEIVE_FROM_BATCH;
 	request.handle = current_target;
 	request.oal_socket = psocket_data->oal_socket;
 	request.client_socket = psocket_data->client_socket;
 	request.trans_param = trans_param;
 	request.req_length = req_length;
+	request.count = count;
 
 	ret = _net_nfc_client_send_reqeust((net_nfc_request_msg_t *)&request, NULL);
 
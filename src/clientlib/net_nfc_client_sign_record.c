@@ -31,6 +31,26 @@ NET_NFC_EXPORT_API net_nfc_error_e net_nfc_sign_ndef_message(ndef_message_h msg,
 	return net_nfc_util_sign_ndef_message((ndef_message_s *)msg, cert_file, password);
 }
 
+NET_NFC_EXPORT_API net_nfc_error_e net_nfc_create_sign_key(net_nfc_sign_key_h *key, char *cert_file, char *password)
+{
+	return net_nfc_util_create_sign_key((net_nfc_sign_key_s **)key, cert_file, password);
+}
+
+NET_NFC_EXPORT_API net_nfc_error_e net_nfc_free_sign_key(net_nfc_sign_key_h key)
+{
+	return net_nfc_util_free_sign_key((net_nfc_sign_key_s *)key);
+}
+
+NET_NFC_EXPORT_API net_nfc_error_e net_nfc_sign_records_with_key(ndef_message_h msg, int begin_index, int end_index, net_nfc_sign_key_h key)
+{
+	return net_nfc_util_sign_records_with_key((ndef_message_s *)msg, begin_index, end_index, (net_nfc_sign_key_s *)key);
+}
+
+NET_NFC_EXPORT_API net_nfc_error_e net_nfc_sign_ndef_message_with_key(ndef_message_h msg, net_nfc_sign_key_h key)
+{
+	return net_nfc_util_sign_ndef_message_with_key((ndef_message_s *)msg, (net_nfc_sign_key_s *)key);
+}
+
 NET_NFC_EXPORT_API net_nfc_error_e net_nfc_verify_signature_ndef_message(ndef_message_h msg)
 {
 	return net_nfc_util_verify_signature_ndef_message((ndef_message_s *)msg);
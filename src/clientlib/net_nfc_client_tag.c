@@ -96,6 +96,58 @@ NET_NFC_EXPORT_API net_nfc_event_filter_e net_nfc_get_tag_filter()
 	return filter;
 }
 
+/* wraps raw command in the frame that controller expects for the tag type */
+static net_nfc_error_e _net_nfc_make_transceive_frame(net_nfc_target_type_e dev_type, data_s *data, data_s *frame)
+{
+	switch(dev_type)
+	{
+		case NET_NFC_MIFARE_MINI_PICC :
+		case NET_NFC_MIFARE_1K_PICC :
+		case NET_NFC_MIFARE_4K_PICC :
+		case NET_NFC_MIFARE_ULTRA_PICC :
+		{
+			frame->length = data->length + 2;
+		}
+		break;
+
+		case NET_NFC_JEWEL_PICC :
+		{
+			if(data->length > 9)
+			{
+				return NET_NFC_INVALID_PARAM;
+			}
+
+			frame->length = 9;
+		}
+		break;
+
+		default :
+		{
+			frame->length = data->length;
+		}
+		break;
+	}
+
+	_net_nfc_client_util_alloc_mem(frame->buffer, frame->length);
+	if (frame->buffer == NULL)
+	{
+		return NET_NFC_ALLOC_FAIL;
+	}
+
+	memcpy(frame->buffer, data->buffer, data->length);
+
+	if (dev_type == NET_NFC_JEWEL_PICC)
+	{
+		net_nfc_util_compute_CRC(CRC_B, frame->buffer, frame->length);
+	}
+	else if (frame->length > data->length)
+	{
+		net_nfc_util_compute_CRC(CRC_A, frame->buffer, frame->length);
+	}
+
+	return NET_NFC_OK;
+}
+
 NET_NFC_EXPORT_API net_nfc_error_e net_nfc_transceive(net_nfc_target_handle_h handle, data_h rawdata, void* trans_param)
 {
 	net_nfc_error_e ret;
@@ -104,7 +156,7 @@ NET_NFC_EXPORT_API net_nfc_error_e net_nfc_transceive(net_nfc_target_handle_h ha
 	net_nfc_target_info_s *target_info = NULL;
 	uint32_t length = 0;
 	data_s *data = (data_s *)rawdata;
-	uint8_t *send_buffer;
+	data_s frame = { NULL, 0 };
 
 	DEBUG_CLIENT_MSG("send reqeust :: transceive = [%d]", handle);
 
@@ -126,91 +178,148 @@ NET_NFC_EXPORT_API net_nfc_error_e net_nfc_transceive(net_nfc_target_handle_h ha
 	/* fill trans information struct */
 	target_info = client_context_tmp->target_info;
 
-	switch(target_info->devType)
+	if ((ret = _net_nfc_make_transceive_frame(target_info->devType, data, &frame)) != NET_NFC_OK)
 	{
-		case NET_NFC_MIFARE_MINI_PICC :
-		case NET_NFC_MIFARE_1K_PICC :
-		case NET_NFC_MIFARE_4K_PICC :
-		case NET_NFC_MIFARE_ULTRA_PICC :
-		{
-			_net_nfc_client_util_alloc_mem(send_buffer, data->length + 2);
-			if (send_buffer == NULL)
-			{
-				return NET_NFC_ALLOC_FAIL;
-			}
+		return ret;
+	}
 
-			length = sizeof(net_nfc_request_transceive_t) + data->length + 2;
+	length = sizeof(net_nfc_request_transceive_t) + frame.length;
 
-			_net_nfc_client_util_alloc_mem(request, length);
-			if (request == NULL)
-			{
-				return NET_NFC_ALLOC_FAIL;
-			}
+	_net_nfc_client_util_alloc_mem(request, length);
+	if (request == NULL)
+	{
+		_net_nfc_client_util_free_mem(frame.buffer);
+		return NET_NFC_ALLOC_FAIL;
+	}
 
-			memcpy(send_buffer, data->buffer, data->length);
-			net_nfc_util_compute_CRC(CRC_A, send_buffer, data->length + 2);
+	memcpy(&request->info.trans_data.buffer, frame.buffer, frame.length);
+	request->info.trans_data.length = frame.length;
 
-			memcpy(&request->info.trans_data.buffer, send_buffer, data->length + 2);
+	_net_nfc_client_util_free_mem(frame.buffer);
 
-			request->info.trans_data.length = data->length + 2;
-		}
-		break;
+	/* fill request message */
+	request->length = length;
+	request->request_type = NET_NFC_MESSAGE_TRANSCEIVE;
+	request->handle = (net_nfc_target_handle_s *)handle;
+	request->trans_param = trans_param;
+	request->info.dev_type = (uint32_t)target_info->devType;
 
-		case NET_NFC_JEWEL_PICC :
-		{
-			if(data->length > 9)
-			{
-				return NET_NFC_INVALID_PARAM;
-			}
+	ret = _net_nfc_client_send_reqeust((net_nfc_request_msg_t *)request, NULL);
 
-			length = sizeof(net_nfc_request_transceive_t) + 9;
+	_net_nfc_client_util_free_mem(request);
 
-			_net_nfc_client_util_alloc_mem(request, length);
-			if (request == NULL)
-			{
-				return NET_NFC_ALLOC_FAIL;
-			}
+	return ret;
+}
+
+NET_NFC_EXPORT_API net_nfc_error_e net_nfc_transceive_sequence(net_nfc_target_handle_h handle, data_h *commands, data_h *prefixes, uint32_t count, bool stop_on_error, void* trans_param)
+{
+	net_nfc_error_e ret = NET_NFC_OK;
+	net_nfc_request_transceive_sequence_t *request = NULL;
+	client_context_t *client_context_tmp = NULL;
+	net_nfc_target_info_s *target_info = NULL;
+	data_s *frames = NULL;
+	uint32_t length = 0;
+	uint32_t data_length = 0;
+	uint32_t offset = 0;
+	uint32_t i;
+
+	if (handle == NULL || commands == NULL || count == 0)
+	{
+		return NET_NFC_NULL_PARAMETER;
+	}
+
+	if (count > NET_NFC_TRANSCEIVE_SEQUENCE_MAX_COUNT)
+	{
+		return NET_NFC_OUT_OF_BOUND;
+	}
+
+	if (!net_nfc_tag_is_connected())
+	{
+		return NET_NFC_OPERATION_FAIL;
+	}
+
+	client_context_tmp = net_nfc_get_client_context();
+	if (client_context_tmp == NULL || client_context_tmp->target_info == NULL)
+	{
+		return NET_NFC_NO_DATA_FOUND;
+	}
+
+	target_info = client_context_tmp->target_info;
 
-			_net_nfc_client_util_alloc_mem(send_buffer, 9);
+	_net_nfc_client_util_alloc_mem(frames, count * sizeof(data_s));
+	if (frames == NULL)
+	{
+		return NET_NFC_ALLOC_FAIL;
+	}
 
-			memcpy(send_buffer, data->buffer, data->length);
-			net_nfc_util_compute_CRC(CRC_B, send_buffer, 9);
+	for (i = 0; i < count && ret == NET_NFC_OK; i++)
+	{
+		data_s *command = (data_s *)commands[i];
+		data_s *prefix = (prefixes != NULL) ? (data_s *)prefixes[i] : NULL;
 
-			memcpy(&request->info.trans_data.buffer, send_buffer, 9);
+		if (command == NULL || command->buffer == NULL || command->length == 0
+			|| (prefix != NULL && prefix->buffer == NULL && prefix->length > 0))
+		{
+			ret = NET_NFC_NULL_PARAMETER;
+			break;
+		}
 
-			request->info.trans_data.length = 9;
+		/* commands are framed here like net_nfc_transceive, server sends them as is */
+		if ((ret = _net_nfc_make_transceive_frame(target_info->devType, command, &frames[i])) == NET_NFC_OK)
+		{
+			data_length += NET_NFC_TRANSCEIVE_SEQUENCE_COMMAND_LENGTH((prefix != NULL) ? prefix->length : 0, frames[i].length);
+		}
+	}
 
-			_net_nfc_client_util_free_mem(send_buffer);
+	if (ret == NET_NFC_OK)
+	{
+		/* all commands are carried in one message */
+		length = sizeof(net_nfc_request_transceive_sequence_t) + data_length;
+
+		_net_nfc_client_util_alloc_mem(request, length);
+		if (request == NULL)
+		{
+			ret = NET_NFC_ALLOC_FAIL;
 		}
-		break;
+	}
 
-		default :
+	if (ret == NET_NFC_OK)
+	{
+		request->length = length;
+		request->request_type = NET_NFC_MESSAGE_TRANSCEIVE_SEQUENCE;
+		request->handle = (net_nfc_target_handle_s *)handle;
+		request->trans_param = trans_param;
+		request->dev_type = (uint32_t)target_info->devType;
+		request->count = count;
+		request->stop_on_error = stop_on_error;
+
+		request->data.length = data_length;
+		for (i = 0; i < count && ret == NET_NFC_OK; i++)
 		{
-			length = sizeof(net_nfc_request_transceive_t) + data->length;
+			data_s empty = { NULL, 0 };
+			data_s *prefix = (prefixes != NULL && prefixes[i] != NULL) ? (data_s *)prefixes[i] : &empty;
 
-			_net_nfc_client_util_alloc_mem(request, length);
-			if (request == NULL)
+			if (net_nfc_util_append_transceive_sequence_command(request->data.buffer, data_length, &offset, prefix, &frames[i]) == false)
 			{
-				return NET_NFC_ALLOC_FAIL;
+				DEBUG_ERR_MSG("packing command [%d] is failed", i);
+				ret = NET_NFC_OPERATION_FAIL;
 			}
+		}
 
-			memcpy(&request->info.trans_data.buffer, data->buffer, data->length);
-
-			request->info.trans_data.length = data->length;
+		if (ret == NET_NFC_OK)
+		{
+			ret = _net_nfc_client_send_reqeust((net_nfc_request_msg_t *)request, NULL);
 		}
-		break;
-	}
 
-	/* fill request message */
-	request->length = length;
-	request->request_type = NET_NFC_MESSAGE_TRANSCEIVE;
-	request->handle = (net_nfc_target_handle_s *)handle;
-	request->trans_param = trans_param;
-	request->info.dev_type = (uint32_t)target_info->devType;
+		_net_nfc_client_util_free_mem(request);
+	}
 
-	ret = _net_nfc_client_send_reqeust((net_nfc_request_msg_t *)request, NULL);
+	for (i = 0; i < count; i++)
+	{
+		_net_nfc_client_util_free_mem(frames[i].buffer);
+	}
 
-	_net_nfc_client_util_free_mem(request);
+	_net_nfc_client_util_free_mem(frames);
 
 	return ret;
 }
@@ -23,6 +23,7 @@
 #include "net_nfc_client_nfc_private.h"
 #include "net_nfc_tag_felica.h"
 #include "net_nfc_target_info.h"
+#include "net_nfc_client_util_private.h"
 
 #include <string.h>
 
@@ -38,6 +39,11 @@
 #define FELICA_CMD_REQ_SYSTEM_CODE 0x0C
 #define FELICA_TAG_KEY	"IDm"
 
+#define FELICA_READ_MAX_SERVICES 16
+#define FELICA_READ_MAX_BLOCKS 15
+/* LEN | code | IDm | services | service list | blocks | block list (3 bytes element at most) */
+#define FELICA_READ_COMMAND_MAX_LENGTH (1 + 1 + 8 + 1 + (2 * FELICA_READ_MAX_SERVICES) + 1 + (3 * FELICA_READ_MAX_BLOCKS))
+
 NET_NFC_EXPORT_API net_nfc_error_e net_nfc_felica_poll (net_nfc_target_handle_h handle, net_nfc_felica_poll_request_code_e req_code, uint8_t time_slote, void* trans_param)
 {
 	if(handle == NULL)
@@ -312,6 +318,164 @@ NET_NFC_EXPORT_API net_nfc_error_e net_nfc_felica_read_without_encryption (net_n
 
 }
 
+/* packs blocks from the offset into one read without encryption command, returns the number of packed blocks */
+static uint32_t _net_nfc_felica_pack_read_command(data_s *IDm, uint16_t service_list[], uint8_t service_index[], uint16_t block_list[], uint32_t offset, uint32_t count, uint32_t max_blocks, data_s *command)
+{
+	uint8_t services[FELICA_READ_MAX_SERVICES];
+	uint8_t number_of_services = 0;
+	uint32_t blocks = 0;
+	uint8_t *buffer = command->buffer;
+	uint32_t i, j;
+
+	/* find services used by the blocks of this command */
+	for (i = offset; i < count && blocks < max_blocks; i++, blocks++)
+	{
+		uint8_t index = (service_index != NULL) ? service_index[i] : 0;
+
+		for (j = 0; j < number_of_services && services[j] != index; j++);
+
+		if (j == number_of_services)
+		{
+			if (number_of_services == FELICA_READ_MAX_SERVICES)
+				break;
+
+			services[number_of_services++] = index;
+		}
+	}
+
+	buffer[1] = FELICA_CMD_READ_WITHOUT_ENC;
+	memcpy(buffer + 2, IDm->buffer, IDm->length);
+	buffer += 2 + IDm->length;
+
+	*buffer++ = number_of_services;
+	for (j = 0; j < number_of_services; j++)
+	{
+		/* service code is little endian */
+		*buffer++ = service_list[services[j]] & 0xFF;
+		*buffer++ = (service_list[services[j]] >> 8) & 0xFF;
+	}
+
+	*buffer++ = blocks;
+	for (i = offset; i < offset + blocks; i++)
+	{
+		uint8_t index = (service_index != NULL) ? service_index[i] : 0;
+
+		for (j = 0; services[j] != index; j++);
+
+		/* 2 bytes block list element if block number fits in one byte */
+		if (block_list[i] <= 0xFF)
+		{
+			*buffer++ = 0x80 | j;
+			*buffer++ = block_list[i];
+		}
+		else
+		{
+			*buffer++ = j;
+			*buffer++ = block_list[i] & 0xFF;
+			*buffer++ = (block_list[i] >> 8) & 0xFF;
+		}
+	}
+
+	command->length = buffer - command->buffer;
+	command->buffer[0] = command->length;
+
+	return blocks;
+}
+
+NET_NFC_EXPORT_API net_nfc_error_e net_nfc_felica_read_blocks (net_nfc_target_handle_h handle, uint8_t number_of_services, uint16_t service_list[], uint16_t number_of_blocks, uint8_t service_index[], uint16_t block_list[], uint8_t max_blocks_per_command, void* trans_param)
+{
+	net_nfc_error_e result = NET_NFC_OK;
+	client_context_t* client_context_tmp = NULL;
+	net_nfc_target_info_s* target_info = NULL;
+	data_h IDm = NULL;
+	data_s *commands = NULL;
+	data_h *command_list = NULL;
+	uint32_t max_blocks = FELICA_READ_MAX_BLOCKS;
+	uint32_t number_of_commands = 0;
+	uint32_t offset = 0;
+	uint32_t i;
+
+	if(handle == NULL || service_list == NULL || block_list == NULL)
+		return NET_NFC_NULL_PARAMETER;
+
+	if(number_of_services == 0 || number_of_blocks == 0)
+		return NET_NFC_INVALID_PARAM;
+
+	for(i = 0; service_index != NULL && i < number_of_blocks; i++){
+		if(service_index[i] >= number_of_services)
+			return NET_NFC_INVALID_PARAM;
+	}
+
+	if(!net_nfc_tag_is_connected()){
+		return NET_NFC_OPERATION_FAIL;
+	}
+
+	client_context_tmp = net_nfc_get_client_context();
+
+	if((target_info = client_context_tmp->target_info) == NULL){
+		return NET_NFC_NO_DATA_FOUND;
+	}
+
+	if(target_info->devType != NET_NFC_FELICA_PICC){
+		DEBUG_CLIENT_MSG("only felica tag is available");
+		return NET_NFC_NOT_ALLOWED_OPERATION;
+	}
+
+	if(net_nfc_get_tag_info_value((net_nfc_target_info_h)target_info, FELICA_TAG_KEY, &IDm) != NET_NFC_OK){
+		return NET_NFC_NO_DATA_FOUND;
+	}
+
+	if(((data_s*)IDm)->length != 8){
+		return NET_NFC_OUT_OF_BOUND;
+	}
+
+	/* card may support less blocks in a command than FeliCa allows */
+	if(max_blocks_per_command > 0 && max_blocks_per_command < FELICA_READ_MAX_BLOCKS)
+		max_blocks = max_blocks_per_command;
+
+	/* every command is full except the last one, services never exceed blocks of a command */
+	if((number_of_blocks + max_blocks - 1) / max_blocks > NET_NFC_TRANSCEIVE_SEQUENCE_MAX_COUNT){
+		return NET_NFC_OUT_OF_BOUND;
+	}
+
+	_net_nfc_client_util_alloc_mem(commands, number_of_blocks * sizeof(data_s));
+	_net_nfc_client_util_alloc_mem(command_list, number_of_blocks * sizeof(data_h));
+	if(commands == NULL || command_list == NULL){
+		result = NET_NFC_ALLOC_FAIL;
+	}
+
+	while(result == NET_NFC_OK && offset < number_of_blocks){
+		data_s *command = &commands[number_of_commands];
+
+		_net_nfc_client_util_alloc_mem(command->buffer, FELICA_READ_COMMAND_MAX_LENGTH);
+		if(command->buffer == NULL){
+			result = NET_NFC_ALLOC_FAIL;
+			break;
+		}
+
+		offset += _net_nfc_felica_pack_read_command((data_s*)IDm, service_list, service_index, block_list, offset, number_of_blocks, max_blocks, command);
+
+		command_list[number_of_commands] = (data_h)command;
+		number_of_commands++;
+	}
+
+	DEBUG_CLIENT_MSG("felica read blocks [%d], commands [%d]", number_of_blocks, number_of_commands);
+
+	/* all commands are sent by daemon at once */
+	if(result == NET_NFC_OK){
+		result = net_nfc_transceive_sequence(handle, command_list, NULL, number_of_commands, true, trans_param);
+	}
+
+	for(i = 0; commands != NULL && i < number_of_commands; i++){
+		_net_nfc_client_util_free_mem(commands[i].buffer);
+	}
+
+	_net_nfc_client_util_free_mem(commands);
+	_net_nfc_client_util_free_mem(command_list);
+
+	return result;
+}
+
 
 NET_NFC_EXPORT_API net_nfc_error_e net_nfc_felica_write_without_encryption (net_nfc_target_handle_h handle, uint8_t number_of_services, uint16_t service_list[], uint8_t number_of_blocks, uint8_t block_list[], data_h data, void* trans_param)
 {
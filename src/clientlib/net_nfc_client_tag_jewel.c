@@ -203,6 +203,52 @@ NET_NFC_EXPORT_API net_nfc_error_e net_nfc_jewel_read_all (net_nfc_target_handle
 
 }
 
+NET_NFC_EXPORT_API net_nfc_error_e net_nfc_jewel_read_memory (net_nfc_target_handle_h handle, uint16_t offset, uint16_t length, void* trans_param)
+{
+	if(handle == NULL)
+		return NET_NFC_NULL_PARAMETER;
+
+	if(!net_nfc_tag_is_connected()){
+		return NET_NFC_OPERATION_FAIL;
+	}
+
+	client_context_t* client_context_tmp = net_nfc_get_client_context();
+	net_nfc_target_info_s* target_info = NULL;
+
+	if((target_info = client_context_tmp->target_info) == NULL){
+		return NET_NFC_NO_DATA_FOUND;
+	}
+
+	if(target_info->devType != NET_NFC_JEWEL_PICC){
+		DEBUG_CLIENT_MSG("only Jewel tag is available");
+		return NET_NFC_NOT_ALLOWED_OPERATION;
+	}
+
+	data_h UID = NULL;
+
+	if(net_nfc_get_tag_info_value((net_nfc_target_info_h)target_info, JEWEL_TAG_KEY, &UID) != NET_NFC_OK){
+		return NET_NFC_NO_DATA_FOUND;
+	}
+
+	if(((data_s*)UID)->length != NET_NFC_JEWEL_UID_LENGTH){
+
+		return NET_NFC_OUT_OF_BOUND;
+	}
+
+	/* memory image is read and kept by nfc daemon, so only the range is requested */
+	net_nfc_request_jewel_read_memory_t request = { 0, };
+
+	request.length = sizeof(net_nfc_request_jewel_read_memory_t);
+	request.request_type = NET_NFC_MESSAGE_JEWEL_READ_MEMORY;
+	request.handle = (net_nfc_target_handle_s *)handle;
+	request.trans_param = trans_param;
+	request.offset = offset;
+	request.read_length = length;
+	memcpy(request.uid, ((data_s*)UID)->buffer, NET_NFC_JEWEL_UID_LENGTH);
+
+	return _net_nfc_client_send_reqeust((net_nfc_request_msg_t *)&request, NULL);
+}
+
 NET_NFC_EXPORT_API net_nfc_error_e net_nfc_jewel_write_with_erase (net_nfc_target_handle_h handle, uint8_t block, uint8_t byte, uint8_t data, void* trans_param)
 {
 	if(handle == NULL)
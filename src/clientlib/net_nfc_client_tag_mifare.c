@@ -24,6 +24,7 @@
 #include "net_nfc_tag_mifare.h"
 #include "net_nfc_target_info.h"
 #include "net_nfc_util_private.h"
+#include "net_nfc_client_util_private.h"
 
 #include <string.h>
 
@@ -61,6 +62,110 @@ static uint8_t net_nfc_forum_key[6] = {0xD3, 0xF7, 0xD3, 0xF7, 0xD3, 0xF7};
 #define MIFARE_BLOCK_SIZE 16 	/* 1 block is 16 byte */
 #define MIFARE_PAGE_SIZE 4 	/* 1 page is 4 byte */
 
+#define MIFARE_MINI_BLOCKS (MIFARE_MINI_SECTORS * MIFARE_BLOCK_4)
+#define MIFARE_1K_BLOCKS (MIFARE_1K_SECTORS * MIFARE_BLOCK_4)
+#define MIFARE_4K_BLOCKS (32 * MIFARE_BLOCK_4 + 8 * MIFARE_BLOCK_16)
+
+static net_nfc_error_e _net_nfc_mifare_send_blocks_request(net_nfc_target_handle_h handle, uint32_t request_type, uint8_t addr, uint32_t count, net_nfc_mifare_key_type_e key_type, data_h auth_key, data_s *data, void* trans_param)
+{
+	net_nfc_error_e ret;
+	net_nfc_request_mifare_blocks_t *request = NULL;
+	client_context_t *client_context_tmp = NULL;
+	net_nfc_target_info_s *target_info = NULL;
+	data_s *key = (data_s *)auth_key;
+	data_h UID = NULL;
+	uint32_t blocks = 0;
+	uint32_t length = 0;
+
+	if (handle == NULL || auth_key == NULL)
+		return NET_NFC_NULL_PARAMETER;
+
+	if (key->length != NET_NFC_MIFARE_KEY_LENGTH)
+		return NET_NFC_OUT_OF_BOUND;
+
+	if (key_type != NET_NFC_MIFARE_KEY_A && key_type != NET_NFC_MIFARE_KEY_B)
+		return NET_NFC_INVALID_PARAM;
+
+	if (!net_nfc_tag_is_connected())
+		return NET_NFC_OPERATION_FAIL;
+
+	client_context_tmp = net_nfc_get_client_context();
+	if (client_context_tmp == NULL || client_context_tmp->target_info == NULL)
+		return NET_NFC_NOT_INITIALIZED;
+
+	target_info = client_context_tmp->target_info;
+
+	switch (target_info->devType)
+	{
+	case NET_NFC_MIFARE_MINI_PICC :
+		blocks = MIFARE_MINI_BLOCKS;
+		break;
+
+	case NET_NFC_MIFARE_1K_PICC :
+		blocks = MIFARE_1K_BLOCKS;
+		break;
+
+	case NET_NFC_MIFARE_4K_PICC :
+		blocks = MIFARE_4K_BLOCKS;
+		break;
+
+	default :
+		DEBUG_CLIENT_MSG("This is not MIFARE Classic TAG = [%d]", target_info->devType);
+		return NET_NFC_NOT_SUPPORTED;
+	}
+
+	if (count == 0)
+		return NET_NFC_INVALID_PARAM;
+
+	if (addr + count > blocks)
+		return NET_NFC_OUT_OF_BOUND;
+
+	if (net_nfc_get_tag_info_value((net_nfc_target_info_h)target_info, MIFARE_TAG_KEY, &UID) != NET_NFC_OK)
+		return NET_NFC_NO_DATA_FOUND;
+
+	if (((data_s *)UID)->length > NET_NFC_MIFARE_UID_MAX_LENGTH)
+	{
+		net_nfc_free_data(UID);
+		return NET_NFC_OUT_OF_BOUND;
+	}
+
+	/* all blocks are processed by server in one request */
+	length = sizeof(net_nfc_request_mifare_blocks_t) + ((data != NULL) ? data->length : 0);
+
+	_net_nfc_client_util_alloc_mem(request, length);
+	if (request == NULL)
+	{
+		net_nfc_free_data(UID);
+		return NET_NFC_ALLOC_FAIL;
+	}
+
+	request->length = length;
+	request->request_type = request_type;
+	request->handle = (net_nfc_target_handle_s *)handle;
+	request->trans_param = trans_param;
+	request->dev_type = (uint32_t)target_info->devType;
+	request->addr = addr;
+	request->count = count;
+	request->key_type = key_type;
+	memcpy(request->key, key->buffer, NET_NFC_MIFARE_KEY_LENGTH);
+	request->uid_length = ((data_s *)UID)->length;
+	memcpy(request->uid, ((data_s *)UID)->buffer, request->uid_length);
+
+	if (data != NULL)
+	{
+		request->data.length = data->length;
+		memcpy(&request->data.buffer, data->buffer, data->length);
+	}
+
+	net_nfc_free_data(UID);
+
+	ret = _net_nfc_client_send_reqeust((net_nfc_request_msg_t *)request, NULL);
+
+	_net_nfc_client_util_free_mem(request);
+
+	return ret;
+}
+
 NET_NFC_EXPORT_API net_nfc_error_e net_nfc_mifare_authenticate_with_keyA(net_nfc_target_handle_h handle,  uint8_t sector, data_h auth_key,void* trans_param)
 {
 	if(handle == NULL || auth_key == NULL)
@@ -832,6 +937,24 @@ NET_NFC_EXPORT_API net_nfc_error_e net_nfc_mifare_restore(net_nfc_target_handle_
 }
 
 
+NET_NFC_EXPORT_API net_nfc_error_e net_nfc_mifare_read_blocks(net_nfc_target_handle_h handle, uint8_t addr, uint32_t count, net_nfc_mifare_key_type_e key_type, data_h auth_key, void* trans_param)
+{
+	return _net_nfc_mifare_send_blocks_request(handle, NET_NFC_MESSAGE_MIFARE_READ_BLOCKS, addr, count, key_type, auth_key, NULL, trans_param);
+}
+
+NET_NFC_EXPORT_API net_nfc_error_e net_nfc_mifare_write_blocks(net_nfc_target_handle_h handle, uint8_t addr, data_h data, net_nfc_mifare_key_type_e key_type, data_h auth_key, void* trans_param)
+{
+	data_s *blocks = (data_s *)data;
+
+	if (data == NULL)
+		return NET_NFC_NULL_PARAMETER;
+
+	if (blocks->buffer == NULL || blocks->length == 0 || blocks->length % MIFARE_BLOCK_SIZE != 0)
+		return NET_NFC_INVALID_PARAM;
+
+	return _net_nfc_mifare_send_blocks_request(handle, NET_NFC_MESSAGE_MIFARE_WRITE_BLOCKS, addr, blocks->length / MIFARE_BLOCK_SIZE, key_type, auth_key, blocks, trans_param);
+}
+
 NET_NFC_EXPORT_API net_nfc_error_e net_nfc_mifare_create_default_key(data_h* key)
 {
 	if(key == NULL)
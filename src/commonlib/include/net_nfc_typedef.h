@@ -216,6 +216,25 @@ typedef enum
 
 	NET_NFC_MESSAGE_GET_FIRMWARE_VERSION,
 
+	NET_NFC_MESSAGE_SEND_APDU_SCRIPT_SE, /**< Type: Response Event, <br> This events is received after calling the "net_nfc_send_apdu_script"
+	 	 	 	 	 	 	 	 	 <br> each response apdu is delivered with NET_NFC_MESSAGE_SEND_APDU_SE before this event
+	 	 	 	 	 	 	 	 	 <br> data pointer contains the number of executed commands (Cast to uint32_t *)*/
+
+	NET_NFC_MESSAGE_GET_ATR_SE, /**< Type: Response Event, <br> This events is received after calling the "net_nfc_get_atr"
+	 	 	 	 	 	 	 	 	 <br> data pointer contains the answer to reset of secure element (Cast to data_h)*/
+
+	NET_NFC_MESSAGE_MIFARE_READ_BLOCKS, /**< Type: Response Event, <br> This events is received after calling the "net_nfc_mifare_read_blocks"
+	 	 	 	 	 	 	 	 	 <br> data pointer contains the blocks read before an error (Cast to data_h)*/
+	NET_NFC_MESSAGE_MIFARE_WRITE_BLOCKS, /**< Type: Response Event, <br> This events is received after calling the "net_nfc_mifare_write_blocks"
+	 	 	 	 	 	 	 	 	 <br> data pointer contains the number of written blocks (Cast to uint32_t *)*/
+
+	NET_NFC_MESSAGE_TRANSCEIVE_SEQUENCE, /**< Type: Response Event, <br> This events is received after calling the "net_nfc_transceive_sequence"
+	 	 	 	 	 	 	 	 	 <br> each response is delivered with NET_NFC_MESSAGE_TRANSCEIVE before this event
+	 	 	 	 	 	 	 	 	 <br> data pointer contains the number of executed commands (Cast to uint32_t *)*/
+
+	NET_NFC_MESSAGE_JEWEL_READ_MEMORY, /**< Type: Response Event, <br> This events is received after calling the "net_nfc_jewel_read_memory"
+	 	 	 	 	 	 	 	 	 <br> data pointer contains the bytes of memory image (Cast to data_h)*/
+
 } net_nfc_message_e;
 
 typedef enum
@@ -246,6 +265,15 @@ typedef enum
 
 } net_nfc_target_type_e;
 
+/**
+ Key types of MIFARE classic sector
+ */
+typedef enum
+{
+	NET_NFC_MIFARE_KEY_A = 0x00,
+	NET_NFC_MIFARE_KEY_B,
+} net_nfc_mifare_key_type_e;
+
 /**
  Card states for nfc tag
  */
@@ -350,6 +378,15 @@ typedef enum
 	NET_NFC_MESSAGE_LLCP_RECEIVE_FROM, /**< Type: Response Event,<br>  "net_nfc_receive_llcp_from" operation is completed (connectionless mode)*/
 	NET_NFC_MESSAGE_LLCP_DISCONNECT, /**< Type: Response Event,<br>  "net_nfc_disconnect_llcp" request is completed */
 	NET_NFC_MESSAGE_LLCP_ERROR, /**< Type: Notify Event,<br>  when the socket is disconnected or rejected, you may receive this event */
+	NET_NFC_MESSAGE_LLCP_STREAM_WRITE, /**< Type: Response Event,<br>  all bytes queued by "net_nfc_write_llcp_stream" are sent (stream mode)
+	 	 	 	 	 	 	 	 	 <br> data pointer contains the number of bytes sent since the previous event (Cast to uint32_t *)*/
+	NET_NFC_MESSAGE_LLCP_STREAM_READ, /**< Type: Response Event,<br>  "net_nfc_read_llcp_stream" is completed with the requested number of bytes (stream mode)
+	 	 	 	 	 	 	 	 	 <br> data pointer contains received data (Cast to data_h)*/
+	NET_NFC_MESSAGE_LLCP_SEND_TO_BATCH, /**< Type: Response Event,<br>  "net_nfc_send_to_llcp_batch" operation is completed (connectionless mode)
+	 	 	 	 	 	 	 	 	 <br> data pointer contains the number of sent datagrams (Cast to uint32_t *)*/
+	NET_NFC_MESSAGE_LLCP_RECEIVE_FROM_BATCH, /**< Type: Response Event,<br>  "net_nfc_receive_from_llcp_batch" operation is completed (connectionless mode)
+	 	 	 	 	 	 	 	 	 <br> each datagram is delivered with NET_NFC_MESSAGE_LLCP_RECEIVE_FROM before this event
+	 	 	 	 	 	 	 	 	 <br> data pointer contains the number of received datagrams (Cast to uint32_t *)*/
 
 } net_nfc_llcp_message_e;
 
@@ -371,6 +408,8 @@ typedef struct ndef_record_s *ndef_record_h;
 
 typedef struct ndef_message_s *ndef_message_h;
 
+typedef struct net_nfc_sign_key_s *net_nfc_sign_key_h;
+
 typedef struct net_nfc_target_info_s *net_nfc_target_info_h;
 
 typedef uint32_t net_nfc_traceive_cmd;
@@ -98,6 +98,7 @@ typedef struct _net_nfc_llcp_internal_socket_s
 	net_nfc_llcp_socket_cb cb;
 	bool close_requested;
 	void *register_param; /* void param that has been registered in callback register time */
+	void *stream; /* stream mode context, only used in client side */
 } net_nfc_llcp_internal_socket_s;
 
 /**
@@ -404,6 +405,16 @@ typedef struct _net_nfc_request_msg_t
 	/* DON'T MODIFY THIS CODE - END */
 } net_nfc_request_msg_t;
 
+typedef struct _net_nfc_request_service_cleaner_t
+{
+	/* DON'T MODIFY THIS CODE - BEGIN */
+	uint32_t length;
+	uint32_t request_type;
+	uint32_t user_param;
+	/* DON'T MODIFY THIS CODE - END */
+	int client_fd;
+} net_nfc_request_service_cleaner_t;
+
 typedef struct _net_nfc_request_change_client_state_t
 {
 	/* DON'T MODIFY THIS CODE - BEGIN */
@@ -441,6 +452,27 @@ typedef struct _net_nfc_request_transceive_t
 	} info;
 } net_nfc_request_transceive_t;
 
+/* commands of transceive sequence are packed as two llcp batch datagrams : expected response prefix | framed command
+ * responses are packed as : result (net_nfc_error_e) | length (uint32_t) | response */
+#define NET_NFC_TRANSCEIVE_SEQUENCE_MAX_COUNT	256
+#define NET_NFC_TRANSCEIVE_SEQUENCE_COMMAND_LENGTH(__prefix_length, __length) (NET_NFC_LLCP_BATCH_DATAGRAM_LENGTH(__prefix_length) + NET_NFC_LLCP_BATCH_DATAGRAM_LENGTH(__length))
+#define NET_NFC_TRANSCEIVE_SEQUENCE_RESPONSE_LENGTH(__length) (sizeof(net_nfc_error_e) + NET_NFC_LLCP_BATCH_DATAGRAM_LENGTH(__length))
+
+typedef struct _net_nfc_request_transceive_sequence_t
+{
+	/* DON'T MODIFY THIS CODE - BEGIN */
+	uint32_t length;
+	uint32_t request_type;
+	uint32_t user_param;
+	/* DON'T MODIFY THIS CODE - END */
+	net_nfc_target_handle_s *handle;
+	void *trans_param;
+	uint32_t dev_type;
+	uint32_t count;
+	bool stop_on_error;
+	net_nfc_data_s data;
+} net_nfc_request_transceive_sequence_t;
+
 typedef struct _net_nfc_request_target_t
 {
 	/* DON'T MODIFY THIS CODE - BEGIN */
@@ -781,6 +813,43 @@ typedef struct _net_nfc_request_receive_from_socket_t
 	void *trans_param;
 } net_nfc_request_receive_from_socket_t;
 
+/* datagrams of llcp batch message are packed as : length (uint32_t, host order) | data */
+#define NET_NFC_LLCP_BATCH_MAX_COUNT	64
+#define NET_NFC_LLCP_BATCH_DATAGRAM_LENGTH(__length) (sizeof(uint32_t) + (__length))
+
+typedef struct _net_nfc_request_send_to_batch_socket_t
+{
+	/* DON'T MODIFY THIS CODE - BEGIN */
+	uint32_t length;
+	uint32_t request_type;
+	uint32_t user_param;
+	/* DON'T MODIFY THIS CODE - END */
+	uint32_t result;
+	net_nfc_target_handle_s *handle;
+	net_nfc_llcp_socket_t client_socket;
+	net_nfc_llcp_socket_t oal_socket;
+	void *trans_param;
+	sap_t dsap;
+	uint32_t count;
+	net_nfc_data_s data;
+} net_nfc_request_send_to_batch_socket_t;
+
+typedef struct _net_nfc_request_receive_from_batch_socket_t
+{
+	/* DON'T MODIFY THIS CODE - BEGIN */
+	uint32_t length;
+	uint32_t request_type;
+	uint32_t user_param;
+	/* DON'T MODIFY THIS CODE - END */
+	uint32_t result;
+	net_nfc_target_handle_s *handle;
+	net_nfc_llcp_socket_t client_socket;
+	net_nfc_llcp_socket_t oal_socket;
+	size_t req_length;
+	uint32_t count;
+	void *trans_param;
+} net_nfc_request_receive_from_batch_socket_t;
+
 typedef struct _net_nfc_request_close_socket_t
 {
 	/* DON'T MODIFY THIS CODE - BEGIN */
@@ -864,6 +933,7 @@ typedef struct _net_nfc_request_open_internal_se_t
 	/* DON'T MODIFY THIS CODE - END */
 	uint8_t se_type;
 	void *trans_param;
+	int client_fd; /* filled by server */
 } net_nfc_request_open_internal_se_t;
 
 typedef struct _net_nfc_request_close_internal_se_t
@@ -875,6 +945,7 @@ typedef struct _net_nfc_request_close_internal_se_t
 	/* DON'T MODIFY THIS CODE - END */
 	net_nfc_target_handle_s *handle;
 	void *trans_param;
+	int client_fd; /* filled by server */
 } net_nfc_request_close_internal_se_t;
 
 typedef struct _net_nfc_request_send_apdu_t
@@ -886,9 +957,81 @@ typedef struct _net_nfc_request_send_apdu_t
 	/* DON'T MODIFY THIS CODE - END */
 	net_nfc_target_handle_s *handle;
 	void *trans_param;
+	int client_fd; /* filled by server */
 	net_nfc_data_s data;
 } net_nfc_request_send_apdu_t;
 
+/* commands of apdu script are packed as : expected sw (uint16_t) | sw mask (uint16_t) | length (uint32_t) | c-apdu
+ * responses are packed like llcp batch datagrams : length (uint32_t) | r-apdu */
+#define NET_NFC_APDU_SCRIPT_MAX_COUNT	512
+#define NET_NFC_APDU_SCRIPT_COMMAND_LENGTH(__length) (sizeof(uint16_t) * 2 + sizeof(uint32_t) + (__length))
+#define NET_NFC_APDU_SCRIPT_RESPONSE_LENGTH(__length) NET_NFC_LLCP_BATCH_DATAGRAM_LENGTH(__length)
+
+typedef struct _net_nfc_request_send_apdu_script_t
+{
+	/* DON'T MODIFY THIS CODE - BEGIN */
+	uint32_t length;
+	uint32_t request_type;
+	uint32_t user_param;
+	/* DON'T MODIFY THIS CODE - END */
+	net_nfc_target_handle_s *handle;
+	void *trans_param;
+	int client_fd; /* filled by server */
+	uint32_t count;
+	net_nfc_data_s data;
+} net_nfc_request_send_apdu_script_t;
+
+typedef struct _net_nfc_request_get_atr_t
+{
+	/* DON'T MODIFY THIS CODE - BEGIN */
+	uint32_t length;
+	uint32_t request_type;
+	uint32_t user_param;
+	/* DON'T MODIFY THIS CODE - END */
+	net_nfc_target_handle_s *handle;
+	void *trans_param;
+	int client_fd; /* filled by server */
+} net_nfc_request_get_atr_t;
+
+#define NET_NFC_MIFARE_KEY_LENGTH	6
+#define NET_NFC_MIFARE_UID_MAX_LENGTH	10
+#define NET_NFC_MIFARE_BLOCK_LENGTH	16
+
+typedef struct _net_nfc_request_mifare_blocks_t
+{
+	/* DON'T MODIFY THIS CODE - BEGIN */
+	uint32_t length;
+	uint32_t request_type;
+	uint32_t user_param;
+	/* DON'T MODIFY THIS CODE - END */
+	net_nfc_target_handle_s *handle;
+	void *trans_param;
+	uint32_t dev_type;
+	uint32_t addr;
+	uint32_t count;
+	uint32_t key_type;
+	uint8_t key[NET_NFC_MIFARE_KEY_LENGTH];
+	uint32_t uid_length;
+	uint8_t uid[NET_NFC_MIFARE_UID_MAX_LENGTH];
+	net_nfc_data_s data; /* blocks to write */
+} net_nfc_request_mifare_blocks_t;
+
+#define NET_NFC_JEWEL_UID_LENGTH	4
+
+typedef struct _net_nfc_request_jewel_read_memory_t
+{
+	/* DON'T MODIFY THIS CODE - BEGIN */
+	uint32_t length;
+	uint32_t request_type;
+	uint32_t user_param;
+	/* DON'T MODIFY THIS CODE - END */
+	net_nfc_target_handle_s *handle;
+	void *trans_param;
+	uint32_t offset;
+	uint32_t read_length; /* 0 means to the end of memory */
+	uint8_t uid[NET_NFC_JEWEL_UID_LENGTH];
+} net_nfc_request_jewel_read_memory_t;
+
 typedef struct _net_nfc_request_connection_handover_t
 {
 	/* DON'T MODIFY THIS CODE - BEGIN */
@@ -947,6 +1090,18 @@ typedef struct _net_nfc_response_se_event_t
 	net_nfc_error_e result;
 } net_nfc_response_se_event_t;
 
+/* events of se event batch are packed as : type (uint32_t) | aid length (uint32_t) | aid | param length (uint32_t) | param */
+#define NET_NFC_SE_EVENT_BATCH_MAX_COUNT	32
+#define NET_NFC_SE_EVENT_BATCH_LENGTH(__aid_length, __param_length) (sizeof(uint32_t) + NET_NFC_LLCP_BATCH_DATAGRAM_LENGTH(__aid_length) + NET_NFC_LLCP_BATCH_DATAGRAM_LENGTH(__param_length))
+
+typedef struct _net_nfc_response_se_event_batch_t
+{
+	net_nfc_error_e result;
+	uint32_t count;
+	uint32_t dropped; /* events dropped by server since previous batch */
+	data_s data;
+} net_nfc_response_se_event_batch_t;
+
 typedef struct _net_nfc_response_get_current_tag_info_t
 {
 	net_nfc_target_handle_s *handle;
@@ -1103,6 +1258,23 @@ typedef struct _net_nfc_response_receive_llcp_t
 	void *trans_param;
 } net_nfc_response_receive_socket_t;
 
+typedef struct _net_nfc_response_send_to_batch_llcp_t
+{
+	net_nfc_error_e result;
+	net_nfc_llcp_socket_t client_socket;
+	uint32_t count; /* number of sent datagrams */
+	void *trans_param;
+} net_nfc_response_send_to_batch_socket_t;
+
+typedef struct _net_nfc_response_receive_from_batch_llcp_t
+{
+	net_nfc_error_e result;
+	net_nfc_llcp_socket_t client_socket;
+	uint32_t count; /* number of datagrams packed in data */
+	data_s data;
+	void *trans_param;
+} net_nfc_response_receive_from_batch_socket_t;
+
 typedef struct _net_nfc_response_p2p_receive_t
 {
 	net_nfc_error_e result;
@@ -1165,6 +1337,44 @@ typedef struct _net_nfc_response_send_apdu_t
 	void *trans_param;
 } net_nfc_response_send_apdu_t;
 
+typedef struct _net_nfc_response_send_apdu_script_t
+{
+	net_nfc_error_e result;
+	uint32_t count;
+	data_s data;
+	void *trans_param;
+} net_nfc_response_send_apdu_script_t;
+
+typedef struct _net_nfc_response_transceive_sequence_t
+{
+	net_nfc_error_e result;
+	uint32_t count;
+	data_s data;
+	void *trans_param;
+} net_nfc_response_transceive_sequence_t;
+
+typedef struct _net_nfc_response_get_atr_t
+{
+	net_nfc_error_e result;
+	data_s data;
+	void *trans_param;
+} net_nfc_response_get_atr_t;
+
+typedef struct _net_nfc_response_mifare_blocks_t
+{
+	net_nfc_error_e result;
+	uint32_t count; /* number of processed blocks */
+	data_s data; /* blocks read */
+	void *trans_param;
+} net_nfc_response_mifare_blocks_t;
+
+typedef struct _net_nfc_response_jewel_read_memory_t
+{
+	net_nfc_error_e result;
+	data_s data;
+	void *trans_param;
+} net_nfc_response_jewel_read_memory_t;
+
 typedef struct _net_nfc_response_get_server_state_t
 {
 	net_nfc_error_e result;
@@ -1290,6 +1500,8 @@ typedef enum _net_nfc_message_service_e
 	NET_NFC_MESSAGE_SERVICE_WATCH_DOG,
 	NET_NFC_MESSAGE_SERVICE_CLEANER,
 	NET_NFC_MESSAGE_SERVICE_SET_LAUNCH_STATE,
+	NET_NFC_MESSAGE_SERVICE_SE_EVENT_FLUSH, /* queued se events are delivered by dispatcher */
+	NET_NFC_MESSAGE_SERVICE_SE_EVENT_BATCH, /* queued se events are sent to client in one message */
 } net_nfc_message_service_e;
 
 typedef enum _net_nfc_se_command_e
@@ -1316,14 +1528,36 @@ typedef struct _net_nfc_carrier_property_s
 	bool is_group;
 	uint16_t attribute;
 	uint16_t length;
-	void *data;
+	void *data; /* value, or net_nfc_carrier_property_array_s of group */
 } net_nfc_carrier_property_s;
 
+#define NET_NFC_CARRIER_PROPERTY_DEFAULT_CAPACITY 8
+#define NET_NFC_CARRIER_PROPERTY_DEFAULT_VALUES 128
+
+/* values are packed in chunks, a full chunk is never moved so value pointers stay valid */
+typedef struct _net_nfc_carrier_value_chunk_s
+{
+	struct _net_nfc_carrier_value_chunk_s *next;
+	uint8_t *buffer; /* placed right after chunk in same allocation */
+	int length;
+	int capacity;
+} net_nfc_carrier_value_chunk_s;
+
+/* properties in insertion order, with item indexes sorted by attribute */
+typedef struct _net_nfc_carrier_property_array_s
+{
+	net_nfc_carrier_property_s *items;
+	uint16_t *sorted; /* placed right after items in same allocation */
+	int count;
+	int capacity;
+	net_nfc_carrier_value_chunk_s *values; /* newest chunk first */
+} net_nfc_carrier_property_array_s;
+
 typedef struct _net_nfc_carrier_config_s
 {
 	net_nfc_conn_handover_carrier_type_e type;
 	int length;
-	struct _GList *data;
+	net_nfc_carrier_property_array_s data;
 } net_nfc_carrier_config_s;
 
 typedef struct _net_nfc_sub_field_s
@@ -1351,6 +1585,9 @@ typedef struct _net_nfc_certificate_chain_s
 }
 __attribute__((packed)) net_nfc_certificate_chain_s;
 
+/* key for signing records, defined in net_nfc_util_openssl_private.h */
+typedef struct _net_nfc_sign_key_s net_nfc_sign_key_s;
+
 #define SMART_POSTER_RECORD_TYPE "Sp"
 #define URI_RECORD_TYPE "U"
 #define TEXT_RECORD_TYPE "T"
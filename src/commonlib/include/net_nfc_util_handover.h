@@ -25,6 +25,47 @@ extern "C"
 {
 #endif
 
+#define NET_NFC_CARRIER_BACKEND_MAX 8
+
+/* carrier backend converts carrier config from/to payload of carrier configuration record */
+typedef net_nfc_error_e (*net_nfc_carrier_serialize_cb)(net_nfc_carrier_config_s *config, data_s *payload); /* payload buffer is allocated by backend */
+typedef net_nfc_error_e (*net_nfc_carrier_parse_cb)(net_nfc_carrier_config_s *config, uint8_t *data, uint32_t length);
+typedef bool (*net_nfc_carrier_ready_cb)(void);
+
+typedef struct _net_nfc_carrier_backend_s
+{
+	net_nfc_conn_handover_carrier_type_e type;
+	const char *mime_type; /* record type of carrier configuration record */
+	int priority; /* lower value is preferred */
+	net_nfc_carrier_serialize_cb serialize;
+	net_nfc_carrier_parse_cb parse;
+	net_nfc_carrier_ready_cb is_ready; /* NULL means always ready */
+} net_nfc_carrier_backend_s;
+
+/**
+ register carrier backend. backend of same type is replaced, bluetooth and wifi backends are registered by default.
+ */
+net_nfc_error_e net_nfc_util_register_carrier_backend(net_nfc_carrier_backend_s *backend);
+
+net_nfc_error_e net_nfc_util_unregister_carrier_backend(net_nfc_conn_handover_carrier_type_e type);
+
+/**
+ register stand-in backend which needs no carrier stack, attributes are serialized as attribute(2) length(2) value list.
+ it is for test and benchmark of handover without bluetooth or wifi.
+ */
+net_nfc_error_e net_nfc_util_register_local_carrier_backend(net_nfc_conn_handover_carrier_type_e type, const char *mime_type, int priority);
+
+net_nfc_error_e net_nfc_util_get_carrier_backend(net_nfc_conn_handover_carrier_type_e type, net_nfc_carrier_backend_s *backend);
+
+net_nfc_error_e net_nfc_util_get_carrier_backend_by_mime_type(data_s *mime_type, net_nfc_carrier_backend_s *backend);
+
+bool net_nfc_util_is_carrier_ready(net_nfc_conn_handover_carrier_type_e type);
+
+/**
+ get ready carrier types in priority order. count is size of types as input, number of types as output.
+ */
+net_nfc_error_e net_nfc_util_get_carrier_priority_order(net_nfc_conn_handover_carrier_type_e *types, int *count);
+
 net_nfc_error_e net_nfc_util_create_carrier_config(net_nfc_carrier_config_s **config, net_nfc_conn_handover_carrier_type_e type);
 
 net_nfc_error_e net_nfc_util_add_carrier_config_property(net_nfc_carrier_config_s *config, uint16_t attribute, uint16_t size, uint8_t *data);
@@ -83,8 +124,12 @@ net_nfc_error_e net_nfc_util_get_alternative_carrier_type_from_record(ndef_recor
  */
 net_nfc_error_e net_nfc_util_get_alternative_carrier_type(ndef_message_s *message, int index, net_nfc_conn_handover_carrier_type_e *power_state);
 
+net_nfc_error_e net_nfc_util_create_handover_random_number(unsigned short *random_number);
+
 net_nfc_error_e net_nfc_util_create_handover_request_message(ndef_message_s **message);
 
+net_nfc_error_e net_nfc_util_create_handover_request_message_with_random_number(ndef_message_s **message, unsigned short random_number);
+
 net_nfc_error_e net_nfc_util_create_handover_select_message(ndef_message_s **message);
 
 net_nfc_error_e net_nfc_util_create_handover_error_record(ndef_record_s **record, uint8_t reason, uint32_t data);
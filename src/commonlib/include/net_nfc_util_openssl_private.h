@@ -18,8 +18,13 @@
 #ifndef NET_NFC_UTIL_OPENSSL_PRIVATE_H_
 #define NET_NFC_UTIL_OPENSSL_PRIVATE_H_
 
+#include <pthread.h>
+
+#include <openssl/evp.h>
 #include <openssl/x509.h>
 
+#include "net_nfc_typedef_private.h"
+
 enum
 {
 	OPENSSL_FORMAT_UNDEF,
@@ -37,25 +42,60 @@ enum
 	OPENSSL_FORMAT_PVK,
 };
 
+/* raw certificates are kept until verifying, so the chain is decoded only when it is not in the verified chain cache */
 typedef struct _net_nfc_openssl_verify_context_s
 {
-	X509 *signer_cert;
-	X509_STORE *store;
-	X509_STORE_CTX *store_ctx;
+	uint8_t *signer_buffer;
+	uint32_t signer_length;
+	uint8_t *ca_buffer;
+	uint32_t ca_length;
+	uint32_t ca_count;
 }
 net_nfc_openssl_verify_context_s;
 
 typedef net_nfc_openssl_verify_context_s *net_nfc_openssl_verify_context_h;
 
+/* signed data is fed in pieces, so it needs not to be gathered in one buffer */
+typedef struct _net_nfc_openssl_signature_context_s
+{
+	EVP_MD_CTX *md_ctx;
+	EVP_PKEY *pkey;
+	bool verify;
+}
+net_nfc_openssl_signature_context_s;
+
+typedef net_nfc_openssl_signature_context_s *net_nfc_openssl_signature_context_h;
+
+/* private key and certificate chain loaded from PKCS #12 file, it can be shared by threads */
+struct _net_nfc_sign_key_s
+{
+	pthread_mutex_t lock;
+	EVP_PKEY *pkey;
+	uint8_t *cert_buffer;
+	uint32_t cert_len;
+	uint32_t cert_count;
+};
+
 net_nfc_openssl_verify_context_h net_nfc_util_openssl_init_verify_certificate(void);
 bool net_nfc_util_openssl_add_certificate_of_signer(net_nfc_openssl_verify_context_h context, uint8_t *buffer, uint32_t length);
 bool net_nfc_util_openssl_add_certificate_of_ca(net_nfc_openssl_verify_context_h context, uint8_t *buffer, uint32_t length);
 int net_nfc_util_openssl_verify_certificate(net_nfc_openssl_verify_context_h context);
 void net_nfc_util_openssl_release_verify_certificate(net_nfc_openssl_verify_context_h context);
 
+net_nfc_openssl_signature_context_h net_nfc_util_openssl_init_sign(uint32_t type, char *key_file, char *password);
+net_nfc_openssl_signature_context_h net_nfc_util_openssl_init_sign_with_key(uint32_t type, net_nfc_sign_key_s *key);
+net_nfc_openssl_signature_context_h net_nfc_util_openssl_init_verify_signature(uint32_t type, uint8_t *cert, uint32_t cert_len);
+bool net_nfc_util_openssl_update_signature(net_nfc_openssl_signature_context_h context, uint8_t *buffer, uint32_t length);
+int net_nfc_util_openssl_sign_final(net_nfc_openssl_signature_context_h context, uint8_t *sign, uint32_t *sign_len);
+int net_nfc_util_openssl_verify_final(net_nfc_openssl_signature_context_h context, uint8_t *sign, uint32_t sign_len);
+void net_nfc_util_openssl_release_signature(net_nfc_openssl_signature_context_h context);
+
 int net_nfc_util_openssl_sign_buffer(uint32_t type, uint8_t *buffer, uint32_t length, char *key_file, char *password, uint8_t *sign, uint32_t *sign_len);
 int net_nfc_util_openssl_verify_signature(uint32_t type, uint8_t *buffer, uint32_t length, uint8_t *cert, uint32_t cert_len, uint8_t *sign, uint32_t sign_len);
 int net_nfc_util_get_cert_list_from_file(char *file_name, char *password, uint8_t **buffer, uint32_t *length, uint32_t *cert_count);
 
+net_nfc_sign_key_s *net_nfc_util_openssl_load_sign_key(char *key_file, char *password);
+void net_nfc_util_openssl_release_sign_key(net_nfc_sign_key_s *key);
+
 
 #endif /* NET_NFC_UTIL_OPENSSL_PRIVATE_H_ */
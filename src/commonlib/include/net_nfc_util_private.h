@@ -63,6 +63,24 @@ bool net_nfc_util_alloc_data(data_s *data, uint32_t length);
 bool net_nfc_util_duplicate_data(data_s *dest, net_nfc_data_s *src);
 void net_nfc_util_free_data(data_s *data);
 
+/* llcp batch message utils, datagram returned by get function points inside of buffer */
+bool net_nfc_util_append_llcp_batch_datagram(uint8_t *buffer, uint32_t buffer_length, uint32_t *offset, uint8_t *data, uint32_t length);
+bool net_nfc_util_get_llcp_batch_datagram(uint8_t *buffer, uint32_t buffer_length, uint32_t *offset, data_s *datagram);
+
+/* apdu script utils, apdu returned by get function points inside of buffer */
+bool net_nfc_util_append_apdu_script_command(uint8_t *buffer, uint32_t buffer_length, uint32_t *offset, uint16_t expected_sw, uint16_t sw_mask, uint8_t *apdu, uint32_t length);
+bool net_nfc_util_get_apdu_script_command(uint8_t *buffer, uint32_t buffer_length, uint32_t *offset, uint16_t *expected_sw, uint16_t *sw_mask, data_s *apdu);
+
+/* transceive sequence utils, data returned by get function points inside of buffer */
+bool net_nfc_util_append_transceive_sequence_command(uint8_t *buffer, uint32_t buffer_length, uint32_t *offset, data_s *prefix, data_s *command);
+bool net_nfc_util_get_transceive_sequence_command(uint8_t *buffer, uint32_t buffer_length, uint32_t *offset, data_s *prefix, data_s *command);
+bool net_nfc_util_append_transceive_sequence_response(uint8_t *buffer, uint32_t buffer_length, uint32_t *offset, net_nfc_error_e result, uint8_t *data, uint32_t length);
+bool net_nfc_util_get_transceive_sequence_response(uint8_t *buffer, uint32_t buffer_length, uint32_t *offset, net_nfc_error_e *result, data_s *response);
+
+/* se event batch utils, aid and param returned by get function point inside of buffer */
+bool net_nfc_util_append_se_batch_event(uint8_t *buffer, uint32_t buffer_length, uint32_t *offset, uint32_t type, data_s *aid, data_s *param);
+bool net_nfc_util_get_se_batch_event(uint8_t *buffer, uint32_t buffer_length, uint32_t *offset, uint32_t *type, data_s *aid, data_s *param);
+
 void net_nfc_util_mem_free_detail_msg(int msg_type, int message, void *data);
 
 net_nfc_conn_handover_carrier_state_e net_nfc_util_get_cps(net_nfc_conn_handover_carrier_type_e carrier_type);
@@ -25,6 +25,14 @@
 net_nfc_error_e net_nfc_util_sign_records(ndef_message_s *msg, int begin_index, int end_index, char *cert_file, char *password);
 net_nfc_error_e net_nfc_util_sign_ndef_message(ndef_message_s *msg, char *cert_file, char *password);
 
+/*
+ * sign with key loaded once, for signing many messages
+ */
+net_nfc_error_e net_nfc_util_create_sign_key(net_nfc_sign_key_s **key, char *cert_file, char *password);
+net_nfc_error_e net_nfc_util_free_sign_key(net_nfc_sign_key_s *key);
+net_nfc_error_e net_nfc_util_sign_records_with_key(ndef_message_s *msg, int begin_index, int end_index, net_nfc_sign_key_s *key);
+net_nfc_error_e net_nfc_util_sign_ndef_message_with_key(ndef_message_s *msg, net_nfc_sign_key_s *key);
+
 /*
  * check validity of ndef record and ndef message
  */
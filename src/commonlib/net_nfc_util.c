@@ -146,6 +146,211 @@ NET_NFC_EXPORT_API void net_nfc_util_free_data(data_s *data)
 	_net_nfc_util_free_mem(data->buffer);
 }
 
+NET_NFC_EXPORT_API bool net_nfc_util_append_llcp_batch_datagram(uint8_t *buffer, uint32_t buffer_length, uint32_t *offset, uint8_t *data, uint32_t length)
+{
+	if (buffer == NULL || offset == NULL || (data == NULL && length > 0))
+		return false;
+
+	if (*offset > buffer_length || NET_NFC_LLCP_BATCH_DATAGRAM_LENGTH(length) > buffer_length - *offset)
+		return false;
+
+	memcpy(buffer + *offset, &length, sizeof(uint32_t));
+	*offset += sizeof(uint32_t);
+
+	if (length > 0)
+	{
+		memcpy(buffer + *offset, data, length);
+		*offset += length;
+	}
+
+	return true;
+}
+
+NET_NFC_EXPORT_API bool net_nfc_util_get_llcp_batch_datagram(uint8_t *buffer, uint32_t buffer_length, uint32_t *offset, data_s *datagram)
+{
+	uint32_t length = 0;
+
+	if (buffer == NULL || offset == NULL || datagram == NULL)
+		return false;
+
+	if (*offset > buffer_length || sizeof(uint32_t) > buffer_length - *offset)
+		return false;
+
+	memcpy(&length, buffer + *offset, sizeof(uint32_t));
+
+	if (length > buffer_length - *offset - sizeof(uint32_t))
+		return false;
+
+	*offset += sizeof(uint32_t);
+
+	datagram->buffer = (length > 0) ? buffer + *offset : NULL;
+	datagram->length = length;
+
+	*offset += length;
+
+	return true;
+}
+
+NET_NFC_EXPORT_API bool net_nfc_util_append_apdu_script_command(uint8_t *buffer, uint32_t buffer_length, uint32_t *offset, uint16_t expected_sw, uint16_t sw_mask, uint8_t *apdu, uint32_t length)
+{
+	if (buffer == NULL || offset == NULL || apdu == NULL || length == 0)
+		return false;
+
+	if (*offset > buffer_length || NET_NFC_APDU_SCRIPT_COMMAND_LENGTH(length) > buffer_length - *offset)
+		return false;
+
+	memcpy(buffer + *offset, &expected_sw, sizeof(uint16_t));
+	*offset += sizeof(uint16_t);
+
+	memcpy(buffer + *offset, &sw_mask, sizeof(uint16_t));
+	*offset += sizeof(uint16_t);
+
+	memcpy(buffer + *offset, &length, sizeof(uint32_t));
+	*offset += sizeof(uint32_t);
+
+	memcpy(buffer + *offset, apdu, length);
+	*offset += length;
+
+	return true;
+}
+
+NET_NFC_EXPORT_API bool net_nfc_util_get_apdu_script_command(uint8_t *buffer, uint32_t buffer_length, uint32_t *offset, uint16_t *expected_sw, uint16_t *sw_mask, data_s *apdu)
+{
+	uint32_t length = 0;
+
+	if (buffer == NULL || offset == NULL || expected_sw == NULL || sw_mask == NULL || apdu == NULL)
+		return false;
+
+	if (*offset > buffer_length || NET_NFC_APDU_SCRIPT_COMMAND_LENGTH(0) > buffer_length - *offset)
+		return false;
+
+	memcpy(&length, buffer + *offset + sizeof(uint16_t) * 2, sizeof(uint32_t));
+
+	if (length == 0 || length > buffer_length - *offset - NET_NFC_APDU_SCRIPT_COMMAND_LENGTH(0))
+		return false;
+
+	memcpy(expected_sw, buffer + *offset, sizeof(uint16_t));
+	memcpy(sw_mask, buffer + *offset + sizeof(uint16_t), sizeof(uint16_t));
+	*offset += NET_NFC_APDU_SCRIPT_COMMAND_LENGTH(0);
+
+	apdu->buffer = buffer + *offset;
+	apdu->length = length;
+
+	*offset += length;
+
+	return true;
+}
+
+NET_NFC_EXPORT_API bool net_nfc_util_append_transceive_sequence_command(uint8_t *buffer, uint32_t buffer_length, uint32_t *offset, data_s *prefix, data_s *command)
+{
+	if (buffer == NULL || offset == NULL || prefix == NULL || command == NULL || command->buffer == NULL || command->length == 0)
+		return false;
+
+	if (prefix->buffer == NULL && prefix->length > 0)
+		return false;
+
+	if (*offset > buffer_length || NET_NFC_TRANSCEIVE_SEQUENCE_COMMAND_LENGTH(prefix->length, command->length) > buffer_length - *offset)
+		return false;
+
+	net_nfc_util_append_llcp_batch_datagram(buffer, buffer_length, offset, prefix->buffer, prefix->length);
+	net_nfc_util_append_llcp_batch_datagram(buffer, buffer_length, offset, command->buffer, command->length);
+
+	return true;
+}
+
+NET_NFC_EXPORT_API bool net_nfc_util_get_transceive_sequence_command(uint8_t *buffer, uint32_t buffer_length, uint32_t *offset, data_s *prefix, data_s *command)
+{
+	uint32_t temp;
+
+	if (offset == NULL)
+		return false;
+
+	temp = *offset;
+
+	if (net_nfc_util_get_llcp_batch_datagram(buffer, buffer_length, &temp, prefix) == false ||
+		net_nfc_util_get_llcp_batch_datagram(buffer, buffer_length, &temp, command) == false ||
+		command->length == 0)
+		return false;
+
+	*offset = temp;
+
+	return true;
+}
+
+NET_NFC_EXPORT_API bool net_nfc_util_append_transceive_sequence_response(uint8_t *buffer, uint32_t buffer_length, uint32_t *offset, net_nfc_error_e result, uint8_t *data, uint32_t length)
+{
+	if (buffer == NULL || offset == NULL)
+		return false;
+
+	if (*offset > buffer_length || NET_NFC_TRANSCEIVE_SEQUENCE_RESPONSE_LENGTH(length) > buffer_length - *offset)
+		return false;
+
+	memcpy(buffer + *offset, &result, sizeof(net_nfc_error_e));
+	*offset += sizeof(net_nfc_error_e);
+
+	return net_nfc_util_append_llcp_batch_datagram(buffer, buffer_length, offset, data, length);
+}
+
+NET_NFC_EXPORT_API bool net_nfc_util_get_transceive_sequence_response(uint8_t *buffer, uint32_t buffer_length, uint32_t *offset, net_nfc_error_e *result, data_s *response)
+{
+	uint32_t temp;
+
+	if (buffer == NULL || offset == NULL || result == NULL)
+		return false;
+
+	if (*offset > buffer_length || sizeof(net_nfc_error_e) > buffer_length - *offset)
+		return false;
+
+	temp = *offset + sizeof(net_nfc_error_e);
+
+	if (net_nfc_util_get_llcp_batch_datagram(buffer, buffer_length, &temp, response) == false)
+		return false;
+
+	memcpy(result, buffer + *offset, sizeof(net_nfc_error_e));
+	*offset = temp;
+
+	return true;
+}
+
+NET_NFC_EXPORT_API bool net_nfc_util_append_se_batch_event(uint8_t *buffer, uint32_t buffer_length, uint32_t *offset, uint32_t type, data_s *aid, data_s *param)
+{
+	if (buffer == NULL || offset == NULL || aid == NULL || param == NULL)
+		return false;
+
+	if (*offset > buffer_length || NET_NFC_SE_EVENT_BATCH_LENGTH(aid->length, param->length) > buffer_length - *offset)
+		return false;
+
+	memcpy(buffer + *offset, &type, sizeof(uint32_t));
+	*offset += sizeof(uint32_t);
+
+	net_nfc_util_append_llcp_batch_datagram(buffer, buffer_length, offset, aid->buffer, aid->length);
+	net_nfc_util_append_llcp_batch_datagram(buffer, buffer_length, offset, param->buffer, param->length);
+
+	return true;
+}
+
+NET_NFC_EXPORT_API bool net_nfc_util_get_se_batch_event(uint8_t *buffer, uint32_t buffer_length, uint32_t *offset, uint32_t *type, data_s *aid, data_s *param)
+{
+	uint32_t temp;
+
+	if (buffer == NULL || offset == NULL || type == NULL || aid == NULL || param == NULL)
+		return false;
+
+	if (*offset > buffer_length || sizeof(uint32_t) > buffer_length - *offset)
+		return false;
+
+	temp = *offset + sizeof(uint32_t);
+
+	if (net_nfc_util_get_llcp_batch_datagram(buffer, buffer_length, &temp, aid) == false ||
+		net_nfc_util_get_llcp_batch_datagram(buffer, buffer_length, &temp, param) == false)
+		return false;
+
+	memcpy(type, buffer + *offset, sizeof(uint32_t));
+	*offset = temp;
+
+	return true;
+}
+
 NET_NFC_EXPORT_API void net_nfc_util_mem_free_detail_msg(int msg_type, int message, void *data)
 {
 	if (data == NULL)
@@ -186,6 +391,13 @@ NET_NFC_EXPORT_API void net_nfc_util_mem_free_detail_msg(int msg_type, int messa
 			}
 			break;
 
+		case NET_NFC_MESSAGE_LLCP_RECEIVE_FROM_BATCH :
+			{
+				net_nfc_response_receive_from_batch_socket_t *msg = (net_nfc_response_receive_from_batch_socket_t *)data;
+				_net_nfc_util_free_mem(msg->data.buffer);
+			}
+			break;
+
 		case NET_NFC_MESSAGE_P2P_RECEIVE :
 			{
 				net_nfc_response_p2p_receive_t *msg = (net_nfc_response_p2p_receive_t *)data;
@@ -193,6 +405,13 @@ NET_NFC_EXPORT_API void net_nfc_util_mem_free_detail_msg(int msg_type, int messa
 			}
 			break;
 
+		case NET_NFC_MESSAGE_SERVICE_SE_EVENT_BATCH :
+			{
+				net_nfc_response_se_event_batch_t *msg = (net_nfc_response_se_event_batch_t *)data;
+				_net_nfc_util_free_mem(msg->data.buffer);
+			}
+			break;
+
 		case NET_NFC_MESSAGE_SEND_APDU_SE :
 			{
 				net_nfc_response_send_apdu_t *msg = (net_nfc_response_send_apdu_t *)data;
@@ -200,6 +419,41 @@ NET_NFC_EXPORT_API void net_nfc_util_mem_free_detail_msg(int msg_type, int messa
 			}
 			break;
 
+		case NET_NFC_MESSAGE_SEND_APDU_SCRIPT_SE :
+			{
+				net_nfc_response_send_apdu_script_t *msg = (net_nfc_response_send_apdu_script_t *)data;
+				_net_nfc_util_free_mem(msg->data.buffer);
+			}
+			break;
+
+		case NET_NFC_MESSAGE_GET_ATR_SE :
+			{
+				net_nfc_response_get_atr_t *msg = (net_nfc_response_get_atr_t *)data;
+				_net_nfc_util_free_mem(msg->data.buffer);
+			}
+			break;
+
+		case NET_NFC_MESSAGE_TRANSCEIVE_SEQUENCE :
+			{
+				net_nfc_response_transceive_sequence_t *msg = (net_nfc_response_transceive_sequence_t *)data;
+				_net_nfc_util_free_mem(msg->data.buffer);
+			}
+			break;
+
+		case NET_NFC_MESSAGE_MIFARE_READ_BLOCKS :
+			{
+				net_nfc_response_mifare_blocks_t *msg = (net_nfc_response_mifare_blocks_t *)data;
+				_net_nfc_util_free_mem(msg->data.buffer);
+			}
+			break;
+
+		case NET_NFC_MESSAGE_JEWEL_READ_MEMORY :
+			{
+				net_nfc_response_jewel_read_memory_t *msg = (net_nfc_response_jewel_read_memory_t *)data;
+				_net_nfc_util_free_mem(msg->data.buffer);
+			}
+			break;
+
 		default :
 			break;
 		}
@@ -25,100 +25,235 @@
 #include "net_nfc_util_ndef_message.h"
 #include "net_nfc_util_handover.h"
 
-typedef struct _search_index
+/* properties are kept in insertion order which is serialization order,
+ * and item indexes sorted by attribute are kept in same allocation for binary search */
+static int __property_lower_bound(net_nfc_carrier_property_array_s *array, uint16_t attribute)
 {
-	int target;
-	int current;
-	void *found;
-} search_index;
+	int low = 0, high = array->count, mid;
 
-static int __property_equal_to(gconstpointer key1, gconstpointer key2)
+	while (low < high)
+	{
+		mid = (low + high) / 2;
+		if (array->items[array->sorted[mid]].attribute < attribute)
+			low = mid + 1;
+		else
+			high = mid;
+	}
+
+	return low;
+}
+
+static int __property_upper_bound(net_nfc_carrier_property_array_s *array, uint16_t attribute)
 {
-	net_nfc_carrier_property_s *arg1 = (net_nfc_carrier_property_s *)key1;
-	net_nfc_carrier_property_s *arg2 = (net_nfc_carrier_property_s *)key2;
+	int low = 0, high = array->count, mid;
 
-	if (arg1->attribute < arg2->attribute)
+	while (low < high)
 	{
-		return -1;
+		mid = (low + high) / 2;
+		if (array->items[array->sorted[mid]].attribute <= attribute)
+			low = mid + 1;
+		else
+			high = mid;
 	}
-	else if (arg1->attribute > arg2->attribute)
+
+	return low;
+}
+
+/* wsc allows several network keys (wep key 1 ~ 4) and vendor extensions in a credential */
+static bool __is_multi_valued_attribute(uint16_t attribute)
+{
+	switch (attribute)
 	{
-		return 1;
+	case NET_NFC_WIFI_ATTRIBUTE_NET_KEY :
+	case NET_NFC_WIFI_ATTRIBUTE_VEN_EXT :
+		return true;
+
+	default :
+		return false;
 	}
-	else
+}
+
+static net_nfc_carrier_property_s *__find_property_by_attrubute(net_nfc_carrier_property_array_s *array, uint16_t attribute)
+{
+	int pos;
+
+	if (array == NULL || array->count == 0)
+	{
+		return NULL;
+	}
+
+	/* first inserted one is found if there are groups of same attribute */
+	pos = __property_lower_bound(array, attribute);
+	if (pos < array->count && array->items[array->sorted[pos]].attribute == attribute)
+	{
+		return &array->items[array->sorted[pos]];
+	}
+
+	return NULL;
+}
+
+static net_nfc_error_e __reserve_property_items(net_nfc_carrier_property_array_s *array, int count)
+{
+	net_nfc_carrier_property_s *items = NULL;
+	int capacity;
+
+	if (array->count + count <= array->capacity)
 	{
-		return 0;
+		return NET_NFC_OK;
 	}
+
+	capacity = (array->capacity > 0) ? array->capacity * 2 : NET_NFC_CARRIER_PROPERTY_DEFAULT_CAPACITY;
+	while (capacity < array->count + count)
+		capacity *= 2;
+
+	/* items and sorted index share one allocation */
+	_net_nfc_util_alloc_mem(items, capacity * (sizeof(net_nfc_carrier_property_s) + sizeof(uint16_t)));
+	if (items == NULL)
+	{
+		return NET_NFC_ALLOC_FAIL;
+	}
+
+	if (array->count > 0)
+	{
+		memcpy(items, array->items, array->count * sizeof(net_nfc_carrier_property_s));
+		memcpy(items + capacity, array->sorted, array->count * sizeof(uint16_t));
+	}
+
+	_net_nfc_util_free_mem(array->items);
+
+	array->items = items;
+	array->sorted = (uint16_t *)(items + capacity);
+	array->capacity = capacity;
+
+	return NET_NFC_OK;
 }
 
-static net_nfc_carrier_property_s *__find_property_by_attrubute(GList *list, uint16_t attribute)
+/* values which are handed out are not moved, a new chunk is added when current one is full */
+static net_nfc_error_e __reserve_property_values(net_nfc_carrier_property_array_s *array, int size)
 {
-	GList *found = NULL;
-	net_nfc_carrier_property_s temp;
+	net_nfc_carrier_value_chunk_s *chunk = NULL;
+	int capacity;
+
+	if (array->values != NULL && array->values->length + size <= array->values->capacity)
+	{
+		return NET_NFC_OK;
+	}
 
-	temp.attribute = attribute;
-	found = g_list_find_custom(list, &temp, __property_equal_to);
+	capacity = (array->values != NULL) ? array->values->capacity * 2 : NET_NFC_CARRIER_PROPERTY_DEFAULT_VALUES;
+	while (capacity < size)
+		capacity *= 2;
 
-	if (found == NULL)
+	_net_nfc_util_alloc_mem(chunk, sizeof(net_nfc_carrier_value_chunk_s) + capacity);
+	if (chunk == NULL)
 	{
-		return NULL;
+		return NET_NFC_ALLOC_FAIL;
 	}
 
-	return (net_nfc_carrier_property_s *)found->data;
+	chunk->buffer = (uint8_t *)(chunk + 1);
+	chunk->capacity = capacity;
+	chunk->next = array->values;
+
+	array->values = chunk;
+
+	return NET_NFC_OK;
 }
 
-static void __find_nth_group(gpointer data, gpointer user_data)
+static net_nfc_error_e __append_property(net_nfc_carrier_property_array_s *array, uint16_t attribute, bool is_group, uint16_t length, void *data)
 {
-	net_nfc_carrier_property_s *info = (net_nfc_carrier_property_s *)data;
-	search_index *nth = (search_index *)user_data;
+	net_nfc_carrier_property_s *elem = NULL;
+	net_nfc_error_e result;
+	int pos;
 
-	if (info == NULL || user_data == NULL)
-		return;
+	if ((result = __reserve_property_items(array, 1)) != NET_NFC_OK)
+	{
+		return result;
+	}
 
-	if (info->is_group)
+	elem = &array->items[array->count];
+	elem->attribute = attribute;
+	elem->length = length;
+	elem->is_group = is_group;
+
+	if (is_group)
 	{
-		if (nth->current == nth->target)
+		elem->data = data;
+	}
+	else
+	{
+		if ((result = __reserve_property_values(array, length)) != NET_NFC_OK)
 		{
-			nth->found = data;
+			return result;
 		}
-		nth->current++;
+
+		elem->data = array->values->buffer + array->values->length;
+		memcpy(elem->data, data, length);
+		array->values->length += length;
 	}
+
+	/* same attributes are kept in insertion order */
+	pos = __property_upper_bound(array, attribute);
+	memmove(&array->sorted[pos + 1], &array->sorted[pos], (array->count - pos) * sizeof(uint16_t));
+	array->sorted[pos] = array->count;
+	array->count++;
+
+	return NET_NFC_OK;
 }
 
-static void __free_all_data(gpointer data, gpointer user_data)
+static void __remove_property(net_nfc_carrier_property_array_s *array, net_nfc_carrier_property_s *elem)
 {
-	net_nfc_carrier_property_s *info = (net_nfc_carrier_property_s *)data;
+	int index = elem - array->items;
+	int i, j;
 
-	if (info == NULL)
-		return;
+	memmove(&array->items[index], &array->items[index + 1], (array->count - index - 1) * sizeof(net_nfc_carrier_property_s));
 
-	if (info->is_group)
+	for (i = 0, j = 0; i < array->count; i++)
 	{
-		DEBUG_MSG("FREE: group is found");
-		net_nfc_util_free_carrier_group((net_nfc_carrier_property_s *)info);
+		if (array->sorted[i] == index)
+			continue;
+
+		array->sorted[j++] = (array->sorted[i] > index) ? array->sorted[i] - 1 : array->sorted[i];
 	}
-	else
+
+	array->count--;
+
+	/* value is not reclaimed until array is freed */
+}
+
+static void __free_property_array(net_nfc_carrier_property_array_s *array)
+{
+	int i;
+
+	for (i = 0; i < array->count; i++)
+	{
+		if (array->items[i].is_group)
+		{
+			DEBUG_MSG("FREE: group is found");
+			net_nfc_util_free_carrier_group((net_nfc_carrier_property_s *)array->items[i].data);
+		}
+	}
+
+	_net_nfc_util_free_mem(array->items);
+
+	while (array->values != NULL)
 	{
-		DEBUG_MSG("FREE: element is found ATTRIB:0x%X length:%d", info->attribute, info->length);
-		_net_nfc_util_free_mem(info->data);
-		_net_nfc_util_free_mem(info);
+		net_nfc_carrier_value_chunk_s *chunk = array->values;
+
+		array->values = chunk->next;
+		_net_nfc_util_free_mem(chunk);
 	}
+
+	memset(array, 0x00, sizeof(net_nfc_carrier_property_array_s));
 }
 
-static net_nfc_error_e __net_nfc_util_create_connection_handover_collsion_resolution_record(ndef_record_s **record)
+static net_nfc_error_e __net_nfc_util_create_connection_handover_collsion_resolution_record(ndef_record_s **record, uint16_t random_num)
 {
-	uint32_t state = 0;
 	data_s typeName = { 0 };
 	data_s payload = { 0 };
 	uint8_t rand_buffer[2] = { 0, 0 };
-	uint16_t random_num;
 
 	if (record == NULL)
 		return NET_NFC_NULL_PARAMETER;
 
-	state = (uint32_t)time(NULL);
-	random_num = (unsigned short)rand_r(&state);
-
 	typeName.buffer = (uint8_t *)COLLISION_DETECT_RECORD_TYPE;
 	typeName.length = strlen(COLLISION_DETECT_RECORD_TYPE);
 
@@ -186,7 +321,7 @@ net_nfc_error_e net_nfc_util_create_carrier_config(net_nfc_carrier_config_s **co
 
 net_nfc_error_e net_nfc_util_add_carrier_config_property(net_nfc_carrier_config_s *config, uint16_t attribute, uint16_t size, uint8_t * data)
 {
-	net_nfc_carrier_property_s *elem = NULL;
+	net_nfc_error_e result;
 
 	DEBUG_MSG("ADD property: [ATTRIB:0x%X, SIZE:%d]", attribute, size);
 
@@ -195,29 +330,16 @@ net_nfc_error_e net_nfc_util_add_carrier_config_property(net_nfc_carrier_config_
 		return NET_NFC_NULL_PARAMETER;
 	}
 
-	if (__find_property_by_attrubute(config->data, attribute) != NULL)
+	if (__is_multi_valued_attribute(attribute) == false && __find_property_by_attrubute(&config->data, attribute) != NULL)
 	{
 		return NET_NFC_ALREADY_REGISTERED;
 	}
 
-	_net_nfc_util_alloc_mem(elem, sizeof (net_nfc_carrier_property_s));
-	if (elem == NULL)
+	if ((result = __append_property(&config->data, attribute, false, size, data)) != NET_NFC_OK)
 	{
-		return NET_NFC_ALLOC_FAIL;
-	}
-	elem->attribute = attribute;
-	elem->length = size;
-	elem->is_group = false;
-	_net_nfc_util_alloc_mem(elem->data, size);
-
-	if (elem->data == NULL)
-	{
-		_net_nfc_util_free_mem(elem);
-		return NET_NFC_ALLOC_FAIL;
+		return result;
 	}
-	memcpy(elem->data, data, size);
 
-	config->data = g_list_append(config->data, elem);
 	config->length += size + 2 * __net_nfc_get_size_of_attribute(attribute);
 
 	DEBUG_MSG("ADD completed total length %d", config->length);
@@ -234,24 +356,24 @@ net_nfc_error_e net_nfc_util_remove_carrier_config_property(net_nfc_carrier_conf
 		return NET_NFC_NULL_PARAMETER;
 	}
 
-	elem = __find_property_by_attrubute(config->data, attribute);
+	elem = __find_property_by_attrubute(&config->data, attribute);
 	if (elem == NULL)
 	{
 		return NET_NFC_NO_DATA_FOUND;
 	}
 
-	config->data = g_list_remove(config->data, elem);
-	config->length -= (elem->length + 2 * __net_nfc_get_size_of_attribute(attribute));
-
 	if (elem->is_group)
 	{
-		net_nfc_util_free_carrier_group((net_nfc_carrier_property_s *)elem);
+		config->length -= ((net_nfc_carrier_property_s *)elem->data)->length;
+		net_nfc_util_free_carrier_group((net_nfc_carrier_property_s *)elem->data);
 	}
 	else
 	{
-		_net_nfc_util_free_mem(elem->data);
-		_net_nfc_util_free_mem(elem);
+		config->length -= elem->length;
 	}
+	config->length -= 2 * __net_nfc_get_size_of_attribute(attribute);
+
+	__remove_property(&config->data, elem);
 
 	return NET_NFC_OK;
 }
@@ -265,7 +387,7 @@ net_nfc_error_e net_nfc_util_get_carrier_config_property(net_nfc_carrier_config_
 		return NET_NFC_NULL_PARAMETER;
 	}
 
-	elem = __find_property_by_attrubute(config->data, attribute);
+	elem = __find_property_by_attrubute(&config->data, attribute);
 	if (elem == NULL)
 	{
 		*size = 0;
@@ -286,37 +408,58 @@ net_nfc_error_e net_nfc_util_get_carrier_config_property(net_nfc_carrier_config_
 	return NET_NFC_OK;
 }
 
+static net_nfc_carrier_property_s *__find_group(net_nfc_carrier_property_array_s *array, net_nfc_carrier_property_s *group)
+{
+	int i;
+
+	for (i = 0; i < array->count; i++)
+	{
+		if (array->items[i].is_group && array->items[i].data == group)
+			return &array->items[i];
+	}
+
+	return NULL;
+}
+
 net_nfc_error_e net_nfc_util_append_carrier_config_group(net_nfc_carrier_config_s *config, net_nfc_carrier_property_s *group)
 {
+	net_nfc_error_e result;
+
 	if (config == NULL || group == NULL)
 	{
 		return NET_NFC_NULL_PARAMETER;
 	}
-	if (g_list_find(config->data, group) != NULL)
+	if (__find_group(&config->data, group) != NULL)
 	{
 		return NET_NFC_ALREADY_REGISTERED;
 	}
 
-	config->data = g_list_append(config->data, group);
-	config->length += group->length;
+	/* group handle is kept as it is, config owns it from now */
+	if ((result = __append_property(&config->data, group->attribute, true, group->length, group)) != NET_NFC_OK)
+	{
+		return result;
+	}
+	config->length += group->length + 2 * __net_nfc_get_size_of_attribute(group->attribute);
 
 	return NET_NFC_OK;
 }
 
 net_nfc_error_e net_nfc_util_remove_carrier_config_group(net_nfc_carrier_config_s *config, net_nfc_carrier_property_s *group)
 {
+	net_nfc_carrier_property_s *elem = NULL;
+
 	if (config == NULL || group == NULL)
 	{
 		return NET_NFC_NULL_PARAMETER;
 	}
 
-	if (g_list_find(config->data, group) != NULL)
+	if ((elem = __find_group(&config->data, group)) == NULL)
 	{
 		return NET_NFC_NO_DATA_FOUND;
 	}
 
-	config->length -= group->length;
-	config->data = g_list_remove(config->data, group);
+	config->length -= (group->length + 2 * __net_nfc_get_size_of_attribute(group->attribute));
+	__remove_property(&config->data, elem);
 
 	net_nfc_util_free_carrier_group((net_nfc_carrier_property_s *)group);
 
@@ -325,7 +468,7 @@ net_nfc_error_e net_nfc_util_remove_carrier_config_group(net_nfc_carrier_config_
 
 net_nfc_error_e net_nfc_util_get_carrier_config_group(net_nfc_carrier_config_s *config, int index, net_nfc_carrier_property_s **group)
 {
-	search_index result;
+	int i, current = 0;
 
 	if (config == NULL || group == NULL)
 	{
@@ -337,19 +480,21 @@ net_nfc_error_e net_nfc_util_get_carrier_config_group(net_nfc_carrier_config_s *
 		return NET_NFC_OUT_OF_BOUND;
 	}
 
-	result.current = 0;
-	result.target = index;
-	result.found = NULL;
-
-	g_list_foreach(config->data, __find_nth_group, &result);
-
-	if (result.found == NULL)
+	for (i = 0; i < config->data.count; i++)
 	{
-		return NET_NFC_NO_DATA_FOUND;
+		if (config->data.items[i].is_group)
+		{
+			if (current == index)
+			{
+				*group = (net_nfc_carrier_property_s *)config->data.items[i].data;
+
+				return NET_NFC_OK;
+			}
+			current++;
+		}
 	}
-	*group = (net_nfc_carrier_property_s *)result.found;
 
-	return NET_NFC_OK;
+	return NET_NFC_NO_DATA_FOUND;
 }
 
 net_nfc_error_e net_nfc_util_free_carrier_config(net_nfc_carrier_config_s *config)
@@ -359,8 +504,7 @@ net_nfc_error_e net_nfc_util_free_carrier_config(net_nfc_carrier_config_s *confi
 		return NET_NFC_NULL_PARAMETER;
 	}
 
-	g_list_foreach(config->data, __free_all_data, NULL);
-	g_list_free(config->data);
+	__free_property_array(&config->data);
 
 	_net_nfc_util_free_mem(config);
 
@@ -374,12 +518,14 @@ net_nfc_error_e net_nfc_util_create_carrier_config_group(net_nfc_carrier_propert
 		return NET_NFC_NULL_PARAMETER;
 	}
 
-	_net_nfc_util_alloc_mem(*group, sizeof(net_nfc_carrier_property_s));
+	_net_nfc_util_alloc_mem(*group, sizeof(net_nfc_carrier_property_s) + sizeof(net_nfc_carrier_property_array_s));
 	if (*group == NULL)
 	{
 		return NET_NFC_ALLOC_FAIL;
 	}
 
+	/* properties of group follow group itself */
+	(*group)->data = (net_nfc_carrier_property_array_s *)((*group) + 1);
 	(*group)->attribute = attribute;
 	(*group)->is_group = true;
 
@@ -388,7 +534,7 @@ net_nfc_error_e net_nfc_util_create_carrier_config_group(net_nfc_carrier_propert
 
 net_nfc_error_e net_nfc_util_add_carrier_config_group_property(net_nfc_carrier_property_s *group, uint16_t attribute, uint16_t size, uint8_t *data)
 {
-	net_nfc_carrier_property_s *elem = NULL;
+	net_nfc_error_e result;
 
 	DEBUG_MSG("ADD group property: [ATTRIB:0x%X, SIZE:%d]", attribute, size);
 
@@ -397,29 +543,17 @@ net_nfc_error_e net_nfc_util_add_carrier_config_group_property(net_nfc_carrier_p
 		return NET_NFC_NULL_PARAMETER;
 	}
 
-	if (__find_property_by_attrubute((GList *)group->data, attribute) != NULL)
+	if (__is_multi_valued_attribute(attribute) == false &&
+		__find_property_by_attrubute((net_nfc_carrier_property_array_s *)group->data, attribute) != NULL)
 	{
 		return NET_NFC_ALREADY_REGISTERED;
 	}
 
-	_net_nfc_util_alloc_mem(elem, sizeof (net_nfc_carrier_property_s));
-	if (elem == NULL)
+	if ((result = __append_property((net_nfc_carrier_property_array_s *)group->data, attribute, false, size, data)) != NET_NFC_OK)
 	{
-		return NET_NFC_ALLOC_FAIL;
-	}
-	elem->attribute = attribute;
-	elem->length = size;
-	elem->is_group = false;
-
-	_net_nfc_util_alloc_mem(elem->data, size);
-	if (elem->data == NULL)
-	{
-		_net_nfc_util_free_mem(elem);
-		return NET_NFC_ALLOC_FAIL;
+		return result;
 	}
-	memcpy(elem->data, data, size);
 	group->length += size + 2 * __net_nfc_get_size_of_attribute(attribute);
-	group->data = g_list_append((GList *)(group->data), elem);
 
 	DEBUG_MSG("ADD group completed total length %d", group->length);
 
@@ -435,7 +569,7 @@ net_nfc_error_e net_nfc_util_get_carrier_config_group_property(net_nfc_carrier_p
 		return NET_NFC_NULL_PARAMETER;
 	}
 
-	elem = __find_property_by_attrubute((GList*)(group->data), attribute);
+	elem = __find_property_by_attrubute((net_nfc_carrier_property_array_s *)group->data, attribute);
 	if (elem == NULL)
 	{
 		*size = 0;
@@ -458,16 +592,14 @@ net_nfc_error_e net_nfc_util_remove_carrier_config_group_property(net_nfc_carrie
 		return NET_NFC_NULL_PARAMETER;
 	}
 
-	elem = __find_property_by_attrubute((GList*)(group->data), attribute);
+	elem = __find_property_by_attrubute((net_nfc_carrier_property_array_s *)group->data, attribute);
 	if (elem == NULL)
 	{
 		return NET_NFC_NO_DATA_FOUND;
 	}
-	group->length -= elem->length;
-	group->data = g_list_remove((GList*)(group->data), elem);
+	group->length -= (elem->length + 2 * __net_nfc_get_size_of_attribute(attribute));
 
-	_net_nfc_util_free_mem(elem->data);
-	_net_nfc_util_free_mem(elem);
+	__remove_property((net_nfc_carrier_property_array_s *)group->data, elem);
 
 	return NET_NFC_OK;
 
@@ -479,65 +611,66 @@ net_nfc_error_e net_nfc_util_free_carrier_group(net_nfc_carrier_property_s *grou
 	{
 		return NET_NFC_NULL_PARAMETER;
 	}
-	g_list_foreach((GList*)(group->data), __free_all_data, NULL);
-	g_list_free((GList*)(group->data));
+
+	__free_property_array((net_nfc_carrier_property_array_s *)group->data);
 
 	_net_nfc_util_free_mem(group);
 
 	return NET_NFC_OK;
 }
 
-static void __make_serial_wifi(gpointer data, gpointer user_data)
+static void __make_serial_wifi(net_nfc_carrier_property_array_s *array, data_s *payload)
 {
-	net_nfc_carrier_property_s *info = (net_nfc_carrier_property_s *)data;
-	data_s *payload = (data_s *)user_data;
+	net_nfc_carrier_property_s *info;
 	uint8_t *current;
 	int inc = 0;
+	int i;
 
-	if (info == NULL || user_data == NULL)
-		return;
+	for (i = 0; i < array->count; i++)
+	{
+		info = &array->items[i];
+		current = payload->buffer + payload->length;
+		inc = __net_nfc_get_size_of_attribute(info->attribute);
 
-	current = payload->buffer + payload->length;
-	inc = __net_nfc_get_size_of_attribute(info->attribute);
+		if (info->is_group)
+		{
+			net_nfc_carrier_property_s *group = (net_nfc_carrier_property_s *)info->data;
 
-	if (info->is_group)
-	{
-		DEBUG_MSG("[WIFI]Found Group make recursive");
-		*(uint16_t *)current = info->attribute;
-		*(uint16_t *)(current + inc) = info->length;
-		payload->length += (inc + inc);
-		g_list_foreach((GList *)info->data, __make_serial_wifi, payload);
-	}
-	else
-	{
-		DEBUG_MSG("[WIFI]Element is found attrib:0x%X length:%d current:%d", info->attribute, info->length, payload->length);
-		*(uint16_t *)current = info->attribute;
-		*(uint16_t *)(current + inc) = info->length;
-		memcpy(current + inc + inc, info->data, info->length);
-		payload->length += (inc + inc + info->length);
+			DEBUG_MSG("[WIFI]Found Group make recursive");
+			*(uint16_t *)current = group->attribute;
+			*(uint16_t *)(current + inc) = group->length;
+			payload->length += (inc + inc);
+			__make_serial_wifi((net_nfc_carrier_property_array_s *)group->data, payload);
+		}
+		else
+		{
+			DEBUG_MSG("[WIFI]Element is found attrib:0x%X length:%d current:%d", info->attribute, info->length, payload->length);
+			*(uint16_t *)current = info->attribute;
+			*(uint16_t *)(current + inc) = info->length;
+			memcpy(current + inc + inc, info->data, info->length);
+			payload->length += (inc + inc + info->length);
+		}
 	}
 }
 
-static void __make_serial_bt(gpointer data, gpointer user_data)
+static void __make_serial_bt(net_nfc_carrier_property_array_s *array, data_s *payload)
 {
-	net_nfc_carrier_property_s *info = (net_nfc_carrier_property_s *)data;
-	data_s *payload = (data_s *)user_data;
+	net_nfc_carrier_property_s *info;
 	uint8_t *current;
 	int inc = 0;
+	int i;
 
-	if (info == NULL || user_data == NULL)
-		return;
-
-	current = payload->buffer + payload->length; /* payload->length is zero */
-
-	if (info->is_group)
-	{
-		DEBUG_MSG("[BT]Found Group. call recursive");
-		g_list_foreach((GList *)info->data, __make_serial_bt, payload);
-	}
-	else
+	for (i = 0; i < array->count; i++)
 	{
-		if (info->attribute != NET_NFC_BT_ATTRIBUTE_ADDRESS)
+		info = &array->items[i];
+		current = payload->buffer + payload->length;
+
+		if (info->is_group)
+		{
+			DEBUG_MSG("[BT]Found Group. call recursive");
+			__make_serial_bt((net_nfc_carrier_property_array_s *)((net_nfc_carrier_property_s *)info->data)->data, payload);
+		}
+		else if (info->attribute != NET_NFC_BT_ATTRIBUTE_ADDRESS)
 		{
 			DEBUG_MSG("[BT]Element is found attrib:0x%X length:%d current:%d", info->attribute, info->length, payload->length);
 			inc = __net_nfc_get_size_of_attribute(info->attribute);
@@ -557,198 +690,487 @@ static void __make_serial_bt(gpointer data, gpointer user_data)
 
 net_nfc_error_e net_nfc_util_create_ndef_record_with_carrier_config(ndef_record_s **record, net_nfc_carrier_config_s *config)
 {
+	net_nfc_carrier_backend_s backend = { 0, };
 	data_s payload = { NULL, 0 };
 	data_s record_type = { NULL, 0 };
+	net_nfc_error_e result;
 
 	if (record == NULL || config == NULL)
 	{
 		return NET_NFC_NULL_PARAMETER;
 	}
 
-	_net_nfc_util_alloc_mem(payload.buffer, config->length);
-	if (payload.buffer == NULL)
+	if (net_nfc_util_get_carrier_backend(config->type, &backend) != NET_NFC_OK || backend.serialize == NULL)
 	{
-		return NET_NFC_ALLOC_FAIL;
+		return NET_NFC_NOT_SUPPORTED;
 	}
-	payload.length = 0; /* this should be zero because this will be used as current position of data written */
 
-	if (config->type == NET_NFC_CONN_HANDOVER_CARRIER_WIFI_BSS)
-	{
-		record_type.buffer = (uint8_t *)CONN_HANDOVER_WIFI_BSS_CARRIER_MIME_NAME;
-		record_type.length = strlen(CONN_HANDOVER_WIFI_BSS_CARRIER_MIME_NAME);
-		g_list_foreach(config->data, __make_serial_wifi, &payload);
-	}
-	else if (config->type == NET_NFC_CONN_HANDOVER_CARRIER_WIFI_IBSS)
-	{
-		record_type.buffer = (uint8_t *)CONN_HANDOVER_WIFI_IBSS_CARRIER_MIME_NAME;
-		record_type.length = strlen(CONN_HANDOVER_WIFI_IBSS_CARRIER_MIME_NAME);
-		g_list_foreach(config->data, __make_serial_wifi, &payload);
-	}
-	else if (config->type == NET_NFC_CONN_HANDOVER_CARRIER_BT)
+	if ((result = backend.serialize(config, &payload)) != NET_NFC_OK)
 	{
-		record_type.buffer = (uint8_t *)CONN_HANDOVER_BT_CARRIER_MIME_NAME;
-		record_type.length = strlen(CONN_HANDOVER_BT_CARRIER_MIME_NAME);
-		payload.buffer += 2; /* OOB total length */
-		g_list_foreach(config->data, __make_serial_bt, &payload);
-		payload.buffer -= 2; /* return to original */
-		payload.length += 2;
-		payload.buffer[0] = payload.length & 0xFF;
-		payload.buffer[1] = (payload.length >> 8) & 0xFF;
-	}
-	else
-	{
-		return NET_NFC_NOT_SUPPORTED;
+		return result;
 	}
 
+	record_type.buffer = (uint8_t *)backend.mime_type;
+	record_type.length = strlen(backend.mime_type);
+
 	DEBUG_MSG("payload length = %d", payload.length);
 
-	return net_nfc_util_create_record(NET_NFC_RECORD_MIME_TYPE, &record_type, NULL, &payload, record);
+	result = net_nfc_util_create_record(NET_NFC_RECORD_MIME_TYPE, &record_type, NULL, &payload, record);
+
+	_net_nfc_util_free_mem(payload.buffer);
+
+	return result;
 }
 
-static net_nfc_error_e __net_nfc_get_list_from_serial_for_wifi(GList **list, uint8_t *data, uint32_t length)
+static net_nfc_error_e __net_nfc_get_list_from_serial_for_wifi(net_nfc_carrier_config_s *config, net_nfc_carrier_property_s *group, uint8_t *data, uint32_t length)
 {
-	net_nfc_carrier_property_s *elem = NULL;
 	uint8_t *current = data;
 	uint8_t *last = current + length;
+	net_nfc_error_e result = NET_NFC_OK;
+
+	/* values can not be longer than the serialized list, so parsed values are kept in one chunk */
+	result = __reserve_property_values((group != NULL) ? (net_nfc_carrier_property_array_s *)group->data : &config->data, length);
+	if (result != NET_NFC_OK)
+	{
+		return result;
+	}
 
 	while (current < last)
 	{
-		_net_nfc_util_alloc_mem(elem, sizeof(net_nfc_carrier_property_s));
-		if (elem == NULL)
+		uint16_t attribute = *((uint16_t *)current);
+		uint16_t size = *((uint16_t *)(current + 2));
+
+		if (attribute == NET_NFC_WIFI_ATTRIBUTE_CREDENTIAL && group == NULL)
 		{
-			return NET_NFC_ALLOC_FAIL;
-		}
-		elem->attribute = *((uint16_t *)current);
-		elem->length = *((uint16_t *)(current + 2));
+			net_nfc_carrier_property_s *credential = NULL;
+
+			if ((result = net_nfc_util_create_carrier_config_group(&credential, attribute)) != NET_NFC_OK)
+			{
+				return result;
+			}
 
-		if (elem->attribute == NET_NFC_WIFI_ATTRIBUTE_CREDENTIAL)
+			if ((result = __net_nfc_get_list_from_serial_for_wifi(config, credential, (current + 4), size)) != NET_NFC_OK
+				|| (result = net_nfc_util_append_carrier_config_group(config, credential)) != NET_NFC_OK)
+			{
+				net_nfc_util_free_carrier_group(credential);
+				return result;
+			}
+		}
+		else if (group != NULL)
 		{
-			__net_nfc_get_list_from_serial_for_wifi((GList **)&(elem->data), (current + 4), elem->length);
-			elem->is_group = true;
+			result = net_nfc_util_add_carrier_config_group_property(group, attribute, size, (current + 4));
 		}
 		else
 		{
-			_net_nfc_util_alloc_mem(elem->data, elem->length);
-			if (elem->data == NULL)
-			{
-				_net_nfc_util_free_mem(elem);
-				return NET_NFC_ALLOC_FAIL;
-			}
-			memcpy(elem->data, (current + 4), elem->length);
-			elem->is_group = false;
+			result = net_nfc_util_add_carrier_config_property(config, attribute, size, (current + 4));
 		}
-		*list = g_list_append(*list, elem);
-		current += (4 + elem->length);
+
+		if (result != NET_NFC_OK)
+		{
+			return result;
+		}
+
+		current += (4 + size);
 	}
 
 	return NET_NFC_OK;
 }
 
-net_nfc_error_e __net_nfc_get_list_from_serial_for_bt(GList **list, uint8_t *data, uint32_t length)
+net_nfc_error_e __net_nfc_get_list_from_serial_for_bt(net_nfc_carrier_config_s *config, uint8_t *data, uint32_t length)
 {
-	net_nfc_carrier_property_s *elem = NULL;
 	uint8_t *current = data;
 	uint8_t *last = NULL;
+	net_nfc_error_e result;
 
 	current += 2; /* remove oob data length  two bytes length*/
 	length -= 2;
 
-	_net_nfc_util_alloc_mem(elem, sizeof(net_nfc_carrier_property_s));
-	if (elem == NULL)
+	/* BT address length is always 6 */
+	if ((result = net_nfc_util_add_carrier_config_property(config, NET_NFC_BT_ATTRIBUTE_ADDRESS, 6, current)) != NET_NFC_OK)
+	{
+		return result;
+	}
+
+	current += 6; /* BT address length is always 6 */
+	length -= 6; /* substracted by 6 (Address length)*/
+
+	last = current + length;
+
+	while (current < last)
+	{
+		uint16_t size = *((uint8_t *)current) - 1;
+		uint16_t attribute = *((uint8_t *)(++current));
+
+		if ((result = net_nfc_util_add_carrier_config_property(config, attribute, size, (++current))) != NET_NFC_OK)
+		{
+			return result;
+		}
+
+		current += size;
+	}
+
+	return NET_NFC_OK;
+}
+
+static net_nfc_error_e __net_nfc_util_serialize_wifi_config(net_nfc_carrier_config_s *config, data_s *payload)
+{
+	_net_nfc_util_alloc_mem(payload->buffer, config->length);
+	if (payload->buffer == NULL)
 	{
 		return NET_NFC_ALLOC_FAIL;
 	}
-	elem->attribute = (uint16_t)NET_NFC_BT_ATTRIBUTE_ADDRESS;
-	elem->length = 6; /* BT address length is always 6 */
+	payload->length = 0; /* this should be zero because this will be used as current position of data written */
 
-	_net_nfc_util_alloc_mem(elem->data, elem->length);
-	if (elem->data == NULL)
+	__make_serial_wifi(&config->data, payload);
+
+	return NET_NFC_OK;
+}
+
+static net_nfc_error_e __net_nfc_util_serialize_bt_config(net_nfc_carrier_config_s *config, data_s *payload)
+{
+	_net_nfc_util_alloc_mem(payload->buffer, config->length);
+	if (payload->buffer == NULL)
 	{
-		_net_nfc_util_free_mem(elem);
 		return NET_NFC_ALLOC_FAIL;
 	}
-	memcpy(elem->data, current, elem->length);
-	elem->is_group = false;
+	payload->length = 0; /* this should be zero because this will be used as current position of data written */
 
-	current += 6; /* BT address length is always 6 */
-	length -= 6; /* substracted by 6 (Address length)*/
-	*list = g_list_append(*list, elem);
+	payload->buffer += 2; /* OOB total length */
+	__make_serial_bt(&config->data, payload);
+	payload->buffer -= 2; /* return to original */
+	payload->length += 2;
+	payload->buffer[0] = payload->length & 0xFF;
+	payload->buffer[1] = (payload->length >> 8) & 0xFF;
 
-	last = current + length;
+	return NET_NFC_OK;
+}
 
-	while (current < last)
+static net_nfc_error_e __net_nfc_util_parse_wifi_config(net_nfc_carrier_config_s *config, uint8_t *data, uint32_t length)
+{
+	return __net_nfc_get_list_from_serial_for_wifi(config, NULL, data, length);
+}
+
+static net_nfc_error_e __net_nfc_util_parse_bt_config(net_nfc_carrier_config_s *config, uint8_t *data, uint32_t length)
+{
+	return __net_nfc_get_list_from_serial_for_bt(config, data, length);
+}
+
+/* local stand-in carrier, plain attribute(2) length(2) value list without any carrier stack */
+static uint32_t __get_serial_length_local(net_nfc_carrier_property_array_s *array)
+{
+	uint32_t length = 0;
+	int i;
+
+	for (i = 0; i < array->count; i++)
+	{
+		if (array->items[i].is_group)
+			length += __get_serial_length_local((net_nfc_carrier_property_array_s *)((net_nfc_carrier_property_s *)array->items[i].data)->data);
+		else
+			length += 4 + array->items[i].length;
+	}
+
+	return length;
+}
+
+static void __make_serial_local(net_nfc_carrier_property_array_s *array, data_s *payload)
+{
+	net_nfc_carrier_property_s *info;
+	uint8_t *current;
+	int i;
+
+	for (i = 0; i < array->count; i++)
 	{
-		_net_nfc_util_alloc_mem(elem, sizeof(net_nfc_carrier_property_s));
-		if (elem == NULL)
+		info = &array->items[i];
+
+		if (info->is_group)
 		{
-			return NET_NFC_ALLOC_FAIL;
+			__make_serial_local((net_nfc_carrier_property_array_s *)((net_nfc_carrier_property_s *)info->data)->data, payload);
 		}
-		elem->length = *((uint8_t *)current) - 1;
-		elem->attribute = *((uint8_t *)(++current));
+		else
+		{
+			current = payload->buffer + payload->length;
+
+			current[0] = (info->attribute >> 8) & 0xFF;
+			current[1] = info->attribute & 0xFF;
+			current[2] = (info->length >> 8) & 0xFF;
+			current[3] = info->length & 0xFF;
+			memcpy(current + 4, info->data, info->length);
+
+			payload->length += 4 + info->length;
+		}
+	}
+}
+
+static net_nfc_error_e __net_nfc_util_serialize_local_config(net_nfc_carrier_config_s *config, data_s *payload)
+{
+	uint32_t length = __get_serial_length_local(&config->data);
+
+	_net_nfc_util_alloc_mem(payload->buffer, length);
+	if (length > 0 && payload->buffer == NULL)
+	{
+		return NET_NFC_ALLOC_FAIL;
+	}
+	payload->length = 0;
+
+	__make_serial_local(&config->data, payload);
+
+	return NET_NFC_OK;
+}
+
+static net_nfc_error_e __net_nfc_util_parse_local_config(net_nfc_carrier_config_s *config, uint8_t *data, uint32_t length)
+{
+	uint8_t *current = data;
+	uint8_t *last = data + length;
 
-		_net_nfc_util_alloc_mem(elem->data, elem->length);
-		if (elem->data == NULL)
+	while (current + 4 <= last)
+	{
+		uint16_t attribute = (current[0] << 8) | current[1];
+		uint16_t size = (current[2] << 8) | current[3];
+		net_nfc_error_e result;
+
+		if (current + 4 + size > last)
 		{
-			_net_nfc_util_free_mem(elem);
-			return NET_NFC_ALLOC_FAIL;
+			return NET_NFC_INVALID_FORMAT;
 		}
-		memcpy(elem->data, (++current), elem->length);
-		elem->is_group = false;
 
-		current += elem->length;
-		*list = g_list_append(*list, elem);
+		if ((result = net_nfc_util_add_carrier_config_property(config, attribute, size, current + 4)) != NET_NFC_OK)
+		{
+			return result;
+		}
+
+		current += 4 + size;
 	}
 
 	return NET_NFC_OK;
 }
 
-net_nfc_error_e net_nfc_util_create_carrier_config_from_config_record(net_nfc_carrier_config_s **config, ndef_record_s *record)
+static bool __net_nfc_util_is_local_carrier_ready(void)
 {
-	net_nfc_error_e result = NET_NFC_OK;
-	net_nfc_conn_handover_carrier_type_e type;
+	return true;
+}
 
-	if (record == NULL || config == NULL)
+/* registered carrier backends, sorted by priority */
+G_LOCK_DEFINE_STATIC(carrier_backends);
+
+static net_nfc_carrier_backend_s carrier_backends[NET_NFC_CARRIER_BACKEND_MAX] =
+{
+	{ NET_NFC_CONN_HANDOVER_CARRIER_BT, CONN_HANDOVER_BT_CARRIER_MIME_NAME, 0, __net_nfc_util_serialize_bt_config, __net_nfc_util_parse_bt_config, NULL },
+	{ NET_NFC_CONN_HANDOVER_CARRIER_WIFI_BSS, CONN_HANDOVER_WIFI_BSS_CARRIER_MIME_NAME, 1, __net_nfc_util_serialize_wifi_config, __net_nfc_util_parse_wifi_config, NULL },
+	{ NET_NFC_CONN_HANDOVER_CARRIER_WIFI_IBSS, CONN_HANDOVER_WIFI_IBSS_CARRIER_MIME_NAME, 2, __net_nfc_util_serialize_wifi_config, __net_nfc_util_parse_wifi_config, NULL },
+};
+static int carrier_backend_count = 3;
+
+static int __net_nfc_util_find_carrier_backend(net_nfc_conn_handover_carrier_type_e type)
+{
+	int i;
+
+	for (i = 0; i < carrier_backend_count; i++)
+	{
+		if (carrier_backends[i].type == type)
+			return i;
+	}
+
+	return -1;
+}
+
+net_nfc_error_e net_nfc_util_register_carrier_backend(net_nfc_carrier_backend_s *backend)
+{
+	int i;
+
+	if (backend == NULL || backend->mime_type == NULL || backend->serialize == NULL || backend->parse == NULL)
 	{
 		return NET_NFC_NULL_PARAMETER;
 	}
 
-	if (strncmp((char *)record->type_s.buffer, CONN_HANDOVER_WIFI_BSS_CARRIER_MIME_NAME, record->type_s.length) == 0)
+	if (backend->type == NET_NFC_CONN_HANDOVER_CARRIER_UNKNOWN)
 	{
-		type = NET_NFC_CONN_HANDOVER_CARRIER_WIFI_BSS;
+		return NET_NFC_INVALID_PARAM;
 	}
-	else if (strncmp((char *)record->type_s.buffer, CONN_HANDOVER_WIFI_IBSS_CARRIER_MIME_NAME, record->type_s.length) == 0)
+
+	G_LOCK(carrier_backends);
+
+	/* registering same type again replaces old backend */
+	if ((i = __net_nfc_util_find_carrier_backend(backend->type)) >= 0)
 	{
-		type = NET_NFC_CONN_HANDOVER_CARRIER_WIFI_IBSS;
+		memmove(&carrier_backends[i], &carrier_backends[i + 1], sizeof(net_nfc_carrier_backend_s) * (carrier_backend_count - i - 1));
+		carrier_backend_count--;
 	}
-	else if (strncmp((char *)record->type_s.buffer, CONN_HANDOVER_BT_CARRIER_MIME_NAME, record->type_s.length) == 0)
+
+	if (carrier_backend_count >= NET_NFC_CARRIER_BACKEND_MAX)
 	{
-		type = NET_NFC_CONN_HANDOVER_CARRIER_BT;
+		G_UNLOCK(carrier_backends);
+
+		return NET_NFC_OUT_OF_BOUND;
 	}
-	else
+
+	for (i = carrier_backend_count; i > 0 && carrier_backends[i - 1].priority > backend->priority; i--)
+	{
+		carrier_backends[i] = carrier_backends[i - 1];
+	}
+
+	carrier_backends[i] = *backend;
+	carrier_backend_count++;
+
+	G_UNLOCK(carrier_backends);
+
+	DEBUG_MSG("carrier backend is registered, type [%d], mime [%s], priority [%d]", backend->type, backend->mime_type, backend->priority);
+
+	return NET_NFC_OK;
+}
+
+net_nfc_error_e net_nfc_util_unregister_carrier_backend(net_nfc_conn_handover_carrier_type_e type)
+{
+	net_nfc_error_e result = NET_NFC_NO_DATA_FOUND;
+	int i;
+
+	G_LOCK(carrier_backends);
+
+	if ((i = __net_nfc_util_find_carrier_backend(type)) >= 0)
+	{
+		memmove(&carrier_backends[i], &carrier_backends[i + 1], sizeof(net_nfc_carrier_backend_s) * (carrier_backend_count - i - 1));
+		carrier_backend_count--;
+
+		result = NET_NFC_OK;
+	}
+
+	G_UNLOCK(carrier_backends);
+
+	return result;
+}
+
+net_nfc_error_e net_nfc_util_register_local_carrier_backend(net_nfc_conn_handover_carrier_type_e type, const char *mime_type, int priority)
+{
+	net_nfc_carrier_backend_s backend = { 0, };
+
+	backend.type = type;
+	backend.mime_type = mime_type;
+	backend.priority = priority;
+	backend.serialize = __net_nfc_util_serialize_local_config;
+	backend.parse = __net_nfc_util_parse_local_config;
+	backend.is_ready = __net_nfc_util_is_local_carrier_ready;
+
+	return net_nfc_util_register_carrier_backend(&backend);
+}
+
+net_nfc_error_e net_nfc_util_get_carrier_backend(net_nfc_conn_handover_carrier_type_e type, net_nfc_carrier_backend_s *backend)
+{
+	net_nfc_error_e result = NET_NFC_NO_DATA_FOUND;
+	int i;
+
+	if (backend == NULL)
+	{
+		return NET_NFC_NULL_PARAMETER;
+	}
+
+	G_LOCK(carrier_backends);
+
+	if ((i = __net_nfc_util_find_carrier_backend(type)) >= 0)
+	{
+		*backend = carrier_backends[i];
+		result = NET_NFC_OK;
+	}
+
+	G_UNLOCK(carrier_backends);
+
+	return result;
+}
+
+net_nfc_error_e net_nfc_util_get_carrier_backend_by_mime_type(data_s *mime_type, net_nfc_carrier_backend_s *backend)
+{
+	net_nfc_error_e result = NET_NFC_NO_DATA_FOUND;
+	int i;
+
+	if (mime_type == NULL || mime_type->buffer == NULL || backend == NULL)
+	{
+		return NET_NFC_NULL_PARAMETER;
+	}
+
+	G_LOCK(carrier_backends);
+
+	for (i = 0; i < carrier_backend_count; i++)
+	{
+		if (strlen(carrier_backends[i].mime_type) == mime_type->length && memcmp(carrier_backends[i].mime_type, mime_type->buffer, mime_type->length) == 0)
+		{
+			*backend = carrier_backends[i];
+			result = NET_NFC_OK;
+			break;
+		}
+	}
+
+	G_UNLOCK(carrier_backends);
+
+	return result;
+}
+
+bool net_nfc_util_is_carrier_ready(net_nfc_conn_handover_carrier_type_e type)
+{
+	net_nfc_carrier_backend_s backend = { 0, };
+
+	if (net_nfc_util_get_carrier_backend(type, &backend) != NET_NFC_OK)
+	{
+		return false;
+	}
+
+	/* probe is called out of lock, it may take time */
+	return (backend.is_ready == NULL || backend.is_ready() == true);
+}
+
+net_nfc_error_e net_nfc_util_get_carrier_priority_order(net_nfc_conn_handover_carrier_type_e *types, int *count)
+{
+	net_nfc_conn_handover_carrier_type_e ordered[NET_NFC_CARRIER_BACKEND_MAX];
+	int ordered_count, i, found = 0;
+
+	if (types == NULL || count == NULL)
+	{
+		return NET_NFC_NULL_PARAMETER;
+	}
+
+	G_LOCK(carrier_backends);
+
+	ordered_count = carrier_backend_count;
+	for (i = 0; i < ordered_count; i++)
+	{
+		ordered[i] = carrier_backends[i].type;
+	}
+
+	G_UNLOCK(carrier_backends);
+
+	for (i = 0; i < ordered_count && found < *count; i++)
+	{
+		if (net_nfc_util_is_carrier_ready(ordered[i]) == true)
+		{
+			types[found++] = ordered[i];
+		}
+	}
+
+	*count = found;
+
+	return NET_NFC_OK;
+}
+
+net_nfc_error_e net_nfc_util_create_carrier_config_from_config_record(net_nfc_carrier_config_s **config, ndef_record_s *record)
+{
+	net_nfc_carrier_backend_s backend = { 0, };
+	net_nfc_error_e result = NET_NFC_OK;
+
+	if (record == NULL || config == NULL)
+	{
+		return NET_NFC_NULL_PARAMETER;
+	}
+
+	if (net_nfc_util_get_carrier_backend_by_mime_type(&record->type_s, &backend) != NET_NFC_OK)
 	{
 		DEBUG_MSG("Record type is not config type");
 		return NET_NFC_INVALID_FORMAT;
 	}
 
-	result = net_nfc_util_create_carrier_config(config, type);
+	result = net_nfc_util_create_carrier_config(config, backend.type);
 	if (*config == NULL)
 	{
 		return NET_NFC_ALLOC_FAIL;
 	}
 
-	switch ((*config)->type)
-	{
-	case NET_NFC_CONN_HANDOVER_CARRIER_WIFI_BSS :
-		case NET_NFC_CONN_HANDOVER_CARRIER_WIFI_IBSS :
-		result = __net_nfc_get_list_from_serial_for_wifi((GList **)&((*config)->data), record->payload_s.buffer, record->payload_s.length);
-		break;
-	case NET_NFC_CONN_HANDOVER_CARRIER_BT :
-		result = __net_nfc_get_list_from_serial_for_bt((GList **)&((*config)->data), record->payload_s.buffer, record->payload_s.length);
-		break;
-	case NET_NFC_CONN_HANDOVER_CARRIER_UNKNOWN :
-		result = NET_NFC_NOT_SUPPORTED;
-		break;
-	}
+	result = backend.parse(*config, record->payload_s.buffer, record->payload_s.length);
 
 	if (result != NET_NFC_OK)
 	{
@@ -758,7 +1180,30 @@ net_nfc_error_e net_nfc_util_create_carrier_config_from_config_record(net_nfc_ca
 	return result;
 }
 
+net_nfc_error_e net_nfc_util_create_handover_random_number(unsigned short *random_number)
+{
+	if (random_number == NULL)
+	{
+		return NET_NFC_NULL_PARAMETER;
+	}
+
+	/* both devices may create request in the same second, so do not seed with time.
+	 * glib random generator is seeded from /dev/urandom */
+	*random_number = (unsigned short)(g_random_int() & 0xffff);
+
+	return NET_NFC_OK;
+}
+
 net_nfc_error_e net_nfc_util_create_handover_request_message(ndef_message_s **message)
+{
+	unsigned short random_number = 0;
+
+	net_nfc_util_create_handover_random_number(&random_number);
+
+	return net_nfc_util_create_handover_request_message_with_random_number(message, random_number);
+}
+
+net_nfc_error_e net_nfc_util_create_handover_request_message_with_random_number(ndef_message_s **message, unsigned short random_number)
 {
 	ndef_message_s *inner_message = NULL;
 	net_nfc_error_e error;
@@ -787,7 +1232,7 @@ net_nfc_error_e net_nfc_util_create_handover_request_message(ndef_message_s **me
 		return error;
 	}
 
-	__net_nfc_util_create_connection_handover_collsion_resolution_record(&record);
+	__net_nfc_util_create_connection_handover_collsion_resolution_record(&record, random_number);
 	net_nfc_util_append_record(inner_message, record);
 
 	size = net_nfc_util_get_ndef_message_length(inner_message) + 1;
@@ -1301,7 +1746,7 @@ net_nfc_error_e net_nfc_util_get_handover_random_number(ndef_message_s *message,
 		}
 		else
 		{
-			*random_number = (cr_record->payload_s.buffer[0] << 8) & (cr_record->payload_s.buffer[1]);
+			*random_number = (cr_record->payload_s.buffer[0] << 8) | (cr_record->payload_s.buffer[1]);
 		}
 
 		net_nfc_util_free_ndef_message(inner_msg);
@@ -1342,9 +1787,10 @@ net_nfc_error_e net_nfc_util_get_alternative_carrier_record_count(ndef_message_s
 			}
 			current = current->next;
 		}
-		net_nfc_util_free_ndef_message(inner_msg);
 	}
 
+	net_nfc_util_free_ndef_message(inner_msg);
+
 	return error;
 }
 
@@ -1452,17 +1898,11 @@ net_nfc_error_e net_nfc_util_set_alternative_carrier_power_status(ndef_message_s
 
 net_nfc_error_e net_nfc_util_get_alternative_carrier_type_from_record(ndef_record_s *record, net_nfc_conn_handover_carrier_type_e *type)
 {
-	if (strncmp((char *)record->type_s.buffer, CONN_HANDOVER_BT_CARRIER_MIME_NAME, (size_t)record->type_s.length) == 0)
-	{
-		*type = NET_NFC_CONN_HANDOVER_CARRIER_BT;
-	}
-	else if (strncmp((char *)record->type_s.buffer, CONN_HANDOVER_WIFI_BSS_CARRIER_MIME_NAME, (size_t)record->type_s.length) == 0)
-	{
-		*type = NET_NFC_CONN_HANDOVER_CARRIER_WIFI_BSS;
-	}
-	else if (strncmp((char *)record->type_s.buffer, CONN_HANDOVER_WIFI_IBSS_CARRIER_MIME_NAME, (size_t)record->type_s.length) == 0)
+	net_nfc_carrier_backend_s backend = { 0, };
+
+	if (net_nfc_util_get_carrier_backend_by_mime_type(&record->type_s, &backend) == NET_NFC_OK)
 	{
-		*type = NET_NFC_CONN_HANDOVER_CARRIER_WIFI_IBSS;
+		*type = backend.type;
 	}
 	else
 	{
@@ -15,10 +15,13 @@
   */
 
 
+#include <glib.h>
+
 #include <openssl/evp.h>
 #include <openssl/engine.h>
 #include <openssl/pkcs12.h>
 #include <openssl/pem.h>
+#include <openssl/sha.h>
 
 #include "net_nfc_typedef_private.h"
 #include "net_nfc_debug_private.h"
@@ -129,24 +132,148 @@ static X509 *_load_certificate_from_mem(int format, uint8_t *buffer, uint32_t le
 //	return ret;
 //}
 
-net_nfc_openssl_verify_context_s *net_nfc_util_openssl_init_verify_certificate(void)
+static pthread_once_t algorithms_once = PTHREAD_ONCE_INIT;
+
+static void _add_all_algorithms(void)
 {
-	net_nfc_openssl_verify_context_s *result = NULL;
+	OpenSSL_add_all_algorithms();
+}
 
-	_net_nfc_util_alloc_mem(result, sizeof(net_nfc_openssl_verify_context_s));
-	if (result != NULL)
+static void _init_algorithms(void)
+{
+	pthread_once(&algorithms_once, _add_all_algorithms);
+}
+
+/* trusted CAs are loaded once and shared by all verifications */
+G_LOCK_DEFINE_STATIC(trusted_store);
+static X509_STORE *trusted_store = NULL;
+
+/* recently verified certificate chains, most recently used first */
+#define NET_NFC_VERIFIED_CHAIN_CACHE_SIZE	8
+#define NET_NFC_VERIFIED_CHAIN_CACHE_TTL	(10 * 60 * G_USEC_PER_SEC)
+
+typedef struct _net_nfc_verified_chain_s
+{
+	uint8_t digest[SHA256_DIGEST_LENGTH];
+	gint64 verified_time;
+}
+net_nfc_verified_chain_s;
+
+G_LOCK_DEFINE_STATIC(verified_chains);
+static net_nfc_verified_chain_s verified_chains[NET_NFC_VERIFIED_CHAIN_CACHE_SIZE];
+static int verified_chain_count = 0;
+
+static X509_STORE *_get_trusted_store(void)
+{
+	X509_STORE *store;
+
+	G_LOCK(trusted_store);
+
+	if (trusted_store == NULL)
 	{
-		result->store = X509_STORE_new();
-		if (result->store != NULL)
+		_init_algorithms();
+
+		trusted_store = X509_STORE_new();
+		if (trusted_store != NULL)
 		{
-			OpenSSL_add_all_algorithms();
+			if (X509_STORE_set_default_paths(trusted_store) != 1)
+			{
+				DEBUG_ERR_MSG("X509_STORE_set_default_paths failed");
+			}
 		}
 		else
 		{
 			DEBUG_ERR_MSG("X509_STORE_new failed");
 		}
 	}
-	else
+
+	store = trusted_store;
+
+	G_UNLOCK(trusted_store);
+
+	return store;
+}
+
+static bool _get_chain_digest(net_nfc_openssl_verify_context_s *context, uint8_t *digest)
+{
+	bool result = false;
+	EVP_MD_CTX *md_ctx = NULL;
+
+	md_ctx = EVP_MD_CTX_create();
+	if (md_ctx != NULL)
+	{
+		if (EVP_DigestInit_ex(md_ctx, EVP_sha256(), NULL) == 1
+			&& EVP_DigestUpdate(md_ctx, context->signer_buffer, context->signer_length) == 1
+			&& EVP_DigestUpdate(md_ctx, context->ca_buffer, context->ca_length) == 1
+			&& EVP_DigestFinal_ex(md_ctx, digest, NULL) == 1)
+		{
+			result = true;
+		}
+
+		EVP_MD_CTX_destroy(md_ctx);
+	}
+
+	return result;
+}
+
+static bool _find_verified_chain(uint8_t *digest)
+{
+	bool result = false;
+	gint64 now = g_get_monotonic_time();
+	int i;
+
+	G_LOCK(verified_chains);
+
+	for (i = 0; i < verified_chain_count; i++)
+	{
+		if (memcmp(verified_chains[i].digest, digest, SHA256_DIGEST_LENGTH) == 0)
+		{
+			net_nfc_verified_chain_s found = verified_chains[i];
+
+			memmove(&verified_chains[1], &verified_chains[0], sizeof(net_nfc_verified_chain_s) * i);
+
+			if (now - found.verified_time < NET_NFC_VERIFIED_CHAIN_CACHE_TTL)
+			{
+				verified_chains[0] = found;
+				result = true;
+			}
+			else
+			{
+				/* expired, certificates should be checked again */
+				memmove(&verified_chains[0], &verified_chains[1], sizeof(net_nfc_verified_chain_s) * (verified_chain_count - 1));
+				verified_chain_count--;
+			}
+			break;
+		}
+	}
+
+	G_UNLOCK(verified_chains);
+
+	return result;
+}
+
+static void _add_verified_chain(uint8_t *digest)
+{
+	G_LOCK(verified_chains);
+
+	if (verified_chain_count < NET_NFC_VERIFIED_CHAIN_CACHE_SIZE)
+		verified_chain_count++;
+
+	/* the least recently used one is dropped when full */
+	memmove(&verified_chains[1], &verified_chains[0], sizeof(net_nfc_verified_chain_s) * (verified_chain_count - 1));
+
+	memcpy(verified_chains[0].digest, digest, SHA256_DIGEST_LENGTH);
+	verified_chains[0].verified_time = g_get_monotonic_time();
+
+	G_UNLOCK(verified_chains);
+}
+
+net_nfc_openssl_verify_context_s *net_nfc_util_openssl_init_verify_certificate(void)
+{
+	net_nfc_openssl_verify_context_s *result = NULL;
+
+	_net_nfc_util_alloc_mem(result, sizeof(net_nfc_openssl_verify_context_s));
+	if (result == NULL)
 	{
 		DEBUG_ERR_MSG("alloc failed [%d]", sizeof(net_nfc_openssl_verify_context_s));
 	}
@@ -158,11 +285,11 @@ void net_nfc_util_openssl_release_verify_certificate(net_nfc_openssl_verify_cont
 {
 	if (context != NULL)
 	{
-		if (context->signer_cert != NULL)
-			X509_free(context->signer_cert);
+		if (context->signer_buffer != NULL)
+			_net_nfc_util_free_mem(context->signer_buffer);
 
-		if (context->store != NULL)
-			X509_STORE_free(context->store);
+		if (context->ca_buffer != NULL)
+			_net_nfc_util_free_mem(context->ca_buffer);
 
 		_net_nfc_util_free_mem(context);
 	}
@@ -172,15 +299,23 @@ bool net_nfc_util_openssl_add_certificate_of_signer(net_nfc_openssl_verify_conte
 {
 	bool result = false;
 
-	if (context->signer_cert != NULL)
+	if (context == NULL || buffer == NULL || length == 0)
+		return result;
+
+	if (context->signer_buffer != NULL)
 	{
-		X509_free(context->signer_cert);
-		context->signer_cert = NULL;
+		_net_nfc_util_free_mem(context->signer_buffer);
+		context->signer_length = 0;
 	}
 
-	context->signer_cert = _load_certificate_from_mem(1, buffer, length, NULL);
-	if (context->signer_cert != NULL)
+	_net_nfc_util_alloc_mem(context->signer_buffer, length);
+	if (context->signer_buffer != NULL)
+	{
+		memcpy(context->signer_buffer, buffer, length);
+		context->signer_length = length;
+
 		result = true;
+	}
 
 	return result;
 }
@@ -188,12 +323,27 @@ bool net_nfc_util_openssl_add_certificate_of_signer(net_nfc_openssl_verify_conte
 bool net_nfc_util_openssl_add_certificate_of_ca(net_nfc_openssl_verify_context_s *context, uint8_t *buffer, uint32_t length)
 {
 	bool result = false;
-	X509 *x509 = NULL;
+	uint8_t *temp = NULL;
 
-	x509 = _load_certificate_from_mem(1, buffer, length, NULL);
-	if (x509 != NULL)
+	if (context == NULL || buffer == NULL || length == 0)
+		return result;
+
+	/* certificates are stored as 4 bytes length followed by data */
+	_net_nfc_util_alloc_mem(temp, context->ca_length + sizeof(length) + length);
+	if (temp != NULL)
 	{
-		X509_STORE_add_cert(context->store, x509);
+		if (context->ca_buffer != NULL)
+		{
+			memcpy(temp, context->ca_buffer, context->ca_length);
+			_net_nfc_util_free_mem(context->ca_buffer);
+		}
+
+		memcpy(temp + context->ca_length, &length, sizeof(length));
+		memcpy(temp + context->ca_length + sizeof(length), buffer, length);
+
+		context->ca_buffer = temp;
+		context->ca_length += sizeof(length) + length;
+		context->ca_count++;
 
 		result = true;
 	}
@@ -204,13 +354,56 @@ bool net_nfc_util_openssl_add_certificate_of_ca(net_nfc_openssl_verify_context_s
 int net_nfc_util_openssl_verify_certificate(net_nfc_openssl_verify_context_s *context)
 {
 	int result = 0;
+	uint8_t digest[SHA256_DIGEST_LENGTH];
+	bool digest_valid = false;
+	X509_STORE *store = NULL;
 	X509_STORE_CTX *store_ctx = NULL;
+	X509 *signer_cert = NULL;
+	STACK_OF(X509) *ca_certs = NULL;
+	uint32_t offset = 0;
+
+	if (context == NULL || context->signer_buffer == NULL)
+		return result;
+
+	digest_valid = _get_chain_digest(context, digest);
+	if (digest_valid == true && _find_verified_chain(digest) == true)
+	{
+		DEBUG_MSG("certificate chain is found in cache");
+
+		return true;
+	}
+
+	if ((store = _get_trusted_store()) == NULL)
+		return result;
+
+	signer_cert = _load_certificate_from_mem(1, context->signer_buffer, context->signer_length, NULL);
+	if (signer_cert == NULL)
+	{
+		DEBUG_ERR_MSG("loading signer certificate failed");
+		return result;
+	}
+
+	/* certificates in message are intermediates, trust comes from the store */
+	ca_certs = sk_X509_new_null();
+	while (ca_certs != NULL && offset + sizeof(uint32_t) <= context->ca_length)
+	{
+		X509 *x509 = NULL;
+		uint32_t length = 0;
+
+		memcpy(&length, context->ca_buffer + offset, sizeof(length));
+		offset += sizeof(length);
+
+		x509 = _load_certificate_from_mem(1, context->ca_buffer + offset, length, NULL);
+		if (x509 != NULL)
+			sk_X509_push(ca_certs, x509);
+
+		offset += length;
+	}
 
 	store_ctx = X509_STORE_CTX_new();
 	if (store_ctx != NULL)
 	{
-		X509_STORE_set_flags(context->store, 0);
-		if (X509_STORE_CTX_init(store_ctx, context->store, context->signer_cert, 0) == true)
+		if (X509_STORE_CTX_init(store_ctx, store, signer_cert, ca_certs) == true)
 		{
 			result = X509_verify_cert(store_ctx);
 		}
@@ -226,6 +419,14 @@ int net_nfc_util_openssl_verify_certificate(net_nfc_openssl_verify_context_s *co
 		DEBUG_ERR_MSG("X509_STORE_CTX_new failed");
 	}
 
+	if (result == true && digest_valid == true)
+		_add_verified_chain(digest);
+
+	if (ca_certs != NULL)
+		sk_X509_pop_free(ca_certs, X509_free);
+
+	X509_free(signer_cert);
+
 	return result;
 }
 
@@ -445,128 +646,239 @@ EVP_PKEY *_load_pubkey(const char *file, int format, const char *pass, ENGINE *e
 	return pkey;
 }
 
-int net_nfc_util_openssl_sign_buffer(uint32_t type, uint8_t *buffer, uint32_t length, char *key_file, char *password, uint8_t *sign, uint32_t *sign_len)
+static bool _get_signature_algorithm(uint32_t type, const EVP_MD **md, ENGINE **engine)
 {
-	int result = 0;
-	const EVP_MD *md = NULL;
-	ENGINE *engine;
-	EVP_PKEY *pkey;
-
-	OpenSSL_add_all_algorithms();
-
-	/* md context */
-	EVP_MD_CTX ctx = { 0, };
-	EVP_PKEY_CTX *pctx = NULL;
+	bool result = true;
 
 	switch (type)
 	{
-	case 0 :
-		result = 0;
-		return result;
-
 		/* RSASSA-PSS, RSASSA-PKCS1-v1_5 */
 	case 1 :
-		case 2 :
+	case 2 :
 		/* md */
-		md = EVP_get_digestbyname("sha1");
+		*md = EVP_get_digestbyname("sha1");
 
 		/* engine */
-		engine = ENGINE_get_default_RSA();
+		*engine = ENGINE_get_default_RSA();
 		break;
 
 		/* DSA */
 	case 3 :
 		/* md */
-		//md = EVP_get_digestbyname("sha1");
+		//*md = EVP_get_digestbyname("sha1");
 		/* engine */
-		engine = ENGINE_get_default_DSA();
+		*engine = ENGINE_get_default_DSA();
 		break;
 
 		/* ECDSA */
 	case 4 :
 		/* md */
-		md = EVP_get_digestbyname("sha1");
+		*md = EVP_get_digestbyname("sha1");
 
 		/* engine */
-		engine = ENGINE_get_default_ECDSA();
+		*engine = ENGINE_get_default_ECDSA();
 		break;
 
 	default :
-		result = -1;
+		DEBUG_ERR_MSG("not supported signature type [%d]", type);
+		result = false;
+		break;
+	}
+
+	return result;
+}
+
+static net_nfc_openssl_signature_context_s *_init_signature(uint32_t type, EVP_PKEY *pkey, bool verify)
+{
+	net_nfc_openssl_signature_context_s *result = NULL;
+	const EVP_MD *md = NULL;
+	ENGINE *engine = NULL;
+	int ret;
+
+	_init_algorithms();
+
+	if (pkey == NULL)
+	{
+		DEBUG_ERR_MSG("key not found");
 		return result;
 	}
 
+	if (_get_signature_algorithm(type, &md, &engine) == false)
+	{
+		EVP_PKEY_free(pkey);
+		return result;
+	}
+
+	_net_nfc_util_alloc_mem(result, sizeof(net_nfc_openssl_signature_context_s));
+	if (result != NULL)
+	{
+		result->pkey = pkey;
+		result->verify = verify;
+		result->md_ctx = EVP_MD_CTX_create();
+
+		if (result->md_ctx != NULL)
+		{
+			if (verify == true)
+				ret = EVP_DigestVerifyInit(result->md_ctx, NULL, md, engine, pkey);
+			else
+				ret = EVP_DigestSignInit(result->md_ctx, NULL, md, engine, pkey);
+
+			if (ret != 1)
+			{
+				DEBUG_ERR_MSG("EVP_Digest%sInit failed", verify ? "Verify" : "Sign");
+				net_nfc_util_openssl_release_signature(result);
+				result = NULL;
+			}
+		}
+		else
+		{
+			DEBUG_ERR_MSG("EVP_MD_CTX_create failed");
+			net_nfc_util_openssl_release_signature(result);
+			result = NULL;
+		}
+	}
+	else
+	{
+		DEBUG_ERR_MSG("alloc failed [%d]", sizeof(net_nfc_openssl_signature_context_s));
+		EVP_PKEY_free(pkey);
+	}
+
+	return result;
+}
+
+net_nfc_openssl_signature_context_h net_nfc_util_openssl_init_sign(uint32_t type, char *key_file, char *password)
+{
+	return _init_signature(type, _load_key(key_file, OPENSSL_FORMAT_PKCS12, password, NULL), false);
+}
+
+net_nfc_openssl_signature_context_h net_nfc_util_openssl_init_sign_with_key(uint32_t type, net_nfc_sign_key_s *key)
+{
+	if (key == NULL || key->pkey == NULL)
+		return NULL;
+
+	/* signature context releases its own reference */
+#if OPENSSL_VERSION_NUMBER < 0x10100000L
+	CRYPTO_add(&key->pkey->references, 1, CRYPTO_LOCK_EVP_PKEY);
+#else
+	EVP_PKEY_up_ref(key->pkey);
+#endif
+
+	return _init_signature(type, key->pkey, false);
+}
+
+net_nfc_openssl_signature_context_h net_nfc_util_openssl_init_verify_signature(uint32_t type, uint8_t *cert, uint32_t cert_len)
+{
+	EVP_PKEY *pkey = NULL;
+	X509 *x509 = NULL;
+
 	/* pkey */
-	pkey = _load_key(key_file, OPENSSL_FORMAT_PKCS12, password, NULL);
+	x509 = _load_certificate_from_mem(0, cert, cert_len, NULL);
+	if (x509 != NULL)
+	{
+		pkey = X509_PUBKEY_get(X509_get_X509_PUBKEY(x509));
+		X509_free(x509);
+	}
+
+	return _init_signature(type, pkey, true);
+}
+
+bool net_nfc_util_openssl_update_signature(net_nfc_openssl_signature_context_h context, uint8_t *buffer, uint32_t length)
+{
+	int ret;
 
-	EVP_DigestSignInit(&ctx, &pctx, md, engine, pkey);
-	EVP_DigestSignUpdate(&ctx, buffer, length);
-	EVP_DigestSignFinal(&ctx, sign, sign_len);
+	if (context == NULL)
+		return false;
+
+	if (buffer == NULL || length == 0)
+		return true;
+
+	if (context->verify == true)
+		ret = EVP_DigestVerifyUpdate(context->md_ctx, buffer, length);
+	else
+		ret = EVP_DigestSignUpdate(context->md_ctx, buffer, length);
+
+	return (ret == 1);
+}
+
+int net_nfc_util_openssl_sign_final(net_nfc_openssl_signature_context_h context, uint8_t *sign, uint32_t *sign_len)
+{
+	int result = 0;
+	size_t len;
+
+	if (context == NULL || context->verify == true || sign == NULL || sign_len == NULL)
+		return result;
+
+	len = *sign_len;
+	result = EVP_DigestSignFinal(context->md_ctx, sign, &len);
+	*sign_len = len;
 
 	return result;
 }
 
-int net_nfc_util_openssl_verify_signature(uint32_t type, uint8_t *buffer, uint32_t length, uint8_t *cert, uint32_t cert_len, uint8_t *sign, uint32_t sign_len)
+int net_nfc_util_openssl_verify_final(net_nfc_openssl_signature_context_h context, uint8_t *sign, uint32_t sign_len)
 {
 	int result = 0;
-	const EVP_MD *md = NULL;
-	ENGINE *engine;
-	EVP_PKEY *pkey;
 
-	OpenSSL_add_all_algorithms();
+	if (context == NULL || context->verify == false)
+		return result;
 
-	/* md context */
-	EVP_MD_CTX ctx = { 0, };
-	EVP_PKEY_CTX *pctx = NULL;
+	result = EVP_DigestVerifyFinal(context->md_ctx, sign, sign_len);
 
-	switch (type)
+	DEBUG_MSG("EVP_DigestVerifyFinal returns %d", result);
+
+	return result;
+}
+
+void net_nfc_util_openssl_release_signature(net_nfc_openssl_signature_context_h context)
+{
+	if (context != NULL)
 	{
-	case 0 :
-		result = 0;
+		if (context->md_ctx != NULL)
+			EVP_MD_CTX_destroy(context->md_ctx);
+
+		if (context->pkey != NULL)
+			EVP_PKEY_free(context->pkey);
+
+		_net_nfc_util_free_mem(context);
+	}
+}
+
+int net_nfc_util_openssl_sign_buffer(uint32_t type, uint8_t *buffer, uint32_t length, char *key_file, char *password, uint8_t *sign, uint32_t *sign_len)
+{
+	int result = 0;
+	net_nfc_openssl_signature_context_h context = NULL;
+
+	if (type == 0)
 		return result;
 
-		/* RSASSA-PSS, RSASSA-PKCS1-v1_5 */
-	case 1 :
-	case 2 :
-		/* md */
-		md = EVP_get_digestbyname("sha1");
+	context = net_nfc_util_openssl_init_sign(type, key_file, password);
+	if (context == NULL)
+		return -1;
 
-		/* engine */
-		engine = ENGINE_get_default_RSA();
-		break;
+	if (net_nfc_util_openssl_update_signature(context, buffer, length) == true)
+		result = net_nfc_util_openssl_sign_final(context, sign, sign_len);
 
-		/* DSA */
-	case 3 :
-		/* md */
-		//md = EVP_get_digestbyname("sha1");
-		/* engine */
-		engine = ENGINE_get_default_DSA();
-		break;
+	net_nfc_util_openssl_release_signature(context);
 
-		/* ECDSA */
-	case 4 :
-		/* md */
-		md = EVP_get_digestbyname("sha1");
+	return result;
+}
 
-		/* engine */
-		engine = ENGINE_get_default_ECDSA();
-		break;
+int net_nfc_util_openssl_verify_signature(uint32_t type, uint8_t *buffer, uint32_t length, uint8_t *cert, uint32_t cert_len, uint8_t *sign, uint32_t sign_len)
+{
+	int result = 0;
+	net_nfc_openssl_signature_context_h context = NULL;
 
-	default :
-		result = -1;
+	if (type == 0)
 		return result;
-	}
 
-	/* pkey */
-	X509 *x509 = _load_certificate_from_mem(0, cert, cert_len, NULL);
-	pkey = X509_PUBKEY_get(X509_get_X509_PUBKEY(x509));
-	X509_free(x509);
+	context = net_nfc_util_openssl_init_verify_signature(type, cert, cert_len);
+	if (context == NULL)
+		return -1;
 
-	EVP_DigestVerifyInit(&ctx, &pctx, md, engine, pkey);
-	EVP_DigestVerifyUpdate(&ctx, buffer, length);
-	result = EVP_DigestVerifyFinal(&ctx, sign, sign_len);
+	if (net_nfc_util_openssl_update_signature(context, buffer, length) == true)
+		result = net_nfc_util_openssl_verify_final(context, sign, sign_len);
 
-	DEBUG_MSG("EVP_DigestVerifyFinal returns %d", result);
+	net_nfc_util_openssl_release_signature(context);
 
 	return result;
 }
@@ -648,6 +960,82 @@ int net_nfc_util_get_cert_list_from_file(char *file_name, char *password, uint8_
 }
 #endif
 
+/* certificates are stored as 2 bytes length followed by DER data */
+static bool _serialize_cert_list(X509 *x509, STACK_OF(X509) *ca, uint8_t **buffer, uint32_t *length, uint32_t *cert_count)
+{
+	X509 *temp_x509;
+	int i;
+	uint32_t temp_len = 0;
+	uint8_t *temp_buf = NULL;
+	uint32_t offset = 0;
+	uint32_t count = 0;
+	int32_t ret = 0;
+
+	if ((ret = i2d_X509(x509, NULL)) > 0)
+	{
+		temp_len += (ret + 2);
+	}
+
+	for (i = 0; i < sk_X509_num(ca); i++)
+	{
+		temp_x509 = sk_X509_value(ca, i);
+		if (temp_x509)
+		{
+			if ((ret = i2d_X509(temp_x509, NULL)) > 0)
+			{
+				temp_len += (ret + 2);
+			}
+		}
+	}
+
+	DEBUG_MSG("count = %d, length = %d", sk_X509_num(ca) + 1, temp_len);
+
+	_net_nfc_util_alloc_mem(*buffer, temp_len);
+	if (*buffer == NULL)
+		return false;
+
+	*length = temp_len;
+
+	if ((temp_len = i2d_X509(x509, &temp_buf)) > 0)
+	{
+		*(uint16_t *)(*buffer + offset) = temp_len;
+		offset += sizeof(uint16_t);
+
+		memcpy(*buffer + offset, temp_buf, temp_len);
+		offset += temp_len;
+
+		OPENSSL_free(temp_buf);
+
+		count++;
+	}
+
+	for (i = 0; i < sk_X509_num(ca); i++)
+	{
+		temp_x509 = sk_X509_value(ca, i);
+		if (temp_x509)
+		{
+			temp_buf = NULL;
+
+			if ((temp_len = i2d_X509(temp_x509, &temp_buf)) > 0)
+			{
+				*(uint16_t *)(*buffer + offset) = temp_len;
+				offset += sizeof(uint16_t);
+
+				memcpy(*buffer + offset, temp_buf, temp_len);
+				offset += temp_len;
+
+				OPENSSL_free(temp_buf);
+
+				count++;
+			}
+		}
+	}
+
+	*cert_count = count;
+
+	return true;
+}
+
 /* TODO : DER?? PEM?? */
 int net_nfc_util_get_cert_list_from_file(char *file_name, char *password, uint8_t **buffer, uint32_t *length, uint32_t *cert_count)
 {
@@ -665,78 +1053,96 @@ int net_nfc_util_get_cert_list_from_file(char *file_name, char *password, uint8_
 
 			if (_load_pkcs12(bio, password, &pkey, &x509, &ca) != 0)
 			{
-				X509 *temp_x509;
-				int i;
-				uint32_t temp_len = 0;
-				uint8_t *temp_buf = NULL;
-				uint32_t offset = 0;
-				uint32_t count = 0;
-				int32_t ret = 0;
-
-				if ((ret = i2d_X509(x509, NULL)) > 0)
-				{
-					temp_len += (ret + 2);
-				}
-
-				for (i = 0; i < sk_X509_num(ca); i++)
-				{
-					temp_x509 = sk_X509_value(ca, i);
-					if (temp_x509)
-					{
-						if ((ret = i2d_X509(temp_x509, NULL)) > 0)
-						{
-							temp_len += (ret + 2);
-						}
-					}
-				}
+				_serialize_cert_list(x509, ca, buffer, length, cert_count);
 
-				DEBUG_MSG("count = %d, length = %d", sk_X509_num(ca) + 1, temp_len);
-				*length = temp_len;
-				_net_nfc_util_alloc_mem(*buffer, temp_len);
-
-				if ((temp_len = i2d_X509(x509, &temp_buf)) > 0)
-				{
-					*(uint16_t *)(*buffer + offset) = temp_len;
-					offset += sizeof(uint16_t);
+				sk_X509_pop_free(ca, X509_free);
+				X509_free(x509);
+				EVP_PKEY_free(pkey);
+			}
+			else
+			{
+				DEBUG_ERR_MSG("PEM_X509_INFO_read_bio failed");
+			}
+		}
 
-					memcpy(*buffer + offset, temp_buf, temp_len);
-					offset += temp_len;
+		BIO_free(bio);
+	}
 
-					count++;
-				}
+	return result;
+}
 
-				for (i = 0; i < sk_X509_num(ca); i++)
-				{
-					temp_x509 = sk_X509_value(ca, i);
-					if (temp_x509)
-					{
-						temp_buf = NULL;
+net_nfc_sign_key_s *net_nfc_util_openssl_load_sign_key(char *key_file, char *password)
+{
+	net_nfc_sign_key_s *result = NULL;
+	BIO *bio = NULL;
+	EVP_PKEY *pkey = NULL;
+	X509 *x509 = NULL;
+	STACK_OF(X509) *ca = NULL;
 
-						if ((temp_len = i2d_X509(temp_x509, &temp_buf)) > 0)
-						{
-							*(uint16_t *)(*buffer + offset) = temp_len;
-							offset += sizeof(uint16_t);
+	if (key_file == NULL)
+	{
+		DEBUG_ERR_MSG("no keyfile specified");
+		return result;
+	}
 
-							memcpy(*buffer + offset, temp_buf, temp_len);
-							offset += temp_len;
+	_init_algorithms();
 
-							count++;
-						}
-					}
-				}
+	bio = BIO_new(BIO_s_file());
+	if (bio == NULL)
+	{
+		DEBUG_ERR_MSG("BIO_new failed");
+		return result;
+	}
 
-				*cert_count = count;
+	/* key and certificate chain are parsed once, they are used for every signing */
+	if (BIO_read_filename(bio, key_file) > 0 && _load_pkcs12(bio, password, &pkey, &x509, &ca) != 0)
+	{
+		_net_nfc_util_alloc_mem(result, sizeof(net_nfc_sign_key_s));
+		if (result != NULL)
+		{
+			pthread_mutex_init(&result->lock, NULL);
+			result->pkey = pkey;
+			pkey = NULL;
 
-				sk_X509_pop_free(ca, X509_free);
-			}
-			else
+			if (_serialize_cert_list(x509, ca, &result->cert_buffer, &result->cert_len, &result->cert_count) == false)
 			{
-				DEBUG_ERR_MSG("PEM_X509_INFO_read_bio failed");
+				DEBUG_ERR_MSG("_serialize_cert_list failed");
+
+				net_nfc_util_openssl_release_sign_key(result);
+				result = NULL;
 			}
 		}
+		else
+		{
+			DEBUG_ERR_MSG("alloc failed [%d]", sizeof(net_nfc_sign_key_s));
+		}
 
-		BIO_free(bio);
+		sk_X509_pop_free(ca, X509_free);
+		X509_free(x509);
+		EVP_PKEY_free(pkey);
 	}
+	else
+	{
+		DEBUG_ERR_MSG("loading %s failed", key_file);
+	}
+
+	BIO_free(bio);
 
 	return result;
 }
+
+void net_nfc_util_openssl_release_sign_key(net_nfc_sign_key_s *key)
+{
+	if (key != NULL)
+	{
+		if (key->pkey != NULL)
+			EVP_PKEY_free(key->pkey);
+
+		if (key->cert_buffer != NULL)
+			_net_nfc_util_free_mem(key->cert_buffer);
+
+		pthread_mutex_destroy(&key->lock);
+
+		_net_nfc_util_free_mem(key);
+	}
+}
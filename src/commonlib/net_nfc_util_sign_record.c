@@ -40,206 +40,148 @@
 
 #define __NEXT_SUB_FIELD(__dst) ((__dst)->value + (__dst)->length)
 
-bool _get_records_data_buffer(ndef_record_s *begin_record, ndef_record_s *end_record, uint8_t **buffer, uint32_t *length)
+static bool _update_records_data(net_nfc_openssl_signature_context_h context, ndef_record_s *begin_record, ndef_record_s *end_record)
 {
-	bool result = false;
-	uint32_t len = 0;
+	bool result = true;
 	ndef_record_s *current_record = NULL;
 
 	if (begin_record == NULL || begin_record == end_record)
-		return result;
+		return false;
 
-	/* count total buffer length */
 	current_record = begin_record;
-	len = 0;
 
-	while (current_record != NULL && current_record != end_record)
+	while (result == true && current_record != NULL && current_record != end_record)
 	{
-		/* type length */
-		if (current_record->type_s.buffer != NULL && current_record->type_s.length > 0)
-			len += current_record->type_s.length;
-
-		/* ID length */
-		if (current_record->id_s.buffer != NULL && current_record->id_s.length > 0)
-			len += current_record->id_s.length;
-
-		/* payload length */
-		if (current_record->payload_s.buffer != NULL && current_record->payload_s.length > 0)
-			len += current_record->payload_s.length;
+		/* type, ID and payload of each record are signed data */
+		result = net_nfc_util_openssl_update_signature(context, current_record->type_s.buffer, current_record->type_s.length)
+			&& net_nfc_util_openssl_update_signature(context, current_record->id_s.buffer, current_record->id_s.length)
+			&& net_nfc_util_openssl_update_signature(context, current_record->payload_s.buffer, current_record->payload_s.length);
 
 		current_record = current_record->next;
 	}
 
-	if (len > 0)
-	{
-		uint8_t *buf = NULL;
-
-		_net_nfc_util_alloc_mem(buf, len);
-		if (buf != NULL)
-		{
-			uint32_t offset = 0;
-
-			current_record = begin_record;
-
-			while (offset < len && current_record != NULL && current_record != end_record)
-			{
-				/* type length */
-				if (current_record->type_s.buffer != NULL && current_record->type_s.length > 0)
-				{
-					memcpy(buf + offset, current_record->type_s.buffer, MIN(current_record->type_s.length, len - offset));
-					offset += MIN(current_record->type_s.length, len - offset);
-				}
-
-				/* ID length */
-				if (current_record->id_s.buffer != NULL && current_record->id_s.length > 0)
-				{
-					memcpy(buf + offset, current_record->id_s.buffer, MIN(current_record->id_s.length, len - offset));
-					offset += MIN(current_record->id_s.length, len - offset);
-				}
-
-				/* payload length */
-				if (current_record->payload_s.buffer != NULL && current_record->payload_s.length > 0)
-				{
-					memcpy(buf + offset, current_record->payload_s.buffer, MIN(current_record->payload_s.length, len - offset));
-					offset += MIN(current_record->payload_s.length, len - offset);
-				}
-
-				current_record = current_record->next;
-			}
-
-			*buffer = buf;
-			*length = offset;
-
-			result = true;
-		}
-	}
-
 	return result;
 }
 
 net_nfc_error_e net_nfc_util_verify_signature_records(ndef_record_s *begin_record, ndef_record_s *sign_record)
 {
 	net_nfc_error_e result = NET_NFC_UNKNOWN_ERROR;
-	uint8_t *buffer = NULL;
-	uint32_t length = 0;
+	uint8_t *signature = NULL;
+	uint32_t sign_len = 0;
+	net_nfc_signature_record_s *sign_info = NULL;
+	net_nfc_certificate_chain_s *chain_info = NULL;
 
 	if (begin_record == NULL || sign_record == NULL || begin_record == sign_record)
 		return NET_NFC_INVALID_PARAM;
 
-	/* get signed data */
-	if (_get_records_data_buffer(begin_record, sign_record, &buffer, &length) == true)
+	/* parse signature info */
+	sign_info = (net_nfc_signature_record_s *)sign_record->payload_s.buffer;
+
+	DEBUG_MSG("record version : %d", sign_info->version);
+	DEBUG_MSG("signature URI present? : %s", sign_info->uri_present ? "true" : "false");
+	DEBUG_MSG("signature type : %d", sign_info->sign_type);
+	DEBUG_MSG("signature length : %d", sign_info->signature.length);
+
+	if (sign_info->uri_present == true)
 	{
-		uint8_t *signature = NULL;
-		uint32_t sign_len = 0;
-		net_nfc_signature_record_s *sign_info = NULL;
-		net_nfc_certificate_chain_s *chain_info = NULL;
+		/* TODO */
+		/* receive the signature data directed by uri */
+		DEBUG_ERR_MSG("NOT IMPLEMENTED (sign_info->uri_present == true)");
+		return result;
+	}
+	else
+	{
+		signature = sign_info->signature.value;
+		sign_len = sign_info->signature.length;
+	}
 
-		/* parse signature info */
-		sign_info = (net_nfc_signature_record_s *)sign_record->payload_s.buffer;
+	/* parse certificate chain info */
+	chain_info = (net_nfc_certificate_chain_s *)__NEXT_SUB_FIELD(&(sign_info->signature));
 
-		DEBUG_MSG("record version : %d", sign_info->version);
-		DEBUG_MSG("signature URI present? : %s", sign_info->uri_present ? "true" : "false");
-		DEBUG_MSG("signature type : %d", sign_info->sign_type);
-		DEBUG_MSG("signature length : %d", sign_info->signature.length);
+	DEBUG_MSG("certificate URI present? : %s", chain_info->uri_present ? "true" : "false");
+	DEBUG_MSG("certificate format : %d", chain_info->cert_format);
+	DEBUG_MSG("number of certificates : %d", chain_info->num_of_certs);
 
-		if (sign_info->uri_present == true)
-		{
-			/* TODO */
-			/* receive the signature data directed by uri */
-			DEBUG_ERR_MSG("NOT IMPLEMENTED (sign_info->uri_present == true)");
-			_net_nfc_util_free_mem(buffer);
-			return result;
-		}
-		else
-		{
-			signature = sign_info->signature.value;
-			sign_len = sign_info->signature.length;
-		}
+	if (chain_info->num_of_certs > 0)
+	{
+		net_nfc_sub_field_s *data_info = NULL;
+		net_nfc_openssl_signature_context_h sign_context = NULL;
+		bool verified = false;
 
-		/* parse certificate chain info */
-		chain_info = (net_nfc_certificate_chain_s *)__NEXT_SUB_FIELD(&(sign_info->signature));
+		data_info = (net_nfc_sub_field_s *)chain_info->cert_store;
+		DEBUG_MSG("certficate length : %d", data_info->length);
 
-		DEBUG_MSG("certificate URI present? : %s", chain_info->uri_present ? "true" : "false");
-		DEBUG_MSG("certificate format : %d", chain_info->cert_format);
-		DEBUG_MSG("number of certificates : %d", chain_info->num_of_certs);
+//		DEBUG_MSG_PRINT_BUFFER(data_info->value, data_info->length);
 
-		if (chain_info->num_of_certs > 0)
+		/* the first certificate is signer's one
+		 * verify signature of content, records are digested one by one */
+		sign_context = net_nfc_util_openssl_init_verify_signature(sign_info->sign_type, data_info->value, data_info->length);
+		if (sign_context != NULL)
 		{
-			net_nfc_sub_field_s *data_info = NULL;
-
-			data_info = (net_nfc_sub_field_s *)chain_info->cert_store;
-			DEBUG_MSG("certficate length : %d", data_info->length);
+			if (_update_records_data(sign_context, begin_record, sign_record) == true)
+				verified = (net_nfc_util_openssl_verify_final(sign_context, signature, sign_len) == true);
 
-	//		DEBUG_MSG_PRINT_BUFFER(data_info->value, data_info->length);
+			net_nfc_util_openssl_release_signature(sign_context);
+		}
 
-			/* the first certificate is signer's one
-			 * verify signature of content */
-			if (net_nfc_util_openssl_verify_signature(sign_info->sign_type, buffer, length, data_info->value, data_info->length, sign_info->signature.value, sign_info->signature.length) == true)
+		if (verified == true)
+		{
+			if (chain_info->num_of_certs > 1)
 			{
-				if (chain_info->num_of_certs > 1)
-				{
-					int32_t i = 0;
-					net_nfc_openssl_verify_context_h context = NULL;
+				int32_t i = 0;
+				net_nfc_openssl_verify_context_h context = NULL;
 
-					/* initialize context of verifying certificate */
-					context = net_nfc_util_openssl_init_verify_certificate();
+				/* initialize context of verifying certificate */
+				context = net_nfc_util_openssl_init_verify_certificate();
 
-					/* add signer's certificate */
-					net_nfc_util_openssl_add_certificate_of_signer(context, data_info->value, data_info->length);
+				/* add signer's certificate */
+				net_nfc_util_openssl_add_certificate_of_signer(context, data_info->value, data_info->length);
 
-					/* verify certificate using certificate chain */
-					for (i = 1, data_info = (net_nfc_sub_field_s *)__NEXT_SUB_FIELD(data_info);
-						i < chain_info->num_of_certs;
-						i++, data_info = (net_nfc_sub_field_s *)__NEXT_SUB_FIELD(data_info))
-					{
-						DEBUG_MSG("certficate length : %d", data_info->length);
+				/* verify certificate using certificate chain */
+				for (i = 1, data_info = (net_nfc_sub_field_s *)__NEXT_SUB_FIELD(data_info);
+					i < chain_info->num_of_certs;
+					i++, data_info = (net_nfc_sub_field_s *)__NEXT_SUB_FIELD(data_info))
+				{
+					DEBUG_MSG("certficate length : %d", data_info->length);
 //						DEBUG_MSG_PRINT_BUFFER(data_info->value, data_info->length);
 
-						net_nfc_util_openssl_add_certificate_of_ca(context, data_info->value, data_info->length);
-					}
+					net_nfc_util_openssl_add_certificate_of_ca(context, data_info->value, data_info->length);
+				}
 
-					/* if the CA_Uri is present, continue adding certificate from uri */
-					if (chain_info->uri_present == true)
-					{
-						/* TODO */
-						DEBUG_ERR_MSG("NOT IMPLEMENTED (found_root == false && chain_info->uri_present == true)");
-						net_nfc_util_openssl_release_verify_certificate(context);
-						_net_nfc_util_free_mem(buffer);
-						return result;
+				/* if the CA_Uri is present, continue adding certificate from uri */
+				if (chain_info->uri_present == true)
+				{
+					/* TODO */
+					DEBUG_ERR_MSG("NOT IMPLEMENTED (found_root == false && chain_info->uri_present == true)");
+					net_nfc_util_openssl_release_verify_certificate(context);
+					return result;
 
-						DEBUG_MSG("certficate length : %d", data_info->length);
+					DEBUG_MSG("certficate length : %d", data_info->length);
 //						DEBUG_MSG_PRINT_BUFFER(data_info->value, data_info->length);
-					}
-
-					/* verify buffer with cert chain and signature bytes */
-					if (net_nfc_util_openssl_verify_certificate(context) == true)
-						result = NET_NFC_OK;
-
-					net_nfc_util_openssl_release_verify_certificate(context);
 				}
-				else
-				{
-					/* TODO : test certificate??? */
+
+				/* verify buffer with cert chain and signature bytes */
+				if (net_nfc_util_openssl_verify_certificate(context) == true)
 					result = NET_NFC_OK;
-				}
 
-				DEBUG_MSG("verifying signature %d", result);
+				net_nfc_util_openssl_release_verify_certificate(context);
 			}
 			else
 			{
-				DEBUG_ERR_MSG("verifying signature failed");
+				/* TODO : test certificate??? */
+				result = NET_NFC_OK;
 			}
+
+			DEBUG_MSG("verifying signature %d", result);
 		}
 		else
 		{
-			DEBUG_ERR_MSG("certificate not found");
+			DEBUG_ERR_MSG("verifying signature failed");
 		}
-
-		_net_nfc_util_free_mem(buffer);
 	}
 	else
 	{
-		DEBUG_ERR_MSG("_get_records_data_buffer failed");
+		DEBUG_ERR_MSG("certificate not found");
 	}
 
 	return result;
@@ -281,33 +223,77 @@ net_nfc_error_e net_nfc_util_verify_signature_ndef_message(ndef_message_s *msg)
 /*
  * sign method
  */
-net_nfc_error_e net_nfc_util_sign_records(ndef_message_s *msg, int begin_index, int end_index, char *cert_file, char *password)
+net_nfc_error_e net_nfc_util_create_sign_key(net_nfc_sign_key_s **key, char *cert_file, char *password)
+{
+	if (key == NULL || cert_file == NULL || password == NULL)
+		return NET_NFC_NULL_PARAMETER;
+
+	*key = net_nfc_util_openssl_load_sign_key(cert_file, password);
+	if (*key == NULL)
+		return NET_NFC_UNKNOWN_ERROR;
+
+	return NET_NFC_OK;
+}
+
+net_nfc_error_e net_nfc_util_free_sign_key(net_nfc_sign_key_s *key)
+{
+	if (key == NULL)
+		return NET_NFC_NULL_PARAMETER;
+
+	net_nfc_util_openssl_release_sign_key(key);
+
+	return NET_NFC_OK;
+}
+
+net_nfc_error_e net_nfc_util_sign_records_with_key(ndef_message_s *msg, int begin_index, int end_index, net_nfc_sign_key_s *key)
 {
 	net_nfc_error_e result = NET_NFC_UNKNOWN_ERROR;
 	ndef_record_s *begin_record = NULL, *end_record = NULL, *record = NULL;
 	data_s payload = { NULL, 0 };
-	uint8_t *data_buffer = NULL;
-	uint32_t data_len = 0;
+	net_nfc_openssl_signature_context_h sign_context = NULL;
 	uint8_t signature[1024] = { 0, };
 	uint32_t sign_len = sizeof(signature);
 	uint8_t *cert_buffer = NULL;
 	uint32_t cert_len = 0;
 	uint32_t cert_count = 0;
+	bool signed_data = false;
+
+	if (msg == NULL || key == NULL)
+		return NET_NFC_NULL_PARAMETER;
 
-	net_nfc_util_get_record_by_index(msg, begin_index, &begin_record);
-	net_nfc_util_get_record_by_index(msg, end_index, &end_record);
+	if (net_nfc_util_get_record_by_index(msg, begin_index, &begin_record) != NET_NFC_OK
+		|| net_nfc_util_get_record_by_index(msg, end_index, &end_record) != NET_NFC_OK)
+		return NET_NFC_INVALID_PARAM;
 
 	DEBUG_MSG("total record count : %d, begin_index : %d, end_index : %d", msg->recordCount, begin_index, end_index);
 
-	/* get target data */
-	_get_records_data_buffer(begin_record, end_record->next, &data_buffer, &data_len);
+	/* sign target data, key can be used by one thread at a time */
+	pthread_mutex_lock(&key->lock);
+
+	sign_context = net_nfc_util_openssl_init_sign_with_key(NET_NFC_SIGN_TYPE_PKCS_1, key);
+	if (sign_context != NULL)
+	{
+		if (_update_records_data(sign_context, begin_record, end_record->next) == true
+			&& net_nfc_util_openssl_sign_final(sign_context, signature, &sign_len) == true)
+		{
+			signed_data = true;
+		}
+
+		net_nfc_util_openssl_release_signature(sign_context);
+	}
 
-	DEBUG_MSG_PRINT_BUFFER(data_buffer, data_len);
+	pthread_mutex_unlock(&key->lock);
 
-	net_nfc_util_openssl_sign_buffer(NET_NFC_SIGN_TYPE_PKCS_1, data_buffer, data_len, cert_file, password, signature, &sign_len);
+	if (signed_data == false)
+	{
+		DEBUG_ERR_MSG("signing records failed");
+		return result;
+	}
 
-	/* get cert chain */
-	net_nfc_util_get_cert_list_from_file(cert_file, password, &cert_buffer, &cert_len, &cert_count);
+	/* cert chain */
+	cert_buffer = key->cert_buffer;
+	cert_len = key->cert_len;
+	cert_count = key->cert_count;
 
 	/* create payload */
 	payload.length = sizeof(net_nfc_signature_record_s) + sign_len + sizeof(net_nfc_certificate_chain_s) + cert_len;
@@ -354,24 +340,57 @@ net_nfc_error_e net_nfc_util_sign_records(ndef_message_s *msg, int begin_index,
 	net_nfc_util_create_record(NET_NFC_RECORD_WELL_KNOWN_TYPE, &type, NULL, &payload, &record);
 
 	/* get last record index */
-	net_nfc_util_append_record_by_index(msg, end_index + 1, record);
+	if ((result = net_nfc_util_append_record_by_index(msg, end_index + 1, record)) != NET_NFC_OK)
+	{
+		DEBUG_ERR_MSG("net_nfc_util_append_record_by_index failed [%d]", result);
+		net_nfc_util_free_record(record);
+	}
 
 	_net_nfc_util_free_mem(payload.buffer);
-	_net_nfc_util_free_mem(cert_buffer);
-	_net_nfc_util_free_mem(data_buffer);
 
 	return result;
 }
 
-net_nfc_error_e net_nfc_util_sign_ndef_message(ndef_message_s *msg, char *cert_file, char *password)
+net_nfc_error_e net_nfc_util_sign_ndef_message_with_key(ndef_message_s *msg, net_nfc_sign_key_s *key)
 {
 	net_nfc_error_e result = NET_NFC_UNKNOWN_ERROR;
 
+	if (msg == NULL || key == NULL)
+		return NET_NFC_NULL_PARAMETER;
+
 	if (msg->recordCount > 0)
 	{
-		net_nfc_util_sign_records(msg, 0, msg->recordCount - 1, cert_file, password);
+		result = net_nfc_util_sign_records_with_key(msg, 0, msg->recordCount - 1, key);
+	}
+
+	return result;
+}
+
+net_nfc_error_e net_nfc_util_sign_records(ndef_message_s *msg, int begin_index, int end_index, char *cert_file, char *password)
+{
+	net_nfc_error_e result = NET_NFC_UNKNOWN_ERROR;
+	net_nfc_sign_key_s *key = NULL;
+
+	if ((result = net_nfc_util_create_sign_key(&key, cert_file, password)) == NET_NFC_OK)
+	{
+		result = net_nfc_util_sign_records_with_key(msg, begin_index, end_index, key);
+
+		net_nfc_util_free_sign_key(key);
+	}
+
+	return result;
+}
+
+net_nfc_error_e net_nfc_util_sign_ndef_message(ndef_message_s *msg, char *cert_file, char *password)
+{
+	net_nfc_error_e result = NET_NFC_UNKNOWN_ERROR;
+	net_nfc_sign_key_s *key = NULL;
+
+	if ((result = net_nfc_util_create_sign_key(&key, cert_file, password)) == NET_NFC_OK)
+	{
+		result = net_nfc_util_sign_ndef_message_with_key(msg, key);
 
-		result = NET_NFC_OK;
+		net_nfc_util_free_sign_key(key);
 	}
 
 	return result;
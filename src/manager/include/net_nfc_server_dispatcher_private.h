@@ -23,7 +23,7 @@
 void net_nfc_dispatcher_queue_push(net_nfc_request_msg_t* req_msg);
 bool net_nfc_dispatcher_start_thread();
 void net_nfc_dispatcher_cleanup_queue(void);
-void net_nfc_dispatcher_put_cleaner(void);
+void net_nfc_dispatcher_put_cleaner(int client_sock_fd);
 
 
 #endif
@@ -61,6 +61,7 @@ bool net_nfc_server_unset_server_state(uint32_t state);
 uint32_t net_nfc_server_get_server_state();
 
 bool _net_nfc_send_response_msg (int msg_type, ...);
+bool _net_nfc_send_response_msg_to_client (int client_fd, int msg_type, ...);
 bool _net_nfc_check_client_handle ();
 void net_nfc_server_set_tag_info(void * info);
 net_nfc_current_target_info_s* net_nfc_server_get_tag_info();
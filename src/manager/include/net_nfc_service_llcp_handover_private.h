@@ -32,4 +32,9 @@ net_nfc_error_e net_nfc_service_llcp_handover_send_request_msg(net_nfc_request_c
 bool net_nfc_service_llcp_connection_handover_selector(net_nfc_llcp_state_t *state, net_nfc_error_e *result);
 bool net_nfc_service_llcp_connection_handover_requester(net_nfc_llcp_state_t *state, net_nfc_error_e *result);
 
+void net_nfc_service_llcp_handover_refresh_carrier_cache(net_nfc_conn_handover_carrier_type_e type);
+void net_nfc_service_llcp_handover_refresh_bond_cache(void);
+void net_nfc_service_llcp_handover_release_bond_cache(void);
+void net_nfc_service_llcp_handover_prepare_request(void);
+
 #endif /* NET_NFC_SERVICE_LLCP_HANDOVER_PRVIATE_H_ */
@@ -0,0 +1,39 @@
+/*
+  * Copyright 2012  Samsung Electronics Co., Ltd
+  *
+  * Licensed under the Flora License, Version 1.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+
+  *     http://www.tizenopensource.org/license
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  */
+
+
+#ifndef NET_NFC_SERVICE_LLCP_LINK_PRIVATE_H
+#define NET_NFC_SERVICE_LLCP_LINK_PRIVATE_H
+
+#include "net_nfc_typedef_private.h"
+
+#define NET_NFC_LLCP_LINK_DEFAULT_MIU	128
+#define NET_NFC_LLCP_LINK_MAX_MIU	2175 /* 128 + MIUX (0x7FF) */
+#define NET_NFC_LLCP_LINK_DEFAULT_LTO	100 /* 1 sec */
+#define NET_NFC_LLCP_LINK_MAX_LTO	255
+#define NET_NFC_LLCP_LINK_LTO_STEP	50
+#define NET_NFC_LLCP_LINK_MAX_RW	15 /* 4 bits */
+#define NET_NFC_LLCP_LINK_MAX_CLASS	8
+
+/* link parameters are tuned from the remote configuration and the result of previous links */
+void net_nfc_service_llcp_link_get_local_config(net_nfc_llcp_config_info_s *config);
+void net_nfc_service_llcp_link_set_base_config(net_nfc_llcp_config_info_s *config);
+void net_nfc_service_llcp_link_activated(net_nfc_target_handle_s *handle);
+void net_nfc_service_llcp_link_deactivated(void);
+void net_nfc_service_llcp_link_socket_error(net_nfc_error_e error);
+uint8_t net_nfc_service_llcp_link_get_socket_rw(void);
+
+#endif
@@ -18,6 +18,8 @@
 #ifndef NET_NFC_SERVICE_LLCP_PRIVATE_H
 #define NET_NFC_SERVICE_LLCP_PRIVATE_H
 
+#include <glib.h>
+
 #include "net_nfc_typedef_private.h"
 
 /* define */
@@ -54,6 +56,7 @@
 
 #define SNEP_MAX_BUFFER 128 /* simple NDEF exchange protocol */
 #define CH_MAX_BUFFER 128     /* connection handover */
+#define CH_CARRIER_CONFIG_TIMEOUT 3000 /* ms, carrier config gathering */
 
 typedef enum{
 	NPP_REQ_CONTINUE = 0x00,
@@ -169,6 +172,14 @@ typedef struct _net_nfc_handover_create_config_context_t
 	ndef_message_s *ndef_message;
 	ndef_message_s *requester; /* for low power selector */
 	bool is_low_power;
+
+	/* carriers are gathered at the same time */
+	struct _net_nfc_handover_create_config_context_t *parent; /* context which joins this carrier */
+	GList *carriers; /* carrier contexts, of joining context */
+	int pending; /* number of carriers not completed, of joining context */
+	ndef_record_s *record; /* gathered carrier record */
+	unsigned int timer_id;
+	bool wait_event; /* waiting carrier stack event */
 }
 net_nfc_handover_create_config_context_t;
 
@@ -189,6 +200,8 @@ bool net_nfc_service_llcp_process_send_to_socket(net_nfc_request_msg_t* msg);
 bool net_nfc_service_llcp_process_send_socket(net_nfc_request_msg_t* msg);
 bool net_nfc_service_llcp_process_receive_socket(net_nfc_request_msg_t* msg);
 bool net_nfc_service_llcp_process_receive_from_socket(net_nfc_request_msg_t* msg);
+bool net_nfc_service_llcp_process_send_to_batch(net_nfc_request_msg_t* msg);
+bool net_nfc_service_llcp_process_receive_from_batch(net_nfc_request_msg_t* msg);
 bool net_nfc_service_llcp_process_connect_socket(net_nfc_request_msg_t* msg);
 bool net_nfc_service_llcp_process_connect_sap_socket(net_nfc_request_msg_t* msg);
 bool net_nfc_service_llcp_process_disconnect_socket(net_nfc_request_msg_t* msg);
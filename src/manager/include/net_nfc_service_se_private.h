@@ -24,16 +24,38 @@ typedef struct _se_setting_t
 {
 	net_nfc_target_handle_s *current_ese_handle;
 	void *open_request_trans_param;
+	int open_request_client_fd;
+	bool open_requested;
 }
 se_setting_t;
 
 void net_nfc_service_se_detected(net_nfc_request_msg_t *req_msg);
 
+/* eSE logical channels */
+
+/* returns false if the eSE is not connected yet and has to be switched to wired mode */
+bool net_nfc_service_se_open_ese_channel(int client_fd, void *trans_param);
+/* returns false if handle is not an eSE channel of client_fd, result is NET_NFC_INVALID_HANDLE for channel of other client */
+bool net_nfc_service_se_close_ese_channel(net_nfc_target_handle_s *handle, int client_fd, net_nfc_error_e *result);
+/* closes channels and cancels pending open request of terminated client */
+void net_nfc_service_se_close_ese_channels(int client_fd);
+bool net_nfc_service_se_is_ese_opened(void);
+/* sets channel number to class byte of apdu and returns the handle of eSE, NULL if handle is not an eSE channel of client_fd */
+net_nfc_target_handle_s *net_nfc_service_se_get_ese_channel_handle(net_nfc_target_handle_s *handle, int client_fd, data_s *apdu, net_nfc_error_e *result);
+
 /* TAPI SIM API */
 
 bool net_nfc_service_tapi_init(void);
 void net_nfc_service_tapi_deinit(void);
 bool net_nfc_service_transfer_apdu(data_s *apdu, void *trans_param);
+void net_nfc_service_se_send_apdu_script(net_nfc_request_msg_t *msg);
 bool net_nfc_service_request_atr(void *trans_param);
 
+/* SE transaction events */
+
+/* called in controller callback, events are queued and delivered by dispatcher in one message */
+void net_nfc_service_se_push_event(net_nfc_request_se_event_t *se_event);
+void net_nfc_service_se_flush_events(void);
+void net_nfc_service_se_reschedule_events(void);
+
 #endif
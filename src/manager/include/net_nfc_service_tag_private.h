@@ -24,4 +24,15 @@ data_s* net_nfc_service_tag_process(net_nfc_target_handle_s* handle, int devType
 void net_nfc_service_clean_tag_context(net_nfc_request_target_detected_t* stand_alone, net_nfc_error_e result);
 void net_nfc_service_watch_dog(net_nfc_request_msg_t* req_msg);
 
+/* reads or writes a range of MIFARE classic blocks, each sector is authenticated once */
+void net_nfc_service_tag_mifare_blocks(net_nfc_request_msg_t *msg);
+
+/* sends the commands of a transceive sequence in order and returns all responses at once */
+void net_nfc_service_tag_transceive_sequence(net_nfc_request_msg_t *msg);
+
+/* serves jewel reads from memory image that is loaded once while the tag is connected */
+void net_nfc_service_tag_jewel_read_memory(net_nfc_request_msg_t *msg);
+void net_nfc_service_tag_jewel_update_memory(net_nfc_target_handle_s *handle, net_nfc_transceive_info_s *info);
+void net_nfc_service_tag_jewel_clear_memory(void);
+
 #endif
@@ -22,7 +22,9 @@
 
 bool net_nfc_util_access_control_is_initialized(void);
 void net_nfc_util_access_control_initialize(void);
-void net_nfc_util_access_control_update_list(void);
+/* returns true if acls are read again from secure elements */
+bool net_nfc_util_access_control_update_list(void);
+void net_nfc_util_access_control_invalidate_list(void);
 bool net_nfc_util_access_control_is_authorized_package(const char* pkg_name, uint8_t *aid, uint32_t length);
 void net_nfc_util_access_control_release(void);
 
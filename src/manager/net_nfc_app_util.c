@@ -777,27 +777,134 @@ int net_nfc_app_util_appsvc_launch(const char *operation, const char *uri, const
 	return result;
 }
 
+/* se transaction routing, aid -> package which handled it.
+   aids nobody handles are not cached, a package installed later is found by next transaction */
+static pthread_mutex_t se_route_lock = PTHREAD_MUTEX_INITIALIZER;
+static GHashTable *se_route_table = NULL;
+
+typedef struct _se_transaction_launch_t
+{
+	bundle *bd;
+	data_s aid;
+	char *package;
+}
+se_transaction_launch_t;
+
+static guint _se_route_hash(gconstpointer key)
+{
+	const data_s *aid = (const data_s *)key;
+	guint hash = 5381;
+	uint32_t i;
+
+	for (i = 0; i < aid->length; i++)
+		hash = (hash << 5) + hash + aid->buffer[i];
+
+	return hash;
+}
+
+static gboolean _se_route_equal(gconstpointer a, gconstpointer b)
+{
+	const data_s *aid_a = (const data_s *)a;
+	const data_s *aid_b = (const data_s *)b;
+
+	return (aid_a->length == aid_b->length && memcmp(aid_a->buffer, aid_b->buffer, aid_a->length) == 0);
+}
+
+static void _se_route_free_key(gpointer key)
+{
+	data_s *aid = (data_s *)key;
+
+	net_nfc_util_free_data(aid);
+	_net_nfc_manager_util_free_mem(aid);
+}
+
+static void _se_route_clear(void)
+{
+	pthread_mutex_lock(&se_route_lock);
+
+	if (se_route_table != NULL)
+		g_hash_table_remove_all(se_route_table);
+
+	pthread_mutex_unlock(&se_route_lock);
+}
+
+static void _se_route_add(data_s *aid, const char *package)
+{
+	data_s *key = NULL;
+
+	_net_nfc_manager_util_alloc_mem(key, sizeof(data_s));
+	if (key == NULL)
+		return;
+
+	if (net_nfc_util_alloc_data(key, aid->length) == false)
+	{
+		_net_nfc_manager_util_free_mem(key);
+		return;
+	}
+
+	memcpy(key->buffer, aid->buffer, aid->length);
+
+	pthread_mutex_lock(&se_route_lock);
+
+	if (se_route_table == NULL)
+		se_route_table = g_hash_table_new_full(_se_route_hash, _se_route_equal, _se_route_free_key, g_free);
+
+	g_hash_table_replace(se_route_table, key, g_strdup(package));
+
+	pthread_mutex_unlock(&se_route_lock);
+}
+
+static void _se_route_remove(data_s *aid)
+{
+	pthread_mutex_lock(&se_route_lock);
+
+	if (se_route_table != NULL)
+		g_hash_table_remove(se_route_table, aid);
+
+	pthread_mutex_unlock(&se_route_lock);
+}
+
+/* returns false if aid has not been routed yet */
+static bool _se_route_lookup(data_s *aid, char **package)
+{
+	bool result = false;
+	gpointer value = NULL;
+
+	pthread_mutex_lock(&se_route_lock);
+
+	if (se_route_table != NULL && g_hash_table_lookup_extended(se_route_table, aid, NULL, &value) == TRUE)
+	{
+		*package = g_strdup((const char *)value);
+		result = true;
+	}
+
+	pthread_mutex_unlock(&se_route_lock);
+
+	return result;
+}
+
 static int _pkglist_iter_fn(const char* pkg_name, void *data)
 {
 	int result = 0;
-	const char *aid_string = NULL;
-	uint8_t aid[1024] = { 0, };
-	uint32_t length = sizeof(aid);
-
-	aid_string = appsvc_get_uri((bundle *)data);
-	DEBUG_MSG("package name : %s, aid_string : %s", pkg_name, aid_string);
+	se_transaction_launch_t *launch = (se_transaction_launch_t *)data;
 
-	/* convert aid string to aid */
-	net_nfc_app_util_decode_base64(aid_string, strlen(aid_string), aid, &length);
+	DEBUG_MSG("package name : %s", pkg_name);
 
-	if (net_nfc_util_access_control_is_authorized_package(pkg_name, aid, length) == true)
+	if (net_nfc_util_access_control_is_authorized_package(pkg_name, launch->aid.buffer, launch->aid.length) == true)
 	{
 		DEBUG_MSG("allowed package : %s", pkg_name);
 
 		/* launch */
-		aul_launch_app(pkg_name, (bundle *)data);
+		if (aul_launch_app(pkg_name, launch->bd) >= 0)
+		{
+			launch->package = g_strdup(pkg_name);
 
-		result = 1; /* break iterator */
+			result = 1; /* break iterator */
+		}
+		else
+		{
+			DEBUG_ERR_MSG("launch failed : %s", pkg_name);
+		}
 	}
 	else
 	{
@@ -809,11 +916,49 @@ static int _pkglist_iter_fn(const char* pkg_name, void *data)
 
 gboolean _invoke_get_list(gpointer data)
 {
-	bundle *bd = (bundle *)data;
+	se_transaction_launch_t *launch = (se_transaction_launch_t *)data;
+	char *package = NULL;
+	bool launched = false;
 
-	appsvc_get_list(bd, _pkglist_iter_fn, (bundle *)bd);
+	/* acl decision is cached, so checking it again is cheap */
+	if (_se_route_lookup(&launch->aid, &package) == true
+		&& net_nfc_util_access_control_is_authorized_package(package, launch->aid.buffer, launch->aid.length) == true)
+	{
+		DEBUG_MSG("routed package : %s", package);
 
-	bundle_free(bd);
+		if (aul_launch_app(package, launch->bd) >= 0)
+		{
+			launched = true;
+		}
+		else
+		{
+			/* package may be uninstalled or disabled, find the handler again */
+			DEBUG_ERR_MSG("launch failed, drop route : %s", package);
+
+			_se_route_remove(&launch->aid);
+		}
+	}
+
+	if (launched == false)
+	{
+		appsvc_get_list(launch->bd, _pkglist_iter_fn, launch);
+
+		if (launch->package != NULL)
+		{
+			_se_route_add(&launch->aid, launch->package);
+		}
+		else
+		{
+			DEBUG_MSG("no package handles aid");
+		}
+	}
+
+	g_free(package);
+
+	g_free(launch->package);
+	net_nfc_util_free_data(&launch->aid);
+	bundle_free(launch->bd);
+	_net_nfc_manager_util_free_mem(launch);
 
 	return 0;
 }
@@ -822,7 +967,12 @@ int net_nfc_app_util_launch_se_transaction_app(uint8_t *aid, uint32_t aid_len, u
 {
 	char aid_string[1024] = { 0, };
 	char param_string[1024] = { 0, };
-	bundle *bd = NULL;
+	se_transaction_launch_t *launch = NULL;
+
+	if (aid == NULL || aid_len == 0)
+	{
+		return -1;
+	}
 
 	/* initialize and make list */
 	if (net_nfc_util_access_control_is_initialized() == false)
@@ -830,7 +980,25 @@ int net_nfc_app_util_launch_se_transaction_app(uint8_t *aid, uint32_t aid_len, u
 		net_nfc_util_access_control_initialize();
 	}
 
-	net_nfc_util_access_control_update_list();
+	if (net_nfc_util_access_control_update_list() == true)
+	{
+		/* routes follow acls */
+		_se_route_clear();
+	}
+
+	_net_nfc_manager_util_alloc_mem(launch, sizeof(se_transaction_launch_t));
+	if (launch == NULL)
+	{
+		return -1;
+	}
+
+	if (net_nfc_util_alloc_data(&launch->aid, aid_len) == false)
+	{
+		_net_nfc_manager_util_free_mem(launch);
+		return -1;
+	}
+
+	memcpy(launch->aid.buffer, aid, aid_len);
 
 	/* convert aid to aid string */
 	net_nfc_app_util_encode_base64(aid, aid_len, aid_string, sizeof(aid_string));
@@ -839,14 +1007,14 @@ int net_nfc_app_util_launch_se_transaction_app(uint8_t *aid, uint32_t aid_len, u
 	net_nfc_app_util_encode_base64(param, param_len, param_string, sizeof(param_string));
 	DEBUG_MSG("param_string : %s", param_string);
 
-	/* launch */
-	bd = bundle_create();
+	/* launch, aid string is still delivered to application */
+	launch->bd = bundle_create();
 
-	appsvc_set_operation(bd, "http://tizen.org/appcontrol/operation/nfc_se_transaction");
-	appsvc_set_uri(bd, aid_string);
-	appsvc_add_data(bd, "data", param_string);
+	appsvc_set_operation(launch->bd, "http://tizen.org/appcontrol/operation/nfc_se_transaction");
+	appsvc_set_uri(launch->bd, aid_string);
+	appsvc_add_data(launch->bd, "data", param_string);
 
-	g_idle_add((GSourceFunc)_invoke_get_list, (gpointer)bd);
+	g_idle_add((GSourceFunc)_invoke_get_list, (gpointer)launch);
 
 	return 0;
 }
@@ -33,6 +33,7 @@
 #include "net_nfc_service_private.h"
 #include "net_nfc_service_llcp_private.h"
 #include "net_nfc_service_llcp_handover_private.h"
+#include "net_nfc_service_llcp_link_private.h"
 #include "net_nfc_service_tag_private.h"
 #include "net_nfc_manager_util_private.h"
 #include "net_nfc_service_se_private.h"
@@ -143,29 +144,19 @@ static void *_net_nfc_dispatcher_thread_func(void *data)
 		{
 		case NET_NFC_MESSAGE_SERVICE_CLEANER:
 			{
+				net_nfc_request_service_cleaner_t *detail = (net_nfc_request_service_cleaner_t *)req_msg;
+
 				DEBUG_SERVER_MSG("client is terminated abnormally");
 
-				if(g_se_prev_type == SECURE_ELEMENT_TYPE_ESE)
+				if(net_nfc_service_se_is_ese_opened() == true)
 				{
 					net_nfc_error_e result = NET_NFC_OK;
-					net_nfc_target_handle_s *ese_handle = g_se_setting.current_ese_handle;
-
-					if(ese_handle != NULL)
-					{
 
-						DEBUG_SERVER_MSG("ese_handle was not freed and disconnected");
-
-						if(net_nfc_controller_disconnect(ese_handle, &result) == false)
-						{
-							net_nfc_controller_exception_handler();
-						}
-#ifdef BROADCAST_MESSAGE
-						net_nfc_server_set_server_state(	NET_NFC_SERVER_IDLE);
-#endif
-						g_se_setting.current_ese_handle = NULL;
-					}
+					/* channels of other clients are kept */
+					net_nfc_service_se_close_ese_channels(detail->client_fd);
 
-					if((g_se_prev_type != g_se_cur_type) || (g_se_prev_mode != g_se_cur_mode))
+					if(net_nfc_service_se_is_ese_opened() == false &&
+						((g_se_prev_type != g_se_cur_type) || (g_se_prev_mode != g_se_cur_mode)))
 					{
 						net_nfc_controller_set_secure_element_mode(g_se_prev_type , g_se_prev_mode, &result);
 
@@ -175,7 +166,8 @@ static void *_net_nfc_dispatcher_thread_func(void *data)
 				}
 				else if(g_se_prev_type == SECURE_ELEMENT_TYPE_UICC)
 				{
-					net_nfc_service_tapi_deinit();
+					/* tapi connection is reused by next session, it is released when nfc is deinitialized */
+					DEBUG_SERVER_MSG("UICC session is released");
 				}
 				else
 				{
@@ -187,30 +179,39 @@ static void *_net_nfc_dispatcher_thread_func(void *data)
 		case NET_NFC_MESSAGE_SEND_APDU_SE:
 			{
 				net_nfc_request_send_apdu_t *detail = (net_nfc_request_send_apdu_t *)req_msg;
+				net_nfc_error_e result = NET_NFC_INVALID_PARAM;
 
 				if (detail->handle == (net_nfc_target_handle_s *)UICC_TARGET_HANDLE)
 				{
-					data_s apdu_data = {NULL, 0};
+					/* apdu is copied to the queue of uicc transport */
+					data_s apdu_data = { detail->data.buffer, detail->data.length };
 
-					if (net_nfc_util_duplicate_data(&apdu_data, &detail->data) == false)
-						break;
+					if (net_nfc_service_transfer_apdu(&apdu_data, detail->trans_param) == false)
+					{
+						net_nfc_response_send_apdu_t resp = { 0 };
 
-					net_nfc_service_transfer_apdu(&apdu_data, detail->trans_param);
+						resp.result = NET_NFC_INVALID_PARAM;
+						resp.trans_param = detail->trans_param;
 
-					net_nfc_util_free_data(&apdu_data);
+						_net_nfc_send_response_msg(req_msg->request_type, (void *)&resp, sizeof(net_nfc_response_send_apdu_t), NULL);
+					}
 				}
-				else if (detail->handle == g_se_setting.current_ese_handle)
+				else if (net_nfc_service_se_get_ese_channel_handle(detail->handle, detail->client_fd, NULL, &result) != NULL)
 				{
 					data_s *data = NULL;
-					net_nfc_error_e result = NET_NFC_OK;
 					net_nfc_transceive_info_s info;
+					net_nfc_target_handle_s *ese_handle;
 					bool success = true;
 
 					info.dev_type = NET_NFC_ISO14443_A_PICC;
 					if (net_nfc_util_duplicate_data(&info.trans_data, &detail->data) == false)
 						break;
 
-					if ((success = net_nfc_controller_transceive(detail->handle, &info, &data, &result)) == true)
+					/* class byte is addressed to the logical channel of this handle */
+					result = NET_NFC_OK;
+					ese_handle = net_nfc_service_se_get_ese_channel_handle(detail->handle, detail->client_fd, &info.trans_data, &result);
+
+					if ((success = net_nfc_controller_transceive(ese_handle, &info, &data, &result)) == true)
 					{
 						if (data != NULL)
 						{
@@ -233,13 +234,13 @@ static void *_net_nfc_dispatcher_thread_func(void *data)
 						resp.data.length = data->length;
 
 						DEBUG_MSG("send response send apdu msg");
-						_net_nfc_send_response_msg(req_msg->request_type, (void *)&resp, sizeof(net_nfc_response_send_apdu_t),
+						_net_nfc_send_response_msg_to_client(detail->client_fd, req_msg->request_type, (void *)&resp, sizeof(net_nfc_response_send_apdu_t),
 							data->buffer, data->length, NULL);
 					}
 					else
 					{
 						DEBUG_MSG("send response send apdu msg");
-						_net_nfc_send_response_msg(req_msg->request_type, (void *)&resp, sizeof(net_nfc_response_send_apdu_t), NULL);
+						_net_nfc_send_response_msg_to_client(detail->client_fd, req_msg->request_type, (void *)&resp, sizeof(net_nfc_response_send_apdu_t), NULL);
 					}
 				}
 				else
@@ -247,15 +248,46 @@ static void *_net_nfc_dispatcher_thread_func(void *data)
 					DEBUG_SERVER_MSG("invalid se handle");
 
 					net_nfc_response_send_apdu_t resp = { 0 };
-					resp.result = NET_NFC_INVALID_PARAM;
+					resp.result = result;
 					resp.trans_param = detail->trans_param;
 
-					_net_nfc_send_response_msg(req_msg->request_type, (void *)&resp, sizeof(net_nfc_response_send_apdu_t), NULL);
+					_net_nfc_send_response_msg_to_client(detail->client_fd, req_msg->request_type, (void *)&resp, sizeof(net_nfc_response_send_apdu_t), NULL);
 				}
 
 			}
 			break;
 
+		case NET_NFC_MESSAGE_SEND_APDU_SCRIPT_SE:
+			{
+				net_nfc_service_se_send_apdu_script(req_msg);
+			}
+			break;
+
+		case NET_NFC_MESSAGE_GET_ATR_SE:
+			{
+				net_nfc_request_get_atr_t *detail = (net_nfc_request_get_atr_t *)req_msg;
+
+				if (detail->handle == (net_nfc_target_handle_s *)UICC_TARGET_HANDLE)
+				{
+					net_nfc_service_request_atr(detail->trans_param);
+				}
+				else
+				{
+					net_nfc_response_get_atr_t resp = { 0 };
+
+					/* controller doesn't provide atr of eSE */
+					DEBUG_SERVER_MSG("atr is not supported for handle [%p]", detail->handle);
+
+					resp.result = NET_NFC_INVALID_PARAM;
+					if (net_nfc_service_se_get_ese_channel_handle(detail->handle, detail->client_fd, NULL, &resp.result) != NULL)
+						resp.result = NET_NFC_NOT_SUPPORTED;
+					resp.trans_param = detail->trans_param;
+
+					_net_nfc_send_response_msg_to_client(detail->client_fd, req_msg->request_type, (void *)&resp, sizeof(net_nfc_response_get_atr_t), NULL);
+				}
+			}
+			break;
+
 		case NET_NFC_MESSAGE_CLOSE_INTERNAL_SE:
 			{
 				net_nfc_request_close_internal_se_t *detail = (net_nfc_request_close_internal_se_t *)req_msg;
@@ -266,30 +298,21 @@ static void *_net_nfc_dispatcher_thread_func(void *data)
 
 				if (detail->handle == (net_nfc_target_handle_s *)UICC_TARGET_HANDLE)
 				{
-					/*deinit TAPI*/
+					/* tapi connection is kept for next session */
 					DEBUG_SERVER_MSG("UICC is current secure element");
-					net_nfc_service_tapi_deinit();
-
 				}
-				else if (detail->handle == g_se_setting.current_ese_handle)
+				else if (net_nfc_service_se_close_ese_channel(detail->handle, detail->client_fd, &(resp.result)) == true)
 				{
-
-					if (net_nfc_controller_disconnect(detail->handle, &(resp.result)) == false)
-					{
-						net_nfc_controller_exception_handler();
-					}
-
-#ifdef BROADCAST_MESSAGE
-					net_nfc_server_unset_server_state(NET_NFC_SE_CONNECTED);
-#endif
-					g_se_setting.current_ese_handle = NULL;
+					DEBUG_SERVER_MSG("eSE channel is closed");
 				}
 				else
 				{
 					DEBUG_SERVER_MSG("invalid se handle received handle = [0x%x] and current handle = [0x%x]", detail->handle, g_se_setting.current_ese_handle);
 				}
 
-				if ((g_se_prev_type != g_se_cur_type) || (g_se_prev_mode != g_se_cur_mode))
+				/* se mode is kept until all eSE channels are closed */
+				if (net_nfc_service_se_is_ese_opened() == false &&
+					((g_se_prev_type != g_se_cur_type) || (g_se_prev_mode != g_se_cur_mode)))
 				{
 					/*return back se mode*/
 					net_nfc_controller_set_secure_element_mode(g_se_prev_type, g_se_prev_mode, &(resp.result));
@@ -298,7 +321,7 @@ static void *_net_nfc_dispatcher_thread_func(void *data)
 					g_se_cur_mode = g_se_prev_mode;
 				}
 
-				_net_nfc_send_response_msg(req_msg->request_type, (void *)&resp, sizeof(net_nfc_response_close_internal_se_t), NULL);
+				_net_nfc_send_response_msg_to_client(detail->client_fd, req_msg->request_type, (void *)&resp, sizeof(net_nfc_response_close_internal_se_t), NULL);
 			}
 			break;
 
@@ -307,11 +330,24 @@ static void *_net_nfc_dispatcher_thread_func(void *data)
 				net_nfc_error_e result = NET_NFC_OK;
 				net_nfc_request_open_internal_se_t *detail = (net_nfc_request_open_internal_se_t *)req_msg;
 
-				g_se_prev_type = g_se_cur_type;
-				g_se_prev_mode = g_se_cur_mode;
+				if (detail->se_type == SECURE_ELEMENT_TYPE_UICC && net_nfc_service_se_is_ese_opened() == true)
+				{
+					net_nfc_response_open_internal_se_t resp = { 0 };
 
-				if (detail->se_type == SECURE_ELEMENT_TYPE_UICC)
+					/* UICC can not be used while eSE channels are opened by other clients */
+					DEBUG_SERVER_MSG("eSE is in use");
+
+					resp.result = NET_NFC_BUSY;
+					resp.trans_param = detail->trans_param;
+					resp.se_type = SECURE_ELEMENT_TYPE_UICC;
+
+					_net_nfc_send_response_msg(req_msg->request_type, (void *)&resp, sizeof(net_nfc_response_open_internal_se_t), NULL);
+				}
+				else if (detail->se_type == SECURE_ELEMENT_TYPE_UICC)
 				{
+					g_se_prev_type = g_se_cur_type;
+					g_se_prev_mode = g_se_cur_mode;
+
 					/*off ESE*/
 					net_nfc_controller_set_secure_element_mode(SECURE_ELEMENT_TYPE_ESE, SECURE_ELEMENT_OFF_MODE, &result);
 
@@ -340,8 +376,12 @@ static void *_net_nfc_dispatcher_thread_func(void *data)
 
 					_net_nfc_send_response_msg(req_msg->request_type, (void *)&resp, sizeof(net_nfc_response_set_se_t), NULL);
 				}
-				else
+				else if (net_nfc_service_se_open_ese_channel(detail->client_fd, detail->trans_param) == false)
 				{
+					/* first eSE channel, other ones are opened on connected eSE */
+					g_se_prev_type = g_se_cur_type;
+					g_se_prev_mode = g_se_cur_mode;
+
 					/*Connect NFC-WI to ESE*/
 					net_nfc_controller_set_secure_element_mode(SECURE_ELEMENT_TYPE_ESE, SECURE_ELEMENT_WIRED_MODE, &result);
 
@@ -350,13 +390,17 @@ static void *_net_nfc_dispatcher_thread_func(void *data)
 
 					g_se_cur_type = SECURE_ELEMENT_TYPE_ESE;
 					g_se_cur_mode = SECURE_ELEMENT_WIRED_MODE;
-					g_se_setting.open_request_trans_param = detail->trans_param;
 
 					if (result != NET_NFC_OK)
 					{
 						net_nfc_response_open_internal_se_t resp = { 0 };
+
+						g_se_setting.open_requested = false;
+						g_se_setting.open_request_trans_param = NULL;
+						g_se_setting.open_request_client_fd = -1;
+
 						resp.result = result;
-						_net_nfc_send_response_msg(req_msg->request_type, (void *)&resp, sizeof(net_nfc_response_set_se_t), NULL);
+						_net_nfc_send_response_msg_to_client(detail->client_fd, req_msg->request_type, (void *)&resp, sizeof(net_nfc_response_set_se_t), NULL);
 					}
 				}
 			}
@@ -479,6 +523,8 @@ static void *_net_nfc_dispatcher_thread_func(void *data)
 					{
 						if (data != NULL)
 							DEBUG_SERVER_MSG("trasceive data recieved [%d], Success = %d", data->length, success);
+
+						net_nfc_service_tag_jewel_update_memory(trans->handle, &info);
 					}
 					else
 					{
@@ -507,6 +553,25 @@ static void *_net_nfc_dispatcher_thread_func(void *data)
 			}
 			break;
 
+		case NET_NFC_MESSAGE_MIFARE_READ_BLOCKS:
+		case NET_NFC_MESSAGE_MIFARE_WRITE_BLOCKS:
+			{
+				net_nfc_service_tag_mifare_blocks(req_msg);
+			}
+			break;
+
+		case NET_NFC_MESSAGE_TRANSCEIVE_SEQUENCE:
+			{
+				net_nfc_service_tag_transceive_sequence(req_msg);
+			}
+			break;
+
+		case NET_NFC_MESSAGE_JEWEL_READ_MEMORY:
+			{
+				net_nfc_service_tag_jewel_read_memory(req_msg);
+			}
+			break;
+
 		case NET_NFC_MESSAGE_MAKE_READ_ONLY_NDEF:
 			{
 				net_nfc_response_make_read_only_ndef_t resp = { 0, };
@@ -516,6 +581,7 @@ static void *_net_nfc_dispatcher_thread_func(void *data)
 				resp.trans_param = make_readOnly->trans_param;
 
 				net_nfc_controller_make_read_only_ndef(make_readOnly->handle, &(resp.result));
+				net_nfc_service_tag_jewel_clear_memory();
 
 				if (_net_nfc_check_client_handle())
 				{
@@ -721,6 +787,7 @@ static void *_net_nfc_dispatcher_thread_func(void *data)
 					resp.trans_param = write_ndef->trans_param;
 
 					net_nfc_controller_write_ndef(write_ndef->handle, &data, &(resp.result));
+					net_nfc_service_tag_jewel_clear_memory();
 					if (_net_nfc_check_client_handle())
 					{
 						_net_nfc_send_response_msg(req_msg->request_type, (void *)&resp, sizeof(net_nfc_response_write_ndef_t), NULL);
@@ -835,6 +902,9 @@ static void *_net_nfc_dispatcher_thread_func(void *data)
 				/* release access control instance */
 				net_nfc_util_access_control_release();
 
+				/* release tapi connection kept for UICC sessions */
+				net_nfc_service_tapi_deinit();
+
 				net_nfc_server_free_current_tag_info();
 
 				result = net_nfc_controller_deinit();
@@ -894,7 +964,9 @@ static void *_net_nfc_dispatcher_thread_func(void *data)
 						DEBUG_ERR_MSG("net_nfc_controller_register_listener failed [%d]", result);
 					}
 
-					net_nfc_llcp_config_info_s config = {128, 1, 100, 0};
+					net_nfc_llcp_config_info_s config = { 0, };
+
+					net_nfc_service_llcp_link_get_local_config(&config);
 					if(net_nfc_controller_llcp_config(&config, &result) == true)
 					{
 						/*We need to check the stack that supports the llcp or not.*/
@@ -1114,6 +1186,12 @@ static void *_net_nfc_dispatcher_thread_func(void *data)
 			}
 			break;
 
+		case NET_NFC_MESSAGE_SERVICE_SE_EVENT_FLUSH :
+			{
+				net_nfc_service_se_flush_events();
+			}
+			break;
+
 		case NET_NFC_MESSAGE_SERVICE_TERMINATION :
 			{
 				net_nfc_service_termination(req_msg);
@@ -1145,6 +1223,7 @@ static void *_net_nfc_dispatcher_thread_func(void *data)
 					resp.trans_param = detail->trans_param;
 
 					net_nfc_controller_format_ndef(detail->handle, &data, &(resp.result));
+					net_nfc_service_tag_jewel_clear_memory();
 					if (_net_nfc_check_client_handle())
 					{
 						_net_nfc_send_response_msg(req_msg->request_type, (void *)&resp, sizeof(net_nfc_response_format_ndef_t), NULL);
@@ -1364,6 +1443,18 @@ static void *_net_nfc_dispatcher_thread_func(void *data)
 			}
 			break;
 
+		case NET_NFC_MESSAGE_LLCP_SEND_TO_BATCH :
+			{
+				net_nfc_service_llcp_process_send_to_batch(req_msg);
+			}
+			break;
+
+		case NET_NFC_MESSAGE_LLCP_RECEIVE_FROM_BATCH :
+			{
+				net_nfc_service_llcp_process_receive_from_batch(req_msg);
+			}
+			break;
+
 		case NET_NFC_MESSAGE_SERVICE_LLCP_CLOSE :
 			{
 				net_nfc_response_close_socket_t resp = { 0, };
@@ -1437,6 +1528,7 @@ static void *_net_nfc_dispatcher_thread_func(void *data)
 				resp.result = NET_NFC_IPC_FAIL;
 				if (detail != NULL)
 				{
+					net_nfc_service_llcp_link_set_base_config(&(detail->config));
 					net_nfc_controller_llcp_config(&(detail->config), &(resp.result));
 					resp.trans_param = detail->trans_param;
 
@@ -1495,6 +1587,13 @@ void net_nfc_dispatcher_cleanup_queue(void)
 	while((req_msg = _net_nfc_dispatcher_queue_pop()) != NULL)
 	{
 		DEBUG_SERVER_MSG("abandon request");
+
+		/* se events are not delivered until next flush is scheduled */
+		if (req_msg->request_type == NET_NFC_MESSAGE_SERVICE_SE_EVENT_FLUSH)
+		{
+			net_nfc_service_se_reschedule_events();
+		}
+
 		_net_nfc_manager_util_free_mem(req_msg);
 	}
 
@@ -1503,17 +1602,18 @@ void net_nfc_dispatcher_cleanup_queue(void)
 	pthread_mutex_unlock(&g_dispatcher_queue_lock);
 }
 
-void net_nfc_dispatcher_put_cleaner(void)
+void net_nfc_dispatcher_put_cleaner(int client_sock_fd)
 {
-	net_nfc_request_msg_t *req_msg = NULL;
+	net_nfc_request_service_cleaner_t *req_msg = NULL;
 
-	_net_nfc_util_alloc_mem(req_msg, sizeof(net_nfc_request_msg_t));
+	_net_nfc_util_alloc_mem(req_msg, sizeof(net_nfc_request_service_cleaner_t));
 	if(req_msg != NULL)
 	{
-		DEBUG_SERVER_MSG("put cleaner request");
+		DEBUG_SERVER_MSG("put cleaner request, client = [%d]", client_sock_fd);
 
-		req_msg->length = sizeof(net_nfc_request_msg_t);
+		req_msg->length = sizeof(net_nfc_request_service_cleaner_t);
 		req_msg->request_type = NET_NFC_MESSAGE_SERVICE_CLEANER;
-		net_nfc_dispatcher_queue_push(req_msg);
+		req_msg->client_fd = client_sock_fd;
+		net_nfc_dispatcher_queue_push((net_nfc_request_msg_t *)req_msg);
 	}
 }
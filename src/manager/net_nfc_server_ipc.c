@@ -305,6 +305,8 @@ gboolean net_nfc_server_ipc_callback_func(GIOChannel* channel, GIOCondition cond
 {
 	if((G_IO_ERR & condition) || (G_IO_HUP & condition))
 	{
+		int client_sock_fd = 0;
+
 		DEBUG_SERVER_MSG("IO ERROR \n");
 		if(channel == g_server_info.server_channel)
 		{
@@ -314,6 +316,9 @@ gboolean net_nfc_server_ipc_callback_func(GIOChannel* channel, GIOCondition cond
 		else
 		{
 			DEBUG_SERVER_MSG("client socket is closed");
+
+			client_sock_fd = net_nfc_server_get_client_sock_fd(channel);
+
 			if(net_nfc_server_cleanup_client_context(channel) == false)
 			{
 				DEBUG_ERR_MSG("failed to cleanup");
@@ -331,7 +336,7 @@ gboolean net_nfc_server_ipc_callback_func(GIOChannel* channel, GIOCondition cond
 
 		net_nfc_dispatcher_cleanup_queue();
 
-		net_nfc_dispatcher_put_cleaner();
+		net_nfc_dispatcher_put_cleaner(client_sock_fd);
 
 		return FALSE;
 	}
@@ -631,6 +636,47 @@ bool net_nfc_server_read_client_request(int client_sock_fd, net_nfc_error_e *res
 		}
 		break;
 
+		case NET_NFC_MESSAGE_OPEN_INTERNAL_SE :
+		{
+			net_nfc_request_open_internal_se_t *detail = (net_nfc_request_open_internal_se_t *)req_msg;
+
+			/* eSE channels are owned by the requesting client */
+			detail->client_fd = client_sock_fd;
+		}
+		break;
+
+		case NET_NFC_MESSAGE_CLOSE_INTERNAL_SE :
+		{
+			net_nfc_request_close_internal_se_t *detail = (net_nfc_request_close_internal_se_t *)req_msg;
+
+			detail->client_fd = client_sock_fd;
+		}
+		break;
+
+		case NET_NFC_MESSAGE_SEND_APDU_SE :
+		{
+			net_nfc_request_send_apdu_t *detail = (net_nfc_request_send_apdu_t *)req_msg;
+
+			detail->client_fd = client_sock_fd;
+		}
+		break;
+
+		case NET_NFC_MESSAGE_SEND_APDU_SCRIPT_SE :
+		{
+			net_nfc_request_send_apdu_script_t *detail = (net_nfc_request_send_apdu_script_t *)req_msg;
+
+			detail->client_fd = client_sock_fd;
+		}
+		break;
+
+		case NET_NFC_MESSAGE_GET_ATR_SE :
+		{
+			net_nfc_request_get_atr_t *detail = (net_nfc_request_get_atr_t *)req_msg;
+
+			detail->client_fd = client_sock_fd;
+		}
+		break;
+
 		default :
 			break;
 	}
@@ -739,7 +785,7 @@ bool net_nfc_server_send_message_to_client(void* message, int length)
 	net_nfc_server_received_message_s* p1;
 	net_nfc_server_received_message_s* p2;
 
-	int leng, i;
+	int leng, i, client_fd;
 
 	p1 = g_server_info.received_message;
 	p2 = NULL;
@@ -783,6 +829,7 @@ bool net_nfc_server_send_message_to_client(void* message, int length)
 			{
 				g_server_info.received_message = p1->next;
 			}
+			client_fd = p1->client_fd;
 			free(p1);
 
 			if(leng > 0)
@@ -791,7 +838,7 @@ bool net_nfc_server_send_message_to_client(void* message, int length)
 			}
 			else
 			{
-				DEBUG_ERR_MSG("failed to send message, socket = [%d], msg_length = [%d]", p1->client_fd, length);
+				DEBUG_ERR_MSG("failed to send message, socket = [%d], msg_length = [%d]", client_fd, length);
 				return false;
 			}
 		}
@@ -832,6 +879,57 @@ bool net_nfc_server_send_message_to_client(void* message, int length)
 #endif
 }
 
+/* send a response to the client which issued the request, instead of the
+   newest client waiting for the same message type */
+static bool net_nfc_server_send_message_to_client_fd(int client_fd, int mes_type, void* message, int length)
+{
+#ifdef BROADCAST_MESSAGE
+	net_nfc_server_received_message_s* p1;
+	net_nfc_server_received_message_s* p2;
+
+	int leng;
+
+	p1 = g_server_info.received_message;
+	p2 = NULL;
+
+	while(p1 != NULL)
+	{
+		if(p1->mes_type == mes_type && p1->client_fd == client_fd)
+		{
+			if(p2 != NULL)
+			{
+				p2->next = p1->next;
+			}
+			else
+			{
+				g_server_info.received_message = p1->next;
+			}
+			free(p1);
+
+			break;
+		}
+		p2 = p1;
+		p1 = p1->next;
+	}
+
+	pthread_mutex_lock(&g_server_socket_lock);
+	leng = send(client_fd, (void *)message, length, 0);
+	pthread_mutex_unlock(&g_server_socket_lock);
+
+	if(leng > 0)
+	{
+		return true;
+	}
+	else
+	{
+		DEBUG_ERR_MSG("failed to send message, socket = [%d], msg_length = [%d]", client_fd, length);
+		return false;
+	}
+#else
+	return net_nfc_server_send_message_to_client(message, length);
+#endif
+}
+
 bool net_nfc_server_recv_message_from_client(int client_sock_fd, void* message, int length)
 {
 	int leng = recv(client_sock_fd, message, length, 0);
@@ -1142,50 +1240,67 @@ bool net_nfc_server_get_client_type(int socket, int* client_type)
 }
 
 
-bool _net_nfc_send_response_msg(int msg_type, ...)
+/* client_fd < 0 : send to the client waiting for msg_type */
+static bool _net_nfc_send_response_msg_v(int client_fd, int msg_type, va_list args)
 {
-	va_list args;
+	va_list sizes;
 	int total_size = 0;
 	int size = 0;
 	int written_size = 0;
 	void * data;
 	uint8_t* send_buffer = NULL;
+	bool ret;
 
-	va_start (args, msg_type);
-	if (va_arg (args, void*) != NULL)
+	va_copy (sizes, args);
+	if (va_arg (sizes, void*) != NULL)
 	{
-		while ((size = va_arg(args, int)) != 0)
+		while ((size = va_arg(sizes, int)) != 0)
 		{
 
 			total_size+=size;
 
-			if (va_arg (args, void*) == NULL)
+			if (va_arg (sizes, void*) == NULL)
 			{
 				break;
 			}
 		}
 	}
-	va_end (args);
+	va_end (sizes);
 
 	total_size += sizeof (int);
 	_net_nfc_manager_util_alloc_mem (send_buffer, total_size);
+	if (send_buffer == NULL)
+		return false;
+
 	memcpy(send_buffer, &(msg_type), sizeof(int));
 	written_size += sizeof (int);
 
-	va_start (args, msg_type);
 	while ((data = va_arg(args, void *)) != 0)
 	{
 		size = va_arg (args, int);
-		if (size == 0) return false;
+		if (size == 0)
+		{
+			_net_nfc_manager_util_free_mem(send_buffer);
+			return false;
+		}
 		memcpy (send_buffer + written_size, data, size);
 		written_size += size;
 	}
-	va_end (args);
+
+	if (client_fd >= 0)
+	{
+		ret = net_nfc_server_send_message_to_client_fd(client_fd, msg_type, (void *)send_buffer, total_size);
+	}
+	else
+	{
 #ifdef BROADCAST_MESSAGE
-	if(net_nfc_server_send_message_to_client(msg_type, (void *)send_buffer, total_size) == true)
+		ret = net_nfc_server_send_message_to_client(msg_type, (void *)send_buffer, total_size);
 #else
-	if(net_nfc_server_send_message_to_client((void *)send_buffer, total_size) == true)
+		ret = net_nfc_server_send_message_to_client((void *)send_buffer, total_size);
 #endif
+	}
+
+	if(ret == true)
 	{
 		DEBUG_SERVER_MSG("SERVER : [MSG:%d] sending response is ok ", msg_type);
 	}
@@ -1193,6 +1308,30 @@ bool _net_nfc_send_response_msg(int msg_type, ...)
 	return true;
 }
 
+bool _net_nfc_send_response_msg(int msg_type, ...)
+{
+	va_list args;
+	bool ret;
+
+	va_start (args, msg_type);
+	ret = _net_nfc_send_response_msg_v(-1, msg_type, args);
+	va_end (args);
+
+	return ret;
+}
+
+bool _net_nfc_send_response_msg_to_client(int client_fd, int msg_type, ...)
+{
+	va_list args;
+	bool ret;
+
+	va_start (args, msg_type);
+	ret = _net_nfc_send_response_msg_v(client_fd, msg_type, args);
+	va_end (args);
+
+	return ret;
+}
+
 
 bool _net_nfc_check_client_handle ()
 {
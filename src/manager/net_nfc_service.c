@@ -118,52 +118,15 @@ void net_nfc_service_target_detected_cb(void *info, void *user_context)
 
 void net_nfc_service_se_transaction_cb(void *info, void *user_context)
 {
-	int client_context = 0;
-	bool success;
-
 	net_nfc_request_se_event_t *se_event = (net_nfc_request_se_event_t *)info;
 
-	DEBUG_SERVER_MSG("se event [%d]", se_event->request_type);
-
-	if (1)
-	{
-		net_nfc_app_util_launch_se_transaction_app(se_event->aid.buffer, se_event->aid.length, se_event->param.buffer, se_event->param.length);
-	}
-
-	if (net_nfc_server_get_current_client_context(&client_context) == true)
-	{
-		if (net_nfc_server_check_client_is_running(&client_context) == true)
-		{
-			net_nfc_response_se_event_t resp_msg = { 0, };
-
-			resp_msg.aid.length = se_event->aid.length;
-			resp_msg.param.length = se_event->param.length;
+	if (info == NULL)
+		return;
 
-			if (resp_msg.aid.length > 0)
-			{
-				if (resp_msg.param.length > 0)
-				{
-					success = _net_nfc_send_response_msg(se_event->request_type, (void *)&resp_msg, sizeof(net_nfc_response_se_event_t),
-						(void *)(se_event->aid.buffer), resp_msg.aid.length,
-						(void *)(se_event->param.buffer), resp_msg.param.length, NULL);
-				}
-				else
-				{
-					success = _net_nfc_send_response_msg(se_event->request_type, (void *)&resp_msg, sizeof(net_nfc_response_se_event_t),
-						(void *)(se_event->aid.buffer), resp_msg.aid.length, NULL);
-				}
-			}
-			else
-			{
-				success = _net_nfc_send_response_msg(se_event->request_type, (void *)&resp_msg, sizeof(net_nfc_response_se_event_t), NULL);
-			}
+	DEBUG_SERVER_MSG("se event [%d]", se_event->request_type);
 
-			if (success == true)
-			{
-				DEBUG_SERVER_MSG("sending response is ok");
-			}
-		}
-	}
+	/* app launch and client notification are done by dispatcher */
+	net_nfc_service_se_push_event(se_event);
 }
 
 void net_nfc_service_llcp_event_cb(void* info, void* user_context)
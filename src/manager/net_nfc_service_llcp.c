@@ -25,6 +25,7 @@
 #include "net_nfc_manager_util_private.h"
 #include "net_nfc_service_llcp_private.h"
 #include "net_nfc_service_llcp_handover_private.h"
+#include "net_nfc_service_llcp_link_private.h"
 
 #include <pthread.h>
 #include <malloc.h>
@@ -32,14 +33,18 @@
 #include <netinet/in.h>
 
 
+/* SNEP and NPP servers have their own buffer and state, so both peers can be served at the same time */
 static uint8_t snep_server_buffer[SNEP_MAX_BUFFER] = {0,};
+static uint8_t npp_server_buffer[SNEP_MAX_BUFFER] = {0,};
 static uint8_t snep_client_buffer[SNEP_MAX_BUFFER] = {0,};
 
 static data_s snep_server_data ={snep_server_buffer, SNEP_MAX_BUFFER};
+static data_s npp_server_data ={npp_server_buffer, SNEP_MAX_BUFFER};
 static data_s snep_client_data ={snep_client_buffer, SNEP_MAX_BUFFER};
 
 static net_nfc_llcp_state_t current_llcp_client_state;
-static net_nfc_llcp_state_t current_llcp_server_state;
+static net_nfc_llcp_state_t current_snep_server_state;
+static net_nfc_llcp_state_t current_npp_server_state;
 
 
 /* static callback function */
@@ -63,6 +68,28 @@ static net_nfc_error_e _net_nfc_service_llcp_npp_get_information_length(data_s*
 //////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 GList * state_list = NULL;
+
+/* connectionless batch requests which wait for completion of controller */
+typedef struct _net_nfc_llcp_batch_s net_nfc_llcp_batch_s;
+
+typedef struct _net_nfc_llcp_batch_item_s
+{
+	net_nfc_llcp_batch_s *batch;
+	net_nfc_error_e result;
+	data_s data; /* receive buffer, not used for send */
+} net_nfc_llcp_batch_item_s;
+
+struct _net_nfc_llcp_batch_s
+{
+	uint32_t request_type;
+	net_nfc_llcp_socket_t client_socket;
+	void *trans_param;
+	uint32_t count;
+	uint32_t remained; /* number of items not completed yet */
+	net_nfc_llcp_batch_item_s items[0];
+};
+
+static GList * batch_list = NULL;
 static bool net_nfc_service_llcp_is_valid_state (net_nfc_llcp_state_t * state)
 {
 	if (g_list_find (state_list, state) != NULL){
@@ -84,6 +111,34 @@ void net_nfc_service_llcp_add_state (net_nfc_llcp_state_t * state)
 }
 
 
+#ifndef SUPPORT_CONFIG_FILE
+static bool _net_nfc_service_llcp_start_exchange_server(net_nfc_target_handle_s* handle, llcp_state_e type, net_nfc_error_e* result)
+{
+	net_nfc_llcp_state_t * state = NULL;
+
+	_net_nfc_manager_util_alloc_mem (state, sizeof (net_nfc_llcp_state_t));
+	if (state == NULL)
+	{
+		*result = NET_NFC_ALLOC_FAIL;
+		return false;
+	}
+
+	state->handle = handle;
+	state->state = type;
+	state->step = NET_NFC_LLCP_STEP_01;
+	state->user_data = NULL;
+
+	net_nfc_service_llcp_add_state (state);
+
+	if (type == NET_NFC_STATE_EXCHANGER_SERVER_NPP)
+	{
+		return _net_nfc_service_llcp_npp_server (state, result);
+	}
+
+	return _net_nfc_service_llcp_snep_server (state, result);
+}
+#endif
+
 bool net_nfc_service_llcp_process(net_nfc_target_handle_s* handle, int devType, net_nfc_error_e* result)
 {
 	*result = NET_NFC_OK;
@@ -115,6 +170,8 @@ bool net_nfc_service_llcp_process(net_nfc_target_handle_s* handle, int devType,
 		DEBUG_SERVER_MSG("activate LLCP");
 		if(net_nfc_controller_llcp_activate_llcp(handle, result) == true)
 		{
+			net_nfc_service_llcp_link_activated(handle);
+			net_nfc_service_llcp_handover_prepare_request();
 
 #ifdef SUPPORT_CONFIG_FILE
 			char value[64] = {0,};
@@ -197,33 +254,16 @@ bool net_nfc_service_llcp_process(net_nfc_target_handle_s* handle, int devType,
 
 #else/* Use the NPP & the SNEP FOR LLCP , Handover*/
 
-			/* NPP */
-			net_nfc_llcp_state_t * exchange_state_server_NPP = NULL;
-			_net_nfc_manager_util_alloc_mem (exchange_state_server_NPP,sizeof (net_nfc_llcp_state_t));
-			exchange_state_server_NPP->handle = handle;
-			exchange_state_server_NPP->state = NET_NFC_STATE_EXCHANGER_SERVER_NPP;
-			exchange_state_server_NPP->step = NET_NFC_LLCP_STEP_01;
-			exchange_state_server_NPP->user_data = NULL;
-
-			net_nfc_service_llcp_add_state (exchange_state_server_NPP);
-
-			if (_net_nfc_service_llcp_npp_server (exchange_state_server_NPP, result) == false)
-			{
-				return false;
-			}
-
-			/* SNEP */
-			net_nfc_llcp_state_t * exchange_state_server_SNEP = NULL;
-			_net_nfc_manager_util_alloc_mem (exchange_state_server_SNEP,sizeof (net_nfc_llcp_state_t));
-			exchange_state_server_SNEP->handle = handle;
-			exchange_state_server_SNEP->state = NET_NFC_STATE_EXCHANGER_SERVER;
-			exchange_state_server_SNEP->step = NET_NFC_LLCP_STEP_01;
-			exchange_state_server_SNEP->user_data = NULL;
+			/* NPP and SNEP servers are independent, one of them failing does not keep the other one down */
+			net_nfc_error_e npp_result = NET_NFC_OK;
+			net_nfc_error_e snep_result = NET_NFC_OK;
+			bool npp_started = _net_nfc_service_llcp_start_exchange_server (handle, NET_NFC_STATE_EXCHANGER_SERVER_NPP, &npp_result);
+			bool snep_started = _net_nfc_service_llcp_start_exchange_server (handle, NET_NFC_STATE_EXCHANGER_SERVER, &snep_result);
 
-			net_nfc_service_llcp_add_state (exchange_state_server_SNEP);
-
-			if (_net_nfc_service_llcp_snep_server (exchange_state_server_SNEP, result) == false)
+			if (npp_started == false && snep_started == false)
 			{
+				DEBUG_SERVER_MSG("failed to start exchange servers, npp [%d], snep [%d]", npp_result, snep_result);
+				*result = snep_result;
 				return false;
 			}
 
@@ -315,7 +355,7 @@ static bool _net_nfc_service_llcp_state_process(net_nfc_request_msg_t *msg)
 
 	case NET_NFC_STATE_EXCHANGER_SERVER_NPP :
 		DEBUG_SERVER_MSG("exchanger sesrver npp");
-		net_nfc_server_set_server_state(NET_NFC_SNEP_SERVER_CONNECTED);
+		net_nfc_server_set_server_state(NET_NFC_NPP_SERVER_CONNECTED);
 		result = _net_nfc_service_llcp_npp_server(state, &error);
 		break;
 
@@ -372,6 +412,8 @@ bool net_nfc_service_llcp_disconnect_target(net_nfc_request_msg_t *msg)
 	if (llcp_msg == NULL)
 		return false;
 
+	net_nfc_service_llcp_link_deactivated();
+
 	handle = (net_nfc_target_handle_s *)llcp_msg->user_param;
 	if (handle != NULL)
 	{
@@ -415,6 +457,8 @@ bool net_nfc_service_llcp_process_socket_error(net_nfc_request_msg_t *msg)
 	if (msg == NULL)
 		return false;
 
+	net_nfc_service_llcp_link_socket_error(llcp_msg->result);
+
 	if (_net_nfc_check_client_handle())
 	{
 		/* in case of slave mode */
@@ -440,6 +484,8 @@ bool net_nfc_service_llcp_process_accepted_socket_error(net_nfc_request_msg_t *m
 	if (msg == NULL)
 		return false;
 
+	net_nfc_service_llcp_link_socket_error(llcp_msg->result);
+
 	if (_net_nfc_check_client_handle())
 	{
 		/* in case of slave mode the error message will be deliver to client stub*/
@@ -506,6 +552,285 @@ bool net_nfc_service_llcp_process_send_socket(net_nfc_request_msg_t *msg)
 	return res;
 }
 
+/* batched connectionless requests */
+
+static net_nfc_llcp_batch_item_s *_net_nfc_service_llcp_find_batch_item(void *user_param)
+{
+	GList *list = NULL;
+
+	for (list = batch_list; list != NULL; list = list->next)
+	{
+		net_nfc_llcp_batch_s *batch = (net_nfc_llcp_batch_s *)list->data;
+
+		if ((net_nfc_llcp_batch_item_s *)user_param >= batch->items && (net_nfc_llcp_batch_item_s *)user_param < batch->items + batch->count)
+		{
+			return (net_nfc_llcp_batch_item_s *)user_param;
+		}
+	}
+
+	return NULL;
+}
+
+static void _net_nfc_service_llcp_free_batch(net_nfc_llcp_batch_s *batch)
+{
+	uint32_t i;
+
+	batch_list = g_list_remove(batch_list, batch);
+
+	for (i = 0; i < batch->count; i++)
+	{
+		net_nfc_util_free_data(&batch->items[i].data);
+	}
+
+	_net_nfc_manager_util_free_mem(batch);
+}
+
+static void _net_nfc_service_llcp_batch_response(net_nfc_llcp_batch_s *batch)
+{
+	net_nfc_error_e result = NET_NFC_OK;
+	uint32_t count = 0;
+	uint32_t i;
+
+	/* result is the first error, count is the number of datagrams before it */
+	for (i = 0; i < batch->count; i++)
+	{
+		if (batch->items[i].result != NET_NFC_OK)
+		{
+			result = batch->items[i].result;
+			break;
+		}
+		count++;
+	}
+
+	DEBUG_SERVER_MSG("llcp batch is completed, type [%d], count [%d/%d], result [%d]", batch->request_type, count, batch->count, result);
+
+	if (_net_nfc_check_client_handle())
+	{
+		if (batch->request_type == NET_NFC_MESSAGE_LLCP_SEND_TO_BATCH)
+		{
+			net_nfc_response_send_to_batch_socket_t resp = { 0, };
+
+			resp.result = result;
+			resp.client_socket = batch->client_socket;
+			resp.count = count;
+			resp.trans_param = batch->trans_param;
+
+			_net_nfc_send_response_msg(NET_NFC_MESSAGE_LLCP_SEND_TO_BATCH, &resp, sizeof(net_nfc_response_send_to_batch_socket_t), NULL);
+		}
+		else
+		{
+			net_nfc_response_receive_from_batch_socket_t resp = { 0, };
+			uint32_t length = 0;
+			uint32_t offset = 0;
+
+			for (i = 0; i < count; i++)
+			{
+				length += NET_NFC_LLCP_BATCH_DATAGRAM_LENGTH(batch->items[i].data.length);
+			}
+
+			resp.result = result;
+			resp.client_socket = batch->client_socket;
+			resp.trans_param = batch->trans_param;
+
+			if (length > 0 && net_nfc_util_alloc_data(&resp.data, length) == true)
+			{
+				for (i = 0; i < count; i++)
+				{
+					net_nfc_util_append_llcp_batch_datagram(resp.data.buffer, resp.data.length, &offset, batch->items[i].data.buffer, batch->items[i].data.length);
+				}
+				resp.count = count;
+			}
+			else if (length > 0)
+			{
+				resp.result = NET_NFC_ALLOC_FAIL;
+			}
+
+			if (resp.data.length > 0)
+			{
+				_net_nfc_send_response_msg(NET_NFC_MESSAGE_LLCP_RECEIVE_FROM_BATCH, &resp, sizeof(net_nfc_response_receive_from_batch_socket_t),
+					resp.data.buffer, resp.data.length, NULL);
+			}
+			else
+			{
+				_net_nfc_send_response_msg(NET_NFC_MESSAGE_LLCP_RECEIVE_FROM_BATCH, &resp, sizeof(net_nfc_response_receive_from_batch_socket_t), NULL);
+			}
+
+			net_nfc_util_free_data(&resp.data);
+		}
+	}
+
+	_net_nfc_service_llcp_free_batch(batch);
+}
+
+static bool _net_nfc_service_llcp_batch_item_completed(net_nfc_request_llcp_msg_t *llcp_msg)
+{
+	net_nfc_llcp_batch_item_s *item = NULL;
+	net_nfc_llcp_batch_s *batch = NULL;
+
+	if ((item = _net_nfc_service_llcp_find_batch_item((void *)llcp_msg->user_param)) == NULL)
+		return false;
+
+	batch = item->batch;
+
+	item->result = llcp_msg->result;
+	batch->remained--;
+
+	if (batch->remained == 0)
+	{
+		_net_nfc_service_llcp_batch_response(batch);
+	}
+
+	/* item belongs to the batch, it should not be freed with message */
+	llcp_msg->user_param = 0;
+
+	return true;
+}
+
+static net_nfc_llcp_batch_s *_net_nfc_service_llcp_create_batch(uint32_t request_type, net_nfc_llcp_socket_t client_socket, void *trans_param, uint32_t count)
+{
+	net_nfc_llcp_batch_s *batch = NULL;
+	uint32_t i;
+
+	_net_nfc_manager_util_alloc_mem(batch, sizeof(net_nfc_llcp_batch_s) + count * sizeof(net_nfc_llcp_batch_item_s));
+	if (batch == NULL)
+		return NULL;
+
+	batch->request_type = request_type;
+	batch->client_socket = client_socket;
+	batch->trans_param = trans_param;
+	batch->count = count;
+	batch->remained = count;
+
+	for (i = 0; i < count; i++)
+	{
+		batch->items[i].batch = batch;
+		batch->items[i].result = NET_NFC_IPC_FAIL;
+	}
+
+	batch_list = g_list_append(batch_list, batch);
+
+	return batch;
+}
+
+bool net_nfc_service_llcp_process_send_to_batch(net_nfc_request_msg_t *msg)
+{
+	net_nfc_request_send_to_batch_socket_t *detail = (net_nfc_request_send_to_batch_socket_t *)msg;
+	net_nfc_llcp_batch_s *batch = NULL;
+	uint32_t offset = 0;
+	uint32_t i;
+
+	if (msg == NULL)
+		return false;
+
+	if (detail->count == 0 || detail->count > NET_NFC_LLCP_BATCH_MAX_COUNT)
+	{
+		DEBUG_ERR_MSG("invalid datagram count [%d]", detail->count);
+
+		if (_net_nfc_check_client_handle())
+		{
+			net_nfc_response_send_to_batch_socket_t resp = { 0, };
+
+			resp.result = NET_NFC_OUT_OF_BOUND;
+			resp.client_socket = detail->client_socket;
+			resp.trans_param = detail->trans_param;
+
+			_net_nfc_send_response_msg(NET_NFC_MESSAGE_LLCP_SEND_TO_BATCH, &resp, sizeof(net_nfc_response_send_to_batch_socket_t), NULL);
+		}
+		return false;
+	}
+
+	if ((batch = _net_nfc_service_llcp_create_batch(msg->request_type, detail->client_socket, detail->trans_param, detail->count)) == NULL)
+	{
+		DEBUG_ERR_MSG("allocation is failed");
+		return false;
+	}
+
+	/* every datagram is handed to controller in this pass, completions are gathered in the batch */
+	for (i = 0; i < detail->count; i++)
+	{
+		net_nfc_llcp_batch_item_s *item = &batch->items[i];
+		data_s datagram = { NULL, 0 };
+
+		if (net_nfc_util_get_llcp_batch_datagram(detail->data.buffer, detail->data.length, &offset, &datagram) == false)
+		{
+			item->result = NET_NFC_INVALID_FORMAT;
+			batch->remained--;
+			continue;
+		}
+
+		if (net_nfc_controller_llcp_send_to(detail->handle, detail->oal_socket, &datagram, detail->dsap, &item->result, item) == false)
+		{
+			DEBUG_ERR_MSG("send_to is failed, index [%d], result [%d]", i, item->result);
+			batch->remained--;
+		}
+	}
+
+	if (batch->remained == 0)
+	{
+		_net_nfc_service_llcp_batch_response(batch);
+	}
+
+	return true;
+}
+
+bool net_nfc_service_llcp_process_receive_from_batch(net_nfc_request_msg_t *msg)
+{
+	net_nfc_request_receive_from_batch_socket_t *detail = (net_nfc_request_receive_from_batch_socket_t *)msg;
+	net_nfc_llcp_batch_s *batch = NULL;
+	uint32_t i;
+
+	if (msg == NULL)
+		return false;
+
+	if (detail->count == 0 || detail->count > NET_NFC_LLCP_BATCH_MAX_COUNT)
+	{
+		DEBUG_ERR_MSG("invalid datagram count [%d]", detail->count);
+
+		if (_net_nfc_check_client_handle())
+		{
+			net_nfc_response_receive_from_batch_socket_t resp = { 0, };
+
+			resp.result = NET_NFC_OUT_OF_BOUND;
+			resp.client_socket = detail->client_socket;
+			resp.trans_param = detail->trans_param;
+
+			_net_nfc_send_response_msg(NET_NFC_MESSAGE_LLCP_RECEIVE_FROM_BATCH, &resp, sizeof(net_nfc_response_receive_from_batch_socket_t), NULL);
+		}
+		return false;
+	}
+
+	if ((batch = _net_nfc_service_llcp_create_batch(msg->request_type, detail->client_socket, detail->trans_param, detail->count)) == NULL)
+	{
+		DEBUG_ERR_MSG("allocation is failed");
+		return false;
+	}
+
+	for (i = 0; i < detail->count; i++)
+	{
+		net_nfc_llcp_batch_item_s *item = &batch->items[i];
+
+		if (net_nfc_util_alloc_data(&item->data, detail->req_length) == false)
+		{
+			item->result = NET_NFC_ALLOC_FAIL;
+			batch->remained--;
+			continue;
+		}
+
+		if (net_nfc_controller_llcp_recv_from(detail->handle, detail->oal_socket, &item->data, &item->result, item) == false)
+		{
+			DEBUG_ERR_MSG("recv_from is failed, index [%d], result [%d]", i, item->result);
+			batch->remained--;
+		}
+	}
+
+	if (batch->remained == 0)
+	{
+		_net_nfc_service_llcp_batch_response(batch);
+	}
+
+	return true;
+}
+
 bool net_nfc_service_llcp_process_send_to_socket(net_nfc_request_msg_t* msg)
 {
 	net_nfc_request_llcp_msg_t *llcp_msg = (net_nfc_request_llcp_msg_t *)msg;
@@ -514,6 +839,9 @@ bool net_nfc_service_llcp_process_send_to_socket(net_nfc_request_msg_t* msg)
 	if (msg == NULL)
 		return false;
 
+	if (_net_nfc_service_llcp_batch_item_completed(llcp_msg) == true)
+		return true;
+
 	if (_net_nfc_check_client_handle())
 	{
 		/* in case of slave mode the error message will be deliver to client stub*/
@@ -551,6 +879,9 @@ bool net_nfc_service_llcp_process_receive_from_socket(net_nfc_request_msg_t *msg
 	if (msg == NULL)
 		return false;
 
+	if (_net_nfc_service_llcp_batch_item_completed(llcp_msg) == true)
+		return true;
+
 	if (_net_nfc_check_client_handle())
 	{
 		net_nfc_response_receive_socket_t *detail = (net_nfc_response_receive_socket_t *)llcp_msg->user_param;
@@ -757,7 +1088,7 @@ static bool _net_nfc_service_llcp_snep_server(net_nfc_llcp_state_t * state, net_
 		{
 			DEBUG_SERVER_MSG("step 1");
 
-			if(net_nfc_controller_llcp_create_socket(&(state->socket), NET_NFC_LLCP_SOCKET_TYPE_CONNECTIONORIENTED, SNEP_MAX_BUFFER, 1, result, state) == false)	{
+			if(net_nfc_controller_llcp_create_socket(&(state->socket), NET_NFC_LLCP_SOCKET_TYPE_CONNECTIONORIENTED, SNEP_MAX_BUFFER, net_nfc_service_llcp_link_get_socket_rw(), result, state) == false)	{
 	 			state->step = NET_NFC_STATE_ERROR;
 				break;
 			}
@@ -804,8 +1135,8 @@ static bool _net_nfc_service_llcp_snep_server(net_nfc_llcp_state_t * state, net_
 			memset(snep_server_data.buffer,  0x00, SNEP_MAX_BUFFER);
 			snep_server_data.length = SNEP_MAX_BUFFER;
 
-			current_llcp_server_state.handle = state->handle;
-			current_llcp_server_state.socket = state->incomming_socket;
+			current_snep_server_state.handle = state->handle;
+			current_snep_server_state.socket = state->incomming_socket;
 
 			net_nfc_service_llcp_add_state (new_client);
 
@@ -964,8 +1295,8 @@ static bool _net_nfc_service_llcp_snep_server(net_nfc_llcp_state_t * state, net_
 
 				DEBUG_SERVER_MSG("snep : sending response is success...");
 	 			state->step = NET_NFC_LLCP_STEP_02;
-				state->handle = current_llcp_server_state.handle;
-				state->incomming_socket = current_llcp_server_state.socket;
+				state->handle = current_snep_server_state.handle;
+				state->incomming_socket = current_snep_server_state.socket;
 
 				_net_nfc_service_llcp_snep_server(state, &error);
 			}
@@ -1180,7 +1511,7 @@ static bool _net_nfc_service_llcp_npp_server(net_nfc_llcp_state_t * state, net_n
 		{
 			DEBUG_SERVER_MSG("NPP step 1");
 
-			if(net_nfc_controller_llcp_create_socket(&(state->socket), NET_NFC_LLCP_SOCKET_TYPE_CONNECTIONORIENTED, SNEP_MAX_BUFFER, 1, result, state) == false)
+			if(net_nfc_controller_llcp_create_socket(&(state->socket), NET_NFC_LLCP_SOCKET_TYPE_CONNECTIONORIENTED, SNEP_MAX_BUFFER, net_nfc_service_llcp_link_get_socket_rw(), result, state) == false)
 			{
 				DEBUG_SERVER_MSG("creaete socket for npp FAIL");
 				state->step = NET_NFC_STATE_ERROR;
@@ -1226,14 +1557,14 @@ static bool _net_nfc_service_llcp_npp_server(net_nfc_llcp_state_t * state, net_n
 			new_client->step = NET_NFC_LLCP_STEP_03;
 			new_client->user_data = NULL;
 
-			memset(snep_server_data.buffer,  0x00, SNEP_MAX_BUFFER);
-			snep_server_data.length = SNEP_MAX_BUFFER;
+			memset(npp_server_data.buffer,  0x00, SNEP_MAX_BUFFER);
+			npp_server_data.length = SNEP_MAX_BUFFER;
 
-			current_llcp_server_state.handle = state->handle;
-			current_llcp_server_state.socket = state->incomming_socket;
+			current_npp_server_state.handle = state->handle;
+			current_npp_server_state.socket = state->incomming_socket;
 			net_nfc_service_llcp_add_state (new_client);
 
-			if(net_nfc_controller_llcp_recv(new_client->handle, new_client->socket , &snep_server_data, result, new_client) == false)
+			if(net_nfc_controller_llcp_recv(new_client->handle, new_client->socket , &npp_server_data, result, new_client) == false)
 			{
 	 			state->step = NET_NFC_STATE_ERROR;
 				break;
@@ -1259,7 +1590,7 @@ static bool _net_nfc_service_llcp_npp_server(net_nfc_llcp_state_t * state, net_n
 			uint8_t resp_code = 0;
 			data_s* resp_msg = NULL;
 
-			if(_net_nfc_service_llcp_npp_check_req_msg(&snep_server_data, &resp_code) != NET_NFC_OK)
+			if(_net_nfc_service_llcp_npp_check_req_msg(&npp_server_data, &resp_code) != NET_NFC_OK)
 			{
 
 				DEBUG_SERVER_MSG("Not valid request msg = [0x%X]", resp_code);
@@ -1270,9 +1601,9 @@ static bool _net_nfc_service_llcp_npp_server(net_nfc_llcp_state_t * state, net_n
 			{
 
 				uint32_t information_length = 0;
-				if(_net_nfc_service_llcp_npp_get_information_length(&snep_server_data, &information_length) == NET_NFC_OK){
+				if(_net_nfc_service_llcp_npp_get_information_length(&npp_server_data, &information_length) == NET_NFC_OK){
 
-					DEBUG_SERVER_MSG("MAX capa of server is = [%d] and received byte is = [%d]", SNEP_MAX_BUFFER, snep_server_data.length);
+					DEBUG_SERVER_MSG("MAX capa of server is = [%d] and received byte is = [%d]", SNEP_MAX_BUFFER, npp_server_data.length);
 
 					/* msg = header(fixed 10 byte) + information(changable) */
 					if(information_length + 10 > SNEP_MAX_BUFFER)
@@ -1302,11 +1633,11 @@ static bool _net_nfc_service_llcp_npp_server(net_nfc_llcp_state_t * state, net_n
 						fragment->length = information_length + 10;
 						state->user_data = fragment;
 
-						memcpy(fragment->buffer, snep_server_data.buffer, snep_server_data.length);
+						memcpy(fragment->buffer, npp_server_data.buffer, npp_server_data.length);
 
 						/* set zero. this is first time */
 						state->fragment_offset = 0;
-						state->fragment_offset += snep_server_data.length;
+						state->fragment_offset += npp_server_data.length;
 
 						resp_msg = _net_nfc_service_llcp_snep_create_msg(SNEP_RESP_CONT, NULL);
 
@@ -1329,9 +1660,9 @@ static bool _net_nfc_service_llcp_npp_server(net_nfc_llcp_state_t * state, net_n
 						data_s temp = {NULL, 0};
 
 						/* version, command, information_length are head. */
-						temp.buffer = snep_server_data.buffer + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint32_t) + sizeof(uint32_t);
+						temp.buffer = npp_server_data.buffer + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint32_t) + sizeof(uint32_t);
 						DEBUG_SERVER_MSG("check the string = [%s]" , temp.buffer );
-						 if((_net_nfc_service_llcp_npp_get_information_length(&snep_server_data, &(temp.length))) == NET_NFC_OK)
+						 if((_net_nfc_service_llcp_npp_get_information_length(&npp_server_data, &(temp.length))) == NET_NFC_OK)
 						 {
 
 							int client_context;
@@ -1383,8 +1714,8 @@ static bool _net_nfc_service_llcp_npp_server(net_nfc_llcp_state_t * state, net_n
 
 				DEBUG_SERVER_MSG("NPP : Receiving the message is success...");
 	 			state->step = NET_NFC_LLCP_STEP_02;
-				state->handle = current_llcp_server_state.handle;
-				state->incomming_socket = current_llcp_server_state.socket;
+				state->handle = current_npp_server_state.handle;
+				state->incomming_socket = current_npp_server_state.socket;
 				_net_nfc_service_llcp_npp_server(state, &error);
 
 			}
@@ -1405,10 +1736,10 @@ static bool _net_nfc_service_llcp_npp_server(net_nfc_llcp_state_t * state, net_n
 
 			state->step = NET_NFC_LLCP_STEP_06;
 
-			memset(snep_server_data.buffer,  0x00, SNEP_MAX_BUFFER);
-			snep_server_data.length = SNEP_MAX_BUFFER;
+			memset(npp_server_data.buffer,  0x00, SNEP_MAX_BUFFER);
+			npp_server_data.length = SNEP_MAX_BUFFER;
 
-			if(net_nfc_controller_llcp_recv(state->handle, state->socket , &snep_server_data, result, state) == false)
+			if(net_nfc_controller_llcp_recv(state->handle, state->socket , &npp_server_data, result, state) == false)
 			{
 	 			state->step = NET_NFC_STATE_ERROR;
 				break;
@@ -1427,30 +1758,30 @@ static bool _net_nfc_service_llcp_npp_server(net_nfc_llcp_state_t * state, net_n
 				break;
 			}
 
-			if(((data_s*)state->user_data)->length > (snep_server_data.length + state->fragment_offset)){
+			if(((data_s*)state->user_data)->length > (npp_server_data.length + state->fragment_offset)){
 
 				/* receive more */
 				/* copy fragment to buffer. */
 				data_s* fragment = state->user_data;
 				if(fragment != NULL)
 				{
-					memcpy(fragment->buffer + state->fragment_offset, snep_server_data.buffer, snep_server_data.length);
-					state->fragment_offset += snep_server_data.length;
+					memcpy(fragment->buffer + state->fragment_offset, npp_server_data.buffer, npp_server_data.length);
+					state->fragment_offset += npp_server_data.length;
 				}
 
 				state->step = NET_NFC_LLCP_STEP_06;
 
-				memset(snep_server_data.buffer,  0x00, SNEP_MAX_BUFFER);
-				snep_server_data.length = SNEP_MAX_BUFFER;
+				memset(npp_server_data.buffer,  0x00, SNEP_MAX_BUFFER);
+				npp_server_data.length = SNEP_MAX_BUFFER;
 
-				if(net_nfc_controller_llcp_recv(state->handle, state->socket , &snep_server_data, result, state) == false)
+				if(net_nfc_controller_llcp_recv(state->handle, state->socket , &npp_server_data, result, state) == false)
 				{
 		 			state->step = NET_NFC_STATE_ERROR;
 					break;
 				}
 
 			}
-			else if(((data_s*)state->user_data)->length == (snep_server_data.length + state->fragment_offset))
+			else if(((data_s*)state->user_data)->length == (npp_server_data.length + state->fragment_offset))
 			{
 
 				/* receving is completed  */
@@ -1458,8 +1789,8 @@ static bool _net_nfc_service_llcp_npp_server(net_nfc_llcp_state_t * state, net_n
 				data_s* fragment = state->user_data;
 				if(fragment != NULL)
 				{
-					memcpy(fragment->buffer + state->fragment_offset, snep_server_data.buffer, snep_server_data.length);
-					state->fragment_offset += snep_server_data.length;
+					memcpy(fragment->buffer + state->fragment_offset, npp_server_data.buffer, npp_server_data.length);
+					state->fragment_offset += npp_server_data.length;
 				}
 
 				data_s* resp_msg = _net_nfc_service_llcp_snep_create_msg(SNEP_RESP_SUCCESS, NULL);
@@ -1537,8 +1868,8 @@ static bool _net_nfc_service_llcp_npp_server(net_nfc_llcp_state_t * state, net_n
 			net_nfc_error_e error;
 
 			state->step = NET_NFC_LLCP_STEP_02;
-			state->handle = current_llcp_server_state.handle;
-			state->incomming_socket = current_llcp_server_state.socket;
+			state->handle = current_npp_server_state.handle;
+			state->incomming_socket = current_npp_server_state.socket;
 			_net_nfc_service_llcp_npp_server(state, &error);
 
 
@@ -1616,7 +1947,7 @@ static bool _net_nfc_service_llcp_client(net_nfc_llcp_state_t * state, net_nfc_e
 		{
 			DEBUG_SERVER_MSG("step 1");
 
-			if(net_nfc_controller_llcp_create_socket(&(state->socket), NET_NFC_LLCP_SOCKET_TYPE_CONNECTIONORIENTED, SNEP_MAX_BUFFER, 1, result, state) == false)
+			if(net_nfc_controller_llcp_create_socket(&(state->socket), NET_NFC_LLCP_SOCKET_TYPE_CONNECTIONORIENTED, SNEP_MAX_BUFFER, net_nfc_service_llcp_link_get_socket_rw(), result, state) == false)
 			{
 	 			state->step = NET_NFC_STATE_ERROR;
 				DEBUG_SERVER_MSG(" Fail to Create socket for SNEP in client.");
@@ -36,6 +36,34 @@ static uint8_t conn_handover_sel_buffer[CH_MAX_BUFFER] = {0,};
 static data_s conn_handover_req_data = {conn_handover_req_buffer, CH_MAX_BUFFER};
 static data_s conn_handover_sel_data = {conn_handover_sel_buffer, CH_MAX_BUFFER};
 
+/* carrier configuration records are serialized in advance when carrier state is changed,
+ * so handover does not need to query carrier stack at tap time */
+typedef struct _net_nfc_handover_carrier_cache_s
+{
+	bool valid;
+	uint8_t tnf;
+	data_s type;
+	data_s payload;
+} net_nfc_handover_carrier_cache_s;
+
+static net_nfc_handover_carrier_cache_s carrier_cache[NET_NFC_CONN_HANDOVER_CARRIER_UNKNOWN];
+
+/* oob data must not be sent twice, so only local address of bluetooth record is cached
+ * and oob data is read whenever the record is made */
+static bluetooth_device_address_t bt_local_address;
+static bool bt_local_address_valid = false;
+
+/* addresses of bonded bluetooth devices, it is kept up to date by bond events
+ * so handover does not need to ask bluetooth stack on every tap */
+static GHashTable *bonded_devices = NULL;
+static bool bonded_devices_loaded = false;
+
+/* bluetooth api keeps one callback per process, so daemon registers it once
+ * and handover steps are attached to it while they are waiting bluetooth events */
+static bool bt_event_registered = false;
+static bluetooth_cb_func_ptr bt_event_handler = NULL;
+static void *bt_event_user_data = NULL;
+
 static bool _net_nfc_service_llcp_check_hr_record_validation(ndef_message_s * message);
 static bool _net_nfc_service_llcp_check_hs_record_validation(ndef_message_s * message);
 
@@ -45,8 +73,8 @@ net_nfc_error_e net_nfc_service_llcp_handover_get_oob_data(net_nfc_carrier_confi
 net_nfc_error_e net_nfc_service_llcp_handover_create_carrier_configs(ndef_message_s *msg, net_nfc_conn_handover_carrier_type_e type, bool requester, net_nfc_llcp_state_t *state, int next_step);
 int net_nfc_service_llcp_handover_append_bt_carrier_config(net_nfc_handover_create_config_context_t *context);
 int net_nfc_service_llcp_handover_append_wifi_carrier_config(net_nfc_handover_create_config_context_t *context);
-int net_nfc_service_llcp_handover_iterate_carrier_configs(net_nfc_handover_create_config_context_t *context);
-int net_nfc_service_llcp_handover_go_to_next_config(net_nfc_handover_create_config_context_t *context);
+int net_nfc_service_llcp_handover_start_carrier_config(net_nfc_handover_create_config_context_t *context);
+int net_nfc_service_llcp_handover_complete_carrier_config(net_nfc_handover_create_config_context_t *context);
 static void _net_nfc_service_llcp_bt_create_config_cb(int event, bluetooth_event_param_t *param, void *user_data);
 
 net_nfc_error_e net_nfc_service_llcp_handover_process_carrier_config(net_nfc_carrier_config_s *config, bool requester, net_nfc_llcp_state_t *state, int next_step);
@@ -55,6 +83,190 @@ int net_nfc_service_llcp_handover_process_bt_config(net_nfc_handover_process_con
 int net_nfc_service_llcp_handover_return_to_step(net_nfc_handover_context_t *context);
 net_nfc_error_e net_nfc_service_llcp_handover_bt_change_data_order(net_nfc_carrier_config_s *config);
 
+typedef int (*net_nfc_handover_append_carrier_config_cb)(net_nfc_handover_create_config_context_t *context);
+
+typedef struct _net_nfc_handover_carrier_gatherer_s
+{
+	net_nfc_conn_handover_carrier_type_e type;
+	net_nfc_handover_append_carrier_config_cb append;
+} net_nfc_handover_carrier_gatherer_s;
+
+/* carriers are gathered at the same time and appended to message in this order */
+static net_nfc_handover_carrier_gatherer_s carrier_gatherers[] =
+{
+	{ NET_NFC_CONN_HANDOVER_CARRIER_BT, net_nfc_service_llcp_handover_append_bt_carrier_config },
+//	{ NET_NFC_CONN_HANDOVER_CARRIER_WIFI_BSS, net_nfc_service_llcp_handover_append_wifi_carrier_config },
+//	{ NET_NFC_CONN_HANDOVER_CARRIER_WIFI_IBSS, net_nfc_service_llcp_handover_append_wifi_carrier_config },
+};
+
+/* handover request is prepared when llcp is activated. its random number is kept to resolve
+ * collision in one exchange when remote device sends handover request at the same time */
+typedef struct _net_nfc_handover_negotiation_s
+{
+	ndef_message_s *prepared_request;
+	unsigned short random_number;
+	bool random_valid;
+	net_nfc_llcp_state_t *requester;
+	bool yielded; /* local device becomes selector, so requester does not pair */
+} net_nfc_handover_negotiation_s;
+
+static net_nfc_handover_negotiation_s negotiation = { NULL, 0, false, NULL, false };
+
+static void _net_nfc_service_llcp_handover_prepare_request(void)
+{
+	ndef_message_s *message = NULL;
+	unsigned short random_number = 0;
+
+	if (negotiation.prepared_request != NULL)
+	{
+		net_nfc_util_free_ndef_message(negotiation.prepared_request);
+		negotiation.prepared_request = NULL;
+	}
+
+	negotiation.random_valid = false;
+
+	net_nfc_util_create_handover_random_number(&random_number);
+
+	if (net_nfc_util_create_handover_request_message_with_random_number(&message, random_number) == NET_NFC_OK)
+	{
+		negotiation.prepared_request = message;
+		negotiation.random_number = random_number;
+		negotiation.random_valid = true;
+
+		DEBUG_SERVER_MSG("handover request is prepared, random number [0x%04x]", random_number);
+	}
+	else
+	{
+		DEBUG_ERR_MSG("net_nfc_util_create_handover_request_message_with_random_number failed");
+	}
+}
+
+void net_nfc_service_llcp_handover_prepare_request(void)
+{
+	LOGD("[%s:%d] START", __func__, __LINE__);
+
+	/* new link, previous requester is not valid anymore */
+	negotiation.requester = NULL;
+	negotiation.yielded = false;
+
+	_net_nfc_service_llcp_handover_prepare_request();
+
+	LOGD("[%s:%d] END", __func__, __LINE__);
+}
+
+static net_nfc_error_e _net_nfc_service_llcp_handover_take_request(ndef_message_s **message)
+{
+	if (negotiation.prepared_request == NULL)
+	{
+		_net_nfc_service_llcp_handover_prepare_request();
+	}
+
+	if (negotiation.prepared_request == NULL)
+	{
+		return NET_NFC_ALLOC_FAIL;
+	}
+
+	/* random number is kept until the request is finished */
+	*message = negotiation.prepared_request;
+	negotiation.prepared_request = NULL;
+
+	return NET_NFC_OK;
+}
+
+static void _net_nfc_service_llcp_handover_release_requester(net_nfc_llcp_state_t *state)
+{
+	if (negotiation.requester == state)
+	{
+		negotiation.requester = NULL;
+		negotiation.yielded = false;
+
+		if (negotiation.prepared_request == NULL)
+		{
+			/* random number of finished request must not be used again */
+			negotiation.random_valid = false;
+		}
+	}
+}
+
+static void _net_nfc_service_llcp_handover_resolve_collision(ndef_message_s *request_msg)
+{
+	unsigned short remote_number = 0;
+	unsigned short local_number = negotiation.random_number;
+	bool local_is_selector;
+
+	if (negotiation.requester == NULL || negotiation.random_valid == false)
+	{
+		/* no collision */
+		return;
+	}
+
+	if (negotiation.requester->step == NET_NFC_LLCP_STEP_06 || negotiation.requester->step == 0)
+	{
+		/* local requester is already processing select message */
+		DEBUG_SERVER_MSG("local request is already answered, collision is not resolved");
+		return;
+	}
+
+	if (net_nfc_util_get_handover_random_number(request_msg, &remote_number) != NET_NFC_OK)
+	{
+		DEBUG_SERVER_MSG("remote request does not have collision resolution record");
+		return;
+	}
+
+	if (remote_number == local_number)
+	{
+		/* both devices keep requester role like the devices which do not resolve collision */
+		DEBUG_SERVER_MSG("same random number [0x%04x], collision is not resolved", local_number);
+		return;
+	}
+
+	/* same bit 0 : bigger number is selector, different bit 0 : smaller number is selector */
+	if (((local_number ^ remote_number) & 0x1) == 0)
+	{
+		local_is_selector = (local_number > remote_number);
+	}
+	else
+	{
+		local_is_selector = (local_number < remote_number);
+	}
+
+	DEBUG_SERVER_MSG("collision, local [0x%04x], remote [0x%04x], local device is %s", local_number, remote_number, local_is_selector ? "selector" : "requester");
+
+	negotiation.yielded = local_is_selector;
+}
+
+static void _net_nfc_service_llcp_handover_send_response(net_nfc_exchanger_event_e event, net_nfc_conn_handover_carrier_type_e type, data_s *data);
+net_nfc_error_e _net_nfc_service_llcp_get_carrier_record(ndef_message_s *select_msg, ndef_record_s **carrier_record);
+
+static void _net_nfc_service_llcp_handover_send_yielded_response(ndef_message_s *select_msg)
+{
+	ndef_record_s *carrier_record = NULL;
+	net_nfc_carrier_config_s *config = NULL;
+	data_s data = { NULL, 0 };
+
+	/* remote device pairs with us, so report selected carrier to client without pairing */
+	if (_net_nfc_service_llcp_get_carrier_record(select_msg, &carrier_record) == NET_NFC_OK
+		&& net_nfc_util_create_carrier_config_from_config_record(&config, carrier_record) == NET_NFC_OK)
+	{
+		net_nfc_util_get_carrier_config_property(config, NET_NFC_BT_ATTRIBUTE_ADDRESS, (uint16_t *)&data.length, &data.buffer);
+		if (data.length == 6)
+		{
+			_net_nfc_service_llcp_handover_send_response(NET_NFC_OK, NET_NFC_CONN_HANDOVER_CARRIER_BT, &data);
+		}
+		else
+		{
+			DEBUG_ERR_MSG("bluetooth address is invalid. [%d] bytes", data.length);
+			_net_nfc_service_llcp_handover_send_response(NET_NFC_OPERATION_FAIL, NET_NFC_CONN_HANDOVER_CARRIER_UNKNOWN, NULL);
+		}
+
+		net_nfc_util_free_carrier_config(config);
+	}
+	else
+	{
+		_net_nfc_service_llcp_handover_send_response(NET_NFC_OPERATION_FAIL, NET_NFC_CONN_HANDOVER_CARRIER_UNKNOWN, NULL);
+	}
+}
+
 net_nfc_error_e net_nfc_service_llcp_handover_send_request_msg(net_nfc_request_connection_handover_t *msg)
 {
 	net_nfc_error_e error = NET_NFC_OK;
@@ -81,6 +293,9 @@ net_nfc_error_e net_nfc_service_llcp_handover_send_request_msg(net_nfc_request_c
 
 	net_nfc_service_llcp_add_state(conn_handover_requester);
 
+	negotiation.requester = conn_handover_requester;
+	negotiation.yielded = false;
+
 	if (net_nfc_service_llcp_connection_handover_requester(conn_handover_requester, &error) == true)
 	{
 		error = NET_NFC_OK;
@@ -289,14 +504,18 @@ net_nfc_error_e _net_nfc_service_llcp_get_carrier_record_by_priority_order(ndef_
 	{
 		int idx, priority;
 		net_nfc_conn_handover_carrier_type_e carrier_type = NET_NFC_CONN_HANDOVER_CARRIER_UNKNOWN;
+		net_nfc_conn_handover_carrier_type_e priority_order[NET_NFC_CARRIER_BACKEND_MAX];
+		int priority_count = NET_NFC_CARRIER_BACKEND_MAX;
 
-		/* apply priority (order NET_NFC_CONN_HANDOVER_CARRIER_BT ~ NET_NFC_CONN_HANDOVER_CARRIER_WIFI_IBSS) */
-		for (priority = NET_NFC_CONN_HANDOVER_CARRIER_BT; *record == NULL && priority < NET_NFC_CONN_HANDOVER_CARRIER_UNKNOWN; priority++)
+		/* apply priority of ready carrier backends */
+		net_nfc_util_get_carrier_priority_order(priority_order, &priority_count);
+
+		for (priority = 0; *record == NULL && priority < priority_count; priority++)
 		{
 			/* check each carrier record and create matched record */
 			for (idx = 0; idx < carrier_count; idx++)
 			{
-				if ((net_nfc_util_get_alternative_carrier_type(request_msg, idx, &carrier_type) == NET_NFC_OK) && (carrier_type == priority))
+				if ((net_nfc_util_get_alternative_carrier_type(request_msg, idx, &carrier_type) == NET_NFC_OK) && (carrier_type == priority_order[priority]))
 				{
 					DEBUG_SERVER_MSG("selected carrier type = [%d]", carrier_type);
 					net_nfc_util_get_carrier_config_record(request_msg, idx, record);
@@ -429,6 +648,8 @@ bool net_nfc_service_llcp_connection_handover_selector(net_nfc_llcp_state_t *sta
 			{
 				unsigned int count = 0;
 
+				_net_nfc_service_llcp_handover_resolve_collision(state->requester);
+
 				if ((*result = net_nfc_util_get_alternative_carrier_record_count(state->requester, &count)) == NET_NFC_OK)
 				{
 					/* create selector message */
@@ -838,7 +1059,7 @@ bool net_nfc_service_llcp_connection_handover_requester(net_nfc_llcp_state_t *st
 
 			state->step = NET_NFC_LLCP_STEP_03;
 
-			if ((*result = net_nfc_util_create_handover_request_message(&state->requester)) == NET_NFC_OK)
+			if ((*result = _net_nfc_service_llcp_handover_take_request(&state->requester)) == NET_NFC_OK)
 			{
 				net_nfc_conn_handover_carrier_type_e carrier_type;
 
@@ -963,7 +1184,9 @@ bool net_nfc_service_llcp_connection_handover_requester(net_nfc_llcp_state_t *st
 
 							if ((*result = net_nfc_util_create_carrier_config_from_config_record(&handover_config, carrier_record)) == NET_NFC_OK)
 							{
-								net_nfc_service_llcp_handover_process_carrier_config(handover_config, true, state, NET_NFC_LLCP_STEP_06);
+								bool requester = (negotiation.requester != state || negotiation.yielded == false);
+
+								net_nfc_service_llcp_handover_process_carrier_config(handover_config, requester, state, NET_NFC_LLCP_STEP_06);
 							}
 							else
 							{
@@ -1009,6 +1232,11 @@ bool net_nfc_service_llcp_connection_handover_requester(net_nfc_llcp_state_t *st
 				break;
 			}
 
+			if (negotiation.requester == state && negotiation.yielded == true)
+			{
+				_net_nfc_service_llcp_handover_send_yielded_response(state->selector);
+			}
+
 			net_nfc_util_free_ndef_message(state->requester);
 			net_nfc_util_free_ndef_message(state->selector);
 
@@ -1041,6 +1269,11 @@ bool net_nfc_service_llcp_connection_handover_requester(net_nfc_llcp_state_t *st
 		state->step = 0;
 	}
 
+	if (state->step == 0 || need_clean_up == true)
+	{
+		_net_nfc_service_llcp_handover_release_requester(state);
+	}
+
 	if (need_clean_up == true)
 	{
 		net_nfc_util_free_ndef_message(state->requester);
@@ -1132,15 +1365,82 @@ static bool _net_nfc_service_llcp_check_hs_record_validation(ndef_message_s *mes
 	return true;
 }
 
-static bool _net_nfc_service_llcp_handover_check_bond_device(bluetooth_device_address_t *address)
+static guint _net_nfc_service_llcp_handover_bond_address_hash(gconstpointer key)
+{
+	const bluetooth_device_address_t *address = (const bluetooth_device_address_t *)key;
+	guint hash = 0;
+	int i;
+
+	for (i = 0; i < sizeof(address->addr); i++)
+	{
+		hash = (hash * 31) + address->addr[i];
+	}
+
+	return hash;
+}
+
+static gboolean _net_nfc_service_llcp_handover_bond_address_equal(gconstpointer a, gconstpointer b)
+{
+	return (memcmp(a, b, sizeof(bluetooth_device_address_t)) == 0);
+}
+
+static void _net_nfc_service_llcp_handover_bond_address_free(gpointer data)
+{
+	_net_nfc_manager_util_free_mem(data);
+}
+
+static void _net_nfc_service_llcp_handover_add_bond_device(bluetooth_device_address_t *address)
+{
+	bluetooth_device_address_t *key = NULL;
+
+	if (bonded_devices == NULL || address == NULL)
+		return;
+
+	if (g_hash_table_lookup(bonded_devices, address) != NULL)
+		return;
+
+	_net_nfc_manager_util_alloc_mem(key, sizeof(bluetooth_device_address_t));
+	if (key == NULL)
+	{
+		DEBUG_ERR_MSG("alloc failed, bond cache is dropped");
+		g_hash_table_remove_all(bonded_devices);
+		bonded_devices_loaded = false;
+		return;
+	}
+
+	memcpy(key, address, sizeof(bluetooth_device_address_t));
+	g_hash_table_insert(bonded_devices, key, key);
+}
+
+static void _net_nfc_service_llcp_handover_remove_bond_device(bluetooth_device_address_t *address)
+{
+	if (bonded_devices == NULL || address == NULL)
+		return;
+
+	g_hash_table_remove(bonded_devices, address);
+}
+
+static bool _net_nfc_service_llcp_handover_load_bond_devices(void)
 {
-	bool result = false;
 	int i, ret;
 	GPtrArray *devinfo = NULL;
 	bluetooth_device_info_t *ptr;
 
 	LOGD("[%s] START", __func__);
 
+	if (bonded_devices == NULL)
+	{
+		bonded_devices = g_hash_table_new_full(_net_nfc_service_llcp_handover_bond_address_hash,
+			_net_nfc_service_llcp_handover_bond_address_equal,
+			_net_nfc_service_llcp_handover_bond_address_free, NULL);
+	}
+	else
+	{
+		g_hash_table_remove_all(bonded_devices);
+	}
+
+	bonded_devices_loaded = false;
+
 	/* allocate the g_pointer_array */
 	devinfo = g_ptr_array_new();
 
@@ -1152,28 +1452,22 @@ static bool _net_nfc_service_llcp_handover_check_bond_device(bluetooth_device_ad
 	else
 	{
 		DEBUG_SERVER_MSG("g pointer arrary count : [%d]", devinfo->len);
+
+		bonded_devices_loaded = true;
+
 		for (i = 0; i < devinfo->len; i++)
 		{
 			ptr = g_ptr_array_index(devinfo, i);
 			if (ptr != NULL)
 			{
 				DEBUG_SERVER_MSG("Name [%s]", ptr->device_name.name);
-				DEBUG_SERVER_MSG("Major Class [%d]", ptr->device_class.major_class);
-				DEBUG_SERVER_MSG("Minor Class [%d]", ptr->device_class.minor_class);
-				DEBUG_SERVER_MSG("Service Class [%d]", ptr->device_class.service_class);
 				DEBUG_SERVER_MSG("%2.2X:%2.2X:%2.2X:%2.2X:%2.2X:%2.2X",
 					ptr->device_address.addr[0],
 					ptr->device_address.addr[1], ptr->device_address.addr[2],
 					ptr->device_address.addr[3],
 					ptr->device_address.addr[4], ptr->device_address.addr[5]);
 
-				/* compare selector address */
-				if (memcmp(&(ptr->device_address), address, sizeof(ptr->device_address)) == 0)
-				{
-					DEBUG_SERVER_MSG("Found!!!");
-					result = true;
-					break;
-				}
+				_net_nfc_service_llcp_handover_add_bond_device(&ptr->device_address);
 			}
 		}
 	}
@@ -1183,6 +1477,152 @@ static bool _net_nfc_service_llcp_handover_check_bond_device(bluetooth_device_ad
 
 	LOGD("[%s] END", __func__);
 
+	return bonded_devices_loaded;
+}
+
+static void _net_nfc_service_llcp_handover_handle_bond_event(int event, bluetooth_event_param_t *param);
+
+static void _net_nfc_service_llcp_handover_bt_event_cb(int event, bluetooth_event_param_t *param, void *user_data)
+{
+	/* bonds made by other applications are cached too */
+	_net_nfc_service_llcp_handover_handle_bond_event(event, param);
+
+	if (bt_event_handler != NULL)
+	{
+		bt_event_handler(event, param, bt_event_user_data);
+	}
+}
+
+static bool _net_nfc_service_llcp_handover_register_bt_event(void)
+{
+	if (bt_event_registered == false)
+	{
+		if (bluetooth_register_callback(_net_nfc_service_llcp_handover_bt_event_cb, NULL) < BLUETOOTH_ERROR_NONE)
+		{
+			DEBUG_ERR_MSG("bluetooth_register_callback failed");
+			return false;
+		}
+
+		bt_event_registered = true;
+	}
+
+	return true;
+}
+
+static bool _net_nfc_service_llcp_handover_attach_bt_event(bluetooth_cb_func_ptr handler, void *user_data)
+{
+	if (_net_nfc_service_llcp_handover_register_bt_event() == false)
+		return false;
+
+	bt_event_handler = handler;
+	bt_event_user_data = user_data;
+
+	return true;
+}
+
+static void _net_nfc_service_llcp_handover_detach_bt_event(void)
+{
+	bt_event_handler = NULL;
+	bt_event_user_data = NULL;
+}
+
+void net_nfc_service_llcp_handover_refresh_bond_cache(void)
+{
+	LOGD("[%s:%d] START", __func__, __LINE__);
+
+	/* cache can be trusted only while bond events are received */
+	if (_net_nfc_service_llcp_handover_register_bt_event() == true &&
+		bluetooth_check_adapter() == BLUETOOTH_ADAPTER_ENABLED)
+	{
+		_net_nfc_service_llcp_handover_load_bond_devices();
+	}
+	else
+	{
+		/* bonded list cannot be read while adapter is off, it will be loaded at first lookup */
+		if (bonded_devices != NULL)
+		{
+			g_hash_table_remove_all(bonded_devices);
+		}
+		bonded_devices_loaded = false;
+	}
+
+	LOGD("[%s:%d] END", __func__, __LINE__);
+}
+
+void net_nfc_service_llcp_handover_release_bond_cache(void)
+{
+	if (bt_event_registered == true)
+	{
+		bluetooth_unregister_callback();
+		bt_event_registered = false;
+	}
+
+	_net_nfc_service_llcp_handover_detach_bt_event();
+
+	if (bonded_devices != NULL)
+	{
+		g_hash_table_destroy(bonded_devices);
+		bonded_devices = NULL;
+	}
+	bonded_devices_loaded = false;
+}
+
+static void _net_nfc_service_llcp_handover_handle_bond_event(int event, bluetooth_event_param_t *param)
+{
+	switch (event)
+	{
+	case BLUETOOTH_EVENT_BONDING_FINISHED :
+		if (param->result >= BLUETOOTH_ERROR_NONE && param->param_data != NULL)
+		{
+			bluetooth_device_info_t *info = (bluetooth_device_info_t *)param->param_data;
+
+			_net_nfc_service_llcp_handover_add_bond_device(&info->device_address);
+		}
+		break;
+
+	case BLUETOOTH_EVENT_BONDED_DEVICE_REMOVED :
+		if (param->result >= BLUETOOTH_ERROR_NONE && param->param_data != NULL)
+		{
+			_net_nfc_service_llcp_handover_remove_bond_device((bluetooth_device_address_t *)param->param_data);
+		}
+		break;
+
+	default :
+		break;
+	}
+}
+
+static bool _net_nfc_service_llcp_handover_check_bond_device(bluetooth_device_address_t *address)
+{
+	bool result = false;
+
+	LOGD("[%s] START", __func__);
+
+	if (bt_event_registered == false)
+	{
+		bluetooth_device_info_t info = { { { 0 } } };
+
+		/* bond events are not received, so cache can not be used */
+		result = (bluetooth_get_bonded_device(address, &info) == BLUETOOTH_ERROR_NONE);
+	}
+	else
+	{
+		/* adapter is enabled at this step, list is read once if it was off when cache was refreshed */
+		if (bonded_devices_loaded == false)
+		{
+			_net_nfc_service_llcp_handover_load_bond_devices();
+		}
+
+		result = (bonded_devices_loaded == true && g_hash_table_lookup(bonded_devices, address) != NULL);
+	}
+
+	if (result == true)
+	{
+		DEBUG_SERVER_MSG("Found!!!");
+	}
+
+	LOGD("[%s] END", __func__);
+
 	return result;
 }
 
@@ -1203,8 +1643,9 @@ static void _net_nfc_service_llcp_bt_create_config_cb(int event, bluetooth_event
 	{
 	case BLUETOOTH_EVENT_ENABLED :
 		DEBUG_SERVER_MSG("BLUETOOTH_EVENT_ENABLED");
-		if (context->step == NET_NFC_LLCP_STEP_02)
+		if (context->step == NET_NFC_LLCP_STEP_02 && context->wait_event == true)
 		{
+			context->wait_event = false;
 			net_nfc_service_llcp_handover_append_bt_carrier_config(context);
 		}
 		else
@@ -1225,6 +1666,170 @@ static void _net_nfc_service_llcp_bt_create_config_cb(int event, bluetooth_event
 	LOGD("[%s] END", __func__);
 }
 
+static bool _net_nfc_service_llcp_handover_load_bt_local_address(void)
+{
+	int ret;
+
+	bt_local_address_valid = false;
+
+	if ((ret = bluetooth_get_local_address(&bt_local_address)) != BLUETOOTH_ERROR_NONE)
+	{
+		DEBUG_ERR_MSG("bluetooth_get_local_address failed [%d]", ret);
+		return false;
+	}
+
+	bt_local_address_valid = true;
+
+	return true;
+}
+
+/* new oob data is read for every record, reading it makes the previous one invalid */
+static net_nfc_error_e _net_nfc_service_llcp_handover_create_bt_carrier_record(ndef_record_s **record)
+{
+	net_nfc_error_e result = NET_NFC_UNKNOWN_ERROR;
+	net_nfc_carrier_config_s *config = NULL;
+	bt_oob_data_t oob = { { 0 }, };
+
+	if (bt_local_address_valid == false && _net_nfc_service_llcp_handover_load_bt_local_address() == false)
+	{
+		return NET_NFC_OPERATION_FAIL;
+	}
+
+	if ((result = net_nfc_util_create_carrier_config(&config, NET_NFC_CONN_HANDOVER_CARRIER_BT)) != NET_NFC_OK)
+	{
+		DEBUG_ERR_MSG("net_nfc_util_create_carrier_config failed [%d]", result);
+		return result;
+	}
+
+	if ((result = net_nfc_util_add_carrier_config_property(config, NET_NFC_BT_ATTRIBUTE_ADDRESS, sizeof(bt_local_address.addr), bt_local_address.addr)) != NET_NFC_OK)
+	{
+		DEBUG_ERR_MSG("net_nfc_util_add_carrier_config_property failed [%d]", result);
+	}
+
+	/* get oob data */
+	bluetooth_oob_read_local_data(&oob);
+
+	if (oob.hash_len == 16)
+	{
+		DEBUG_SERVER_MSG("oob.hash_len [%d]", oob.hash_len);
+
+		if ((result = net_nfc_util_add_carrier_config_property(config, NET_NFC_BT_ATTRIBUTE_OOB_HASH_C, oob.hash_len, oob.hash)) != NET_NFC_OK)
+		{
+			DEBUG_ERR_MSG("net_nfc_util_add_carrier_config_property failed [%d]", result);
+		}
+	}
+
+	if (oob.randomizer_len == 16)
+	{
+		DEBUG_SERVER_MSG("oob.randomizer_len [%d]", oob.randomizer_len);
+
+		if ((result = net_nfc_util_add_carrier_config_property(config, NET_NFC_BT_ATTRIBUTE_OOB_HASH_R, oob.randomizer_len, oob.randomizer)) != NET_NFC_OK)
+		{
+			DEBUG_ERR_MSG("net_nfc_util_add_carrier_config_property failed [%d]", result);
+		}
+	}
+
+	net_nfc_service_llcp_handover_bt_change_data_order(config);
+
+	if ((result = net_nfc_util_create_ndef_record_with_carrier_config(record, config)) != NET_NFC_OK)
+	{
+		DEBUG_ERR_MSG("net_nfc_util_create_ndef_record_with_carrier_config failed [%d]", result);
+	}
+
+	net_nfc_util_free_carrier_config(config);
+
+	return result;
+}
+
+static void _net_nfc_service_llcp_handover_invalidate_carrier_cache(net_nfc_conn_handover_carrier_type_e type)
+{
+	net_nfc_handover_carrier_cache_s *cache = &carrier_cache[type];
+
+	if (cache->valid == true)
+	{
+		DEBUG_SERVER_MSG("carrier [%d] record cache is invalidated", type);
+	}
+
+	net_nfc_util_free_data(&cache->type);
+	net_nfc_util_free_data(&cache->payload);
+	cache->valid = false;
+}
+
+static bool _net_nfc_service_llcp_handover_get_cached_carrier_record(net_nfc_handover_create_config_context_t *context)
+{
+	net_nfc_handover_carrier_cache_s *cache = NULL;
+	net_nfc_error_e result = NET_NFC_OK;
+
+	if (context->current_type >= NET_NFC_CONN_HANDOVER_CARRIER_UNKNOWN)
+		return false;
+
+	if (context->current_type == NET_NFC_CONN_HANDOVER_CARRIER_BT)
+	{
+		/* adapter is known to be enabled while local address is valid */
+		if (bt_local_address_valid == false)
+			return false;
+
+		if ((result = _net_nfc_service_llcp_handover_create_bt_carrier_record(&context->record)) != NET_NFC_OK)
+		{
+			DEBUG_ERR_MSG("_net_nfc_service_llcp_handover_create_bt_carrier_record failed [%d]", result);
+			return false;
+		}
+
+		DEBUG_SERVER_MSG("bluetooth record is made with cached address");
+
+		context->result = NET_NFC_OK;
+
+		return true;
+	}
+
+	cache = &carrier_cache[context->current_type];
+	if (cache->valid == false)
+		return false;
+
+	if ((result = net_nfc_util_create_record(cache->tnf, &cache->type, NULL, &cache->payload, &context->record)) != NET_NFC_OK)
+	{
+		DEBUG_ERR_MSG("net_nfc_util_create_record failed [%d]", result);
+		return false;
+	}
+
+	DEBUG_SERVER_MSG("carrier [%d] record is taken from cache", context->current_type);
+
+	context->result = NET_NFC_OK;
+
+	return true;
+}
+
+void net_nfc_service_llcp_handover_refresh_carrier_cache(net_nfc_conn_handover_carrier_type_e type)
+{
+	LOGD("[%s:%d] START", __func__, __LINE__);
+
+	switch (type)
+	{
+	case NET_NFC_CONN_HANDOVER_CARRIER_BT :
+		/* oob data is not read here, so the data which is being sent is kept valid */
+		if (bluetooth_check_adapter() == BLUETOOTH_ADAPTER_ENABLED)
+		{
+			_net_nfc_service_llcp_handover_load_bt_local_address();
+		}
+		else
+		{
+			bt_local_address_valid = false;
+		}
+		break;
+
+	case NET_NFC_CONN_HANDOVER_CARRIER_WIFI_BSS :
+	case NET_NFC_CONN_HANDOVER_CARRIER_WIFI_IBSS :
+		/* wifi carrier config is not supported yet, just drop old one */
+		_net_nfc_service_llcp_handover_invalidate_carrier_cache(type);
+		break;
+
+	default :
+		break;
+	}
+
+	LOGD("[%s:%d] END", __func__, __LINE__);
+}
+
 int net_nfc_service_llcp_handover_return_to_step(net_nfc_handover_context_t *context)
 {
 	LOGD("[%s:%d] START", __func__, __LINE__);
@@ -1257,31 +1862,109 @@ int net_nfc_service_llcp_handover_return_to_step(net_nfc_handover_context_t *con
 	return 0;
 }
 
-int net_nfc_service_llcp_handover_go_to_next_config(net_nfc_handover_create_config_context_t *context)
+static net_nfc_handover_carrier_gatherer_s *_net_nfc_service_llcp_handover_get_carrier_gatherer(net_nfc_conn_handover_carrier_type_e type)
+{
+	int i;
+
+	for (i = 0; i < sizeof(carrier_gatherers) / sizeof(carrier_gatherers[0]); i++)
+	{
+		if (carrier_gatherers[i].type == type)
+			return &carrier_gatherers[i];
+	}
+
+	return NULL;
+}
+
+static void _net_nfc_service_llcp_handover_join_carrier_configs(net_nfc_handover_create_config_context_t *context)
 {
+	GList *list = NULL;
+
 	LOGD("[%s:%d] START", __func__, __LINE__);
 
-	if (context->result == NET_NFC_OK || context->result == NET_NFC_BUSY)
+	/* every carrier is completed, assemble message in carrier order */
+	for (list = g_list_first(context->carriers); list != NULL; list = g_list_next(list))
 	{
-		if (context->request_type == NET_NFC_CONN_HANDOVER_CARRIER_UNKNOWN)
+		net_nfc_handover_create_config_context_t *carrier = (net_nfc_handover_create_config_context_t *)list->data;
+		net_nfc_error_e result;
+
+		if (carrier->result == NET_NFC_OK && carrier->record != NULL)
 		{
-			if (context->current_type < NET_NFC_CONN_HANDOVER_CARRIER_UNKNOWN)
+			if ((result = net_nfc_util_append_carrier_config_record(context->ndef_message, carrier->record, 0)) == NET_NFC_OK)
 			{
-				context->current_type++;
+				DEBUG_SERVER_MSG("carrier [%d] record is appended", carrier->current_type);
+
+				carrier->record = NULL;
+			}
+			else
+			{
+				DEBUG_ERR_MSG("net_nfc_util_append_carrier_config_record failed [%d]", result);
 			}
 		}
 		else
 		{
-			context->current_type = NET_NFC_CONN_HANDOVER_CARRIER_UNKNOWN;
+			DEBUG_ERR_MSG("carrier [%d] is failed [%d]", carrier->current_type, carrier->result);
+		}
+
+		if (carrier->record != NULL)
+		{
+			net_nfc_util_free_record(carrier->record);
 		}
 
-		g_idle_add((GSourceFunc)net_nfc_service_llcp_handover_iterate_carrier_configs, (gpointer)context);
+		_net_nfc_manager_util_free_mem(carrier);
 	}
-	else
+
+	g_list_free(context->carriers);
+	context->carriers = NULL;
+
+	net_nfc_service_llcp_handover_return_to_step((net_nfc_handover_context_t *)context);
+
+	LOGD("[%s:%d] END", __func__, __LINE__);
+}
+
+static gboolean _net_nfc_service_llcp_handover_carrier_config_timeout(gpointer user_data)
+{
+	net_nfc_handover_create_config_context_t *context = (net_nfc_handover_create_config_context_t *)user_data;
+
+	DEBUG_ERR_MSG("carrier [%d] is not completed in time, step [%d]", context->current_type, context->step);
+
+	context->timer_id = 0;
+	context->result = NET_NFC_OPERATION_FAIL;
+
+	if (context->wait_event == true)
 	{
-		DEBUG_ERR_MSG("context->result is error [%d]", context->result);
+		net_nfc_handover_carrier_gatherer_s *gatherer = _net_nfc_service_llcp_handover_get_carrier_gatherer(context->current_type);
 
-		g_idle_add((GSourceFunc)net_nfc_service_llcp_handover_return_to_step, (gpointer)context);
+		/* nothing is scheduled while waiting carrier stack, so finish it here */
+		context->wait_event = false;
+		context->step = NET_NFC_LLCP_STEP_RETURN;
+
+		if (gatherer != NULL)
+		{
+			g_idle_add((GSourceFunc)gatherer->append, (gpointer)context);
+		}
+	}
+
+	return FALSE;
+}
+
+int net_nfc_service_llcp_handover_complete_carrier_config(net_nfc_handover_create_config_context_t *context)
+{
+	net_nfc_handover_create_config_context_t *parent = context->parent;
+
+	LOGD("[%s:%d] START", __func__, __LINE__);
+
+	if (context->timer_id > 0)
+	{
+		g_source_remove(context->timer_id);
+		context->timer_id = 0;
+	}
+
+	DEBUG_SERVER_MSG("carrier [%d] is completed [%d], remaining [%d]", context->current_type, context->result, parent->pending - 1);
+
+	parent->pending--;
+	if (parent->pending == 0)
+	{
+		_net_nfc_service_llcp_handover_join_carrier_configs(parent);
 	}
 
 	LOGD("[%s:%d] END", __func__, __LINE__);
@@ -1289,36 +1972,28 @@ int net_nfc_service_llcp_handover_go_to_next_config(net_nfc_handover_create_conf
 	return 0;
 }
 
-int net_nfc_service_llcp_handover_iterate_carrier_configs(net_nfc_handover_create_config_context_t *context)
+int net_nfc_service_llcp_handover_start_carrier_config(net_nfc_handover_create_config_context_t *context)
 {
+	net_nfc_handover_carrier_gatherer_s *gatherer = NULL;
+
 	LOGD("[%s:%d] START", __func__, __LINE__);
 
-	switch (context->current_type)
+	if (_net_nfc_service_llcp_handover_get_cached_carrier_record(context) == true)
 	{
-	case NET_NFC_CONN_HANDOVER_CARRIER_BT :
-		DEBUG_MSG("[NET_NFC_CONN_HANDOVER_CARRIER_BT]");
-		g_idle_add((GSourceFunc)net_nfc_service_llcp_handover_append_bt_carrier_config, (gpointer)context);
-		break;
+		net_nfc_service_llcp_handover_complete_carrier_config(context);
+	}
+	else if ((gatherer = _net_nfc_service_llcp_handover_get_carrier_gatherer(context->current_type)) != NULL)
+	{
+		context->timer_id = g_timeout_add(CH_CARRIER_CONFIG_TIMEOUT, _net_nfc_service_llcp_handover_carrier_config_timeout, context);
 
-//	case NET_NFC_CONN_HANDOVER_CARRIER_WIFI_BSS :
-//		DEBUG_MSG("[NET_NFC_CONN_HANDOVER_CARRIER_WIFI_BSS]");
-//		g_idle_add((GSourceFunc)net_nfc_service_llcp_handover_append_wifi_carrier_config, context);
-//		break;
-//
-//	case NET_NFC_CONN_HANDOVER_CARRIER_WIFI_IBSS :
-//		DEBUG_MSG("[NET_NFC_CONN_HANDOVER_CARRIER_WIFI_BSS]");
-//		g_idle_add((GSourceFunc)net_nfc_service_llcp_handover_append_wifi_carrier_config, context);
-//		break;
-//
-	case NET_NFC_CONN_HANDOVER_CARRIER_UNKNOWN :
-		DEBUG_MSG("[NET_NFC_CONN_HANDOVER_CARRIER_UNKNOWN]");
-		g_idle_add((GSourceFunc)net_nfc_service_llcp_handover_return_to_step, (gpointer)context);
-		break;
+		gatherer->append(context);
+	}
+	else
+	{
+		DEBUG_ERR_MSG("[unknown : %d]", context->current_type);
 
-	default :
-		DEBUG_MSG("[unknown : %d]", context->current_type);
-		g_idle_add((GSourceFunc)net_nfc_service_llcp_handover_go_to_next_config, (gpointer)context);
-		break;
+		context->result = NET_NFC_NOT_SUPPORTED;
+		net_nfc_service_llcp_handover_complete_carrier_config(context);
 	}
 
 	LOGD("[%s:%d] END", __func__, __LINE__);
@@ -1330,6 +2005,8 @@ net_nfc_error_e net_nfc_service_llcp_handover_create_carrier_configs(ndef_messag
 {
 	net_nfc_error_e result = NET_NFC_OK;
 	net_nfc_handover_create_config_context_t *context = NULL;
+	GList *list = NULL;
+	int i;
 
 	LOGD("[%s:%d] START", __func__, __LINE__);
 
@@ -1340,15 +2017,57 @@ net_nfc_error_e net_nfc_service_llcp_handover_create_carrier_configs(ndef_messag
 
 		context->request_type = type;
 		context->current_type = context->request_type;
-		if (context->request_type == NET_NFC_CONN_HANDOVER_CARRIER_UNKNOWN)
-			context->current_type = NET_NFC_CONN_HANDOVER_CARRIER_BT;
 		context->is_requester = requester;
 		context->llcp_state = state;
 		context->step = NET_NFC_LLCP_STEP_01;
 		context->ndef_message = msg;
 
-		/* append carrier record */
-		g_idle_add((GSourceFunc)net_nfc_service_llcp_handover_iterate_carrier_configs, (gpointer)context);
+		/* each carrier is gathered with its own context */
+		for (i = 0; i < sizeof(carrier_gatherers) / sizeof(carrier_gatherers[0]); i++)
+		{
+			net_nfc_handover_create_config_context_t *carrier = NULL;
+
+			if (type != NET_NFC_CONN_HANDOVER_CARRIER_UNKNOWN && type != carrier_gatherers[i].type)
+				continue;
+
+			if (net_nfc_util_is_carrier_ready(carrier_gatherers[i].type) == false)
+			{
+				DEBUG_SERVER_MSG("carrier [%d] is not ready", carrier_gatherers[i].type);
+				continue;
+			}
+
+			_net_nfc_manager_util_alloc_mem(carrier, sizeof(net_nfc_handover_create_config_context_t));
+			if (carrier == NULL)
+			{
+				DEBUG_ERR_MSG("alloc failed");
+				continue;
+			}
+
+			carrier->request_type = type;
+			carrier->current_type = carrier_gatherers[i].type;
+			carrier->is_requester = requester;
+			carrier->llcp_state = state;
+			carrier->step = NET_NFC_LLCP_STEP_01;
+			carrier->parent = context;
+
+			context->carriers = g_list_append(context->carriers, carrier);
+			context->pending++;
+		}
+
+		if (context->pending > 0)
+		{
+			/* start all carriers together, the last completed one assembles message */
+			for (list = g_list_first(context->carriers); list != NULL; list = g_list_next(list))
+			{
+				g_idle_add((GSourceFunc)net_nfc_service_llcp_handover_start_carrier_config, list->data);
+			}
+		}
+		else
+		{
+			DEBUG_ERR_MSG("no carrier to gather, type [%d]", type);
+
+			g_idle_add((GSourceFunc)net_nfc_service_llcp_handover_return_to_step, (gpointer)context);
+		}
 	}
 	else
 	{
@@ -1377,13 +2096,15 @@ int net_nfc_service_llcp_handover_append_bt_carrier_config(net_nfc_handover_crea
 	case NET_NFC_LLCP_STEP_01 :
 		DEBUG_MSG("STEP [1]");
 
-		if (bluetooth_register_callback(_net_nfc_service_llcp_bt_create_config_cb, context) >= BLUETOOTH_ERROR_NONE)
+		if (_net_nfc_service_llcp_handover_attach_bt_event(_net_nfc_service_llcp_bt_create_config_cb, context) == true)
 		{
 			context->step = NET_NFC_LLCP_STEP_02;
 			context->result = NET_NFC_OK;
 
 			if (bluetooth_check_adapter() != BLUETOOTH_ADAPTER_ENABLED)
 			{
+				/* next step is started by bluetooth event */
+				context->wait_event = true;
 				bluetooth_enable_adapter();
 			}
 			else
@@ -1407,84 +2128,22 @@ int net_nfc_service_llcp_handover_append_bt_carrier_config(net_nfc_handover_crea
 	case NET_NFC_LLCP_STEP_02 :
 		{
 			net_nfc_error_e result = NET_NFC_UNKNOWN_ERROR;
-			net_nfc_carrier_config_s *config = NULL;
 			ndef_record_s *record = NULL;
-			bluetooth_device_address_t bt_addr = { { 0, } };
 
 			DEBUG_MSG("STEP [2]");
 
 			context->step = NET_NFC_LLCP_STEP_RETURN;
 
-			/* append config to ndef message */
-			if ((result = bluetooth_get_local_address(&bt_addr)) == BLUETOOTH_ERROR_NONE)
+			/* create config record, local address is kept for next handover */
+			if ((result = _net_nfc_service_llcp_handover_create_bt_carrier_record(&record)) == NET_NFC_OK)
 			{
-				if ((result = net_nfc_util_create_carrier_config(&config, NET_NFC_CONN_HANDOVER_CARRIER_BT)) == NET_NFC_OK)
-				{
-					bt_oob_data_t oob = { { 0 }, };
-
-					if ((result = net_nfc_util_add_carrier_config_property(config, NET_NFC_BT_ATTRIBUTE_ADDRESS, sizeof(bt_addr.addr), bt_addr.addr)) != NET_NFC_OK)
-					{
-						DEBUG_ERR_MSG("net_nfc_util_add_carrier_config_property failed [%d]", result);
-					}
-
-					/* get oob data */
-					bluetooth_oob_read_local_data(&oob);
-
-					if (oob.hash_len == 16)
-					{
-						DEBUG_SERVER_MSG("oob.hash_len [%d]", oob.hash_len);
-
-						if ((result = net_nfc_util_add_carrier_config_property(config, NET_NFC_BT_ATTRIBUTE_OOB_HASH_C, oob.hash_len, oob.hash)) != NET_NFC_OK)
-						{
-							DEBUG_ERR_MSG("net_nfc_util_add_carrier_config_property failed [%d]", result);
-						}
-					}
-
-					if (oob.randomizer_len == 16)
-					{
-						DEBUG_SERVER_MSG("oob.randomizer_len [%d]", oob.randomizer_len);
-
-						if ((result = net_nfc_util_add_carrier_config_property(config, NET_NFC_BT_ATTRIBUTE_OOB_HASH_R, oob.randomizer_len, oob.randomizer)) != NET_NFC_OK)
-						{
-							DEBUG_ERR_MSG("net_nfc_util_add_carrier_config_property failed [%d]", result);
-						}
-					}
-
-					net_nfc_service_llcp_handover_bt_change_data_order(config);
-
-					if ((result = net_nfc_util_create_ndef_record_with_carrier_config(&record, config)) == NET_NFC_OK)
-					{
-						if ((result = net_nfc_util_append_carrier_config_record(context->ndef_message, record, 0)) == NET_NFC_OK)
-						{
-							DEBUG_SERVER_MSG("net_nfc_util_append_carrier_config_record success");
-
-							context->result = result;
-						}
-						else
-						{
-							DEBUG_ERR_MSG("net_nfc_util_append_carrier_config_record failed [%d]", result);
-
-							net_nfc_util_free_record(record);
-							context->result = result;
-						}
-					}
-					else
-					{
-						DEBUG_ERR_MSG("net_nfc_util_create_ndef_record_with_carrier_config failed [%d]", result);
-						context->result = NET_NFC_OPERATION_FAIL;
-					}
-
-					net_nfc_util_free_carrier_config(config);
-				}
-				else
-				{
-					DEBUG_ERR_MSG("net_nfc_util_create_carrier_config failed [%d]", result);
-					context->result = NET_NFC_OPERATION_FAIL;
-				}
+				/* record is appended when all carriers are completed */
+				context->record = record;
+				context->result = result;
 			}
 			else
 			{
-				DEBUG_ERR_MSG("bluetooth_get_local_address failed [%d]", result);
+				DEBUG_ERR_MSG("_net_nfc_service_llcp_handover_create_bt_carrier_record failed [%d]", result);
 				context->result = NET_NFC_OPERATION_FAIL;
 			}
 
@@ -1496,11 +2155,11 @@ int net_nfc_service_llcp_handover_append_bt_carrier_config(net_nfc_handover_crea
 	case NET_NFC_LLCP_STEP_RETURN :
 		DEBUG_MSG("STEP return");
 
-		/* unregister current callback */
-		bluetooth_unregister_callback();
+		/* stop receiving bluetooth events */
+		_net_nfc_service_llcp_handover_detach_bt_event();
 
 		/* complete and return to upper step */
-		g_idle_add((GSourceFunc)net_nfc_service_llcp_handover_go_to_next_config, (gpointer)context);
+		g_idle_add((GSourceFunc)net_nfc_service_llcp_handover_complete_carrier_config, (gpointer)context);
 		break;
 
 	default :
@@ -1540,7 +2199,7 @@ int net_nfc_service_llcp_handover_append_wifi_carrier_config(net_nfc_handover_cr
 		DEBUG_MSG("STEP return");
 
 		/* complete and return to upper step */
-		g_idle_add((GSourceFunc)net_nfc_service_llcp_handover_go_to_next_config, (gpointer)context);
+		g_idle_add((GSourceFunc)net_nfc_service_llcp_handover_complete_carrier_config, (gpointer)context);
 		break;
 
 	default :
@@ -1666,6 +2325,7 @@ static void _net_nfc_service_llcp_process_bt_config_cb(int event, bluetooth_even
 
 	case BLUETOOTH_EVENT_BONDING_FINISHED :
 		DEBUG_SERVER_MSG("BLUETOOTH_EVENT_BONDING_FINISHED, result [0x%04x]", param->result);
+
 		if (context->step == NET_NFC_LLCP_STEP_03)
 		{
 			if (param->result < BLUETOOTH_ERROR_NONE)
@@ -1682,6 +2342,10 @@ static void _net_nfc_service_llcp_process_bt_config_cb(int event, bluetooth_even
 		}
 		break;
 
+	case BLUETOOTH_EVENT_BONDED_DEVICE_REMOVED :
+		DEBUG_SERVER_MSG("BLUETOOTH_EVENT_BONDED_DEVICE_REMOVED");
+		break;
+
 	default :
 		DEBUG_SERVER_MSG("unhandled bt event [%d], [0x%04x]", event, param->result);
 		break;
@@ -1756,7 +2420,7 @@ int net_nfc_service_llcp_handover_process_bt_config(net_nfc_handover_process_con
 	case NET_NFC_LLCP_STEP_01 :
 		DEBUG_MSG("STEP [1]");
 
-		if (bluetooth_register_callback(_net_nfc_service_llcp_process_bt_config_cb, context) >= BLUETOOTH_ERROR_NONE)
+		if (_net_nfc_service_llcp_handover_attach_bt_event(_net_nfc_service_llcp_process_bt_config_cb, context) == true)
 		{
 			/* next step */
 			context->step = NET_NFC_LLCP_STEP_02;
@@ -1883,8 +2547,8 @@ int net_nfc_service_llcp_handover_process_bt_config(net_nfc_handover_process_con
 	case NET_NFC_LLCP_STEP_RETURN :
 		DEBUG_MSG("STEP return");
 
-		/* unregister bluetooth callback */
-		bluetooth_unregister_callback();
+		/* stop receiving bluetooth events */
+		_net_nfc_service_llcp_handover_detach_bt_event();
 
 		g_idle_add((GSourceFunc)net_nfc_service_llcp_handover_return_to_step, (gpointer)context);
 		break;
@@ -0,0 +1,209 @@
+/*
+  * Copyright 2012  Samsung Electronics Co., Ltd
+  *
+  * Licensed under the Flora License, Version 1.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+
+  *     http://www.tizenopensource.org/license
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  */
+
+
+#include <string.h>
+
+#include "net_nfc_typedef_private.h"
+#include "net_nfc_debug_private.h"
+#include "net_nfc_controller_private.h"
+#include "net_nfc_service_llcp_link_private.h"
+
+/* peers which advertise same link parameters are considered as same class (usually same model) */
+typedef struct _net_nfc_llcp_peer_class_s
+{
+	/* class key, from remote configuration */
+	uint16_t remote_miu;
+	uint16_t remote_wks;
+	uint8_t remote_option;
+
+	/* statistics */
+	uint32_t link_count;
+	uint32_t error_link_count; /* links which got socket error */
+	uint32_t last_link; /* sequence number of last link, to find least recently used class */
+
+	/* tuned parameters for this class */
+	uint16_t miu;
+	uint8_t lto;
+	uint8_t rw;
+} net_nfc_llcp_peer_class_s;
+
+/* configuration given by application or default value, tuning does not go below this */
+static net_nfc_llcp_config_info_s base_config = { NET_NFC_LLCP_LINK_DEFAULT_MIU, 1, NET_NFC_LLCP_LINK_DEFAULT_LTO, 0 };
+/* configuration which is applied to controller now */
+static net_nfc_llcp_config_info_s local_config = { NET_NFC_LLCP_LINK_DEFAULT_MIU, 1, NET_NFC_LLCP_LINK_DEFAULT_LTO, 0 };
+
+static net_nfc_llcp_peer_class_s peer_classes[NET_NFC_LLCP_LINK_MAX_CLASS];
+static int peer_class_count = 0;
+static uint32_t link_sequence = 0;
+
+static net_nfc_llcp_peer_class_s *current_class = NULL;
+static uint32_t current_link_errors = 0;
+
+static net_nfc_llcp_peer_class_s *_net_nfc_service_llcp_link_get_class(net_nfc_llcp_config_info_s *remote)
+{
+	net_nfc_llcp_peer_class_s *peer_class = NULL;
+	int i;
+
+	for (i = 0; i < peer_class_count; i++)
+	{
+		if (peer_classes[i].remote_miu == remote->miu && peer_classes[i].remote_wks == remote->wks && peer_classes[i].remote_option == remote->option)
+		{
+			return &peer_classes[i];
+		}
+	}
+
+	if (peer_class_count < NET_NFC_LLCP_LINK_MAX_CLASS)
+	{
+		peer_class = &peer_classes[peer_class_count++];
+	}
+	else
+	{
+		/* replace least recently used class */
+		peer_class = &peer_classes[0];
+		for (i = 1; i < peer_class_count; i++)
+		{
+			if (peer_classes[i].last_link < peer_class->last_link)
+				peer_class = &peer_classes[i];
+		}
+	}
+
+	memset(peer_class, 0x00, sizeof(net_nfc_llcp_peer_class_s));
+
+	peer_class->remote_miu = remote->miu;
+	peer_class->remote_wks = remote->wks;
+	peer_class->remote_option = remote->option;
+
+	/* start with the largest miu both sides support and conservative window */
+	peer_class->miu = MAX(base_config.miu, MIN(remote->miu, NET_NFC_LLCP_LINK_MAX_MIU));
+	peer_class->lto = base_config.lto;
+	peer_class->rw = 1;
+
+	return peer_class;
+}
+
+static void _net_nfc_service_llcp_link_apply_config(net_nfc_llcp_config_info_s *config)
+{
+	net_nfc_error_e result = NET_NFC_OK;
+
+	if (memcmp(config, &local_config, sizeof(net_nfc_llcp_config_info_s)) == 0)
+		return;
+
+	if (net_nfc_controller_llcp_config(config, &result) == true)
+	{
+		DEBUG_SERVER_MSG("llcp config is changed, miu [%d], wks [0x%04x], lto [%d], option [0x%02x]", config->miu, config->wks, config->lto, config->option);
+		local_config = *config;
+	}
+	else
+	{
+		DEBUG_ERR_MSG("net_nfc_controller_llcp_config failed [%d]", result);
+	}
+}
+
+void net_nfc_service_llcp_link_get_local_config(net_nfc_llcp_config_info_s *config)
+{
+	if (config == NULL)
+		return;
+
+	*config = local_config;
+}
+
+void net_nfc_service_llcp_link_set_base_config(net_nfc_llcp_config_info_s *config)
+{
+	if (config == NULL)
+		return;
+
+	base_config = *config;
+	local_config = *config;
+}
+
+void net_nfc_service_llcp_link_activated(net_nfc_target_handle_s *handle)
+{
+	net_nfc_llcp_config_info_s remote = { 0, };
+	net_nfc_error_e result = NET_NFC_OK;
+
+	link_sequence++;
+	current_class = NULL;
+	current_link_errors = 0;
+
+	if (net_nfc_controller_llcp_get_remote_config(handle, &remote, &result) == false)
+	{
+		DEBUG_ERR_MSG("net_nfc_controller_llcp_get_remote_config failed [%d], link is not tuned", result);
+		return;
+	}
+
+	current_class = _net_nfc_service_llcp_link_get_class(&remote);
+	current_class->link_count++;
+	current_class->last_link = link_sequence;
+
+	DEBUG_SERVER_MSG("remote miu [%d], wks [0x%04x], lto [%d], option [0x%02x] : links [%d], error links [%d], tuned miu [%d], lto [%d], rw [%d]",
+		remote.miu, remote.wks, remote.lto, remote.option, current_class->link_count, current_class->error_link_count,
+		current_class->miu, current_class->lto, current_class->rw);
+}
+
+void net_nfc_service_llcp_link_socket_error(net_nfc_error_e error)
+{
+	if (current_class == NULL)
+		return;
+
+	/* sockets are disconnected whenever link is lost, it is not a link problem */
+	if (error == NET_NFC_LLCP_SOCKET_DISCONNECTED)
+		return;
+
+	DEBUG_SERVER_MSG("socket error [%d] on current link", error);
+
+	current_link_errors++;
+}
+
+void net_nfc_service_llcp_link_deactivated(void)
+{
+	net_nfc_llcp_config_info_s config = base_config;
+
+	if (current_class == NULL)
+		return;
+
+	/* additive increase of window on clean link, multiplicative decrease and longer timeout on bad link */
+	if (current_link_errors > 0)
+	{
+		current_class->error_link_count++;
+		current_class->rw = MAX(1, current_class->rw / 2);
+		current_class->lto = MIN(NET_NFC_LLCP_LINK_MAX_LTO, current_class->lto + NET_NFC_LLCP_LINK_LTO_STEP);
+	}
+	else
+	{
+		current_class->rw = MIN(NET_NFC_LLCP_LINK_MAX_RW, current_class->rw + 1);
+		current_class->lto = MAX(base_config.lto, current_class->lto - MIN(current_class->lto, NET_NFC_LLCP_LINK_LTO_STEP));
+	}
+
+	DEBUG_SERVER_MSG("link is closed with [%d] errors, next rw [%d], lto [%d]", current_link_errors, current_class->rw, current_class->lto);
+
+	/* the same peer is likely to be tapped again, prepare the link for it */
+	config.miu = current_class->miu;
+	config.lto = current_class->lto;
+
+	_net_nfc_service_llcp_link_apply_config(&config);
+
+	current_class = NULL;
+	current_link_errors = 0;
+}
+
+uint8_t net_nfc_service_llcp_link_get_socket_rw(void)
+{
+	if (current_class == NULL)
+		return 1;
+
+	return current_class->rw;
+}
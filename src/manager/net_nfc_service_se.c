@@ -25,6 +25,7 @@
 #include "net_nfc_server_dispatcher_private.h"
 #include "net_nfc_manager_util_private.h"
 #include "net_nfc_service_se_private.h"
+#include "net_nfc_util_access_control_private.h"
 
 #include <pthread.h>
 #include <glib.h>
@@ -35,7 +36,17 @@
 
 /* define */
 /* For ESE*/
+#define NET_NFC_ESE_CHANNEL_MAX 20
+
+typedef struct _net_nfc_ese_channel_t
+{
+	bool opened;
+	int client_fd;
+}
+net_nfc_ese_channel_t;
+
 se_setting_t g_se_setting;
+static net_nfc_ese_channel_t g_ese_channels[NET_NFC_ESE_CHANNEL_MAX];
 
 /* For UICC */
 struct tapi_handle *uicc_handle = NULL;
@@ -43,13 +54,16 @@ struct tapi_handle *uicc_handle = NULL;
 static bool net_nfc_service_check_sim_state(void);
 
 static void _uicc_transmit_apdu_cb(TapiHandle *handle, int result, void *data, void *user_data);
+static void _uicc_script_apdu_cb(TapiHandle *handle, int result, void *data, void *user_data);
 static void _uicc_get_atr_cb(TapiHandle *handle, int result, void *data, void *user_data);
 static void _uicc_status_noti_cb(TapiHandle *handle, const char *noti_id, void *data, void *user_data);
+static void _uicc_request_cancel_all(void);
+static void _uicc_atr_clear(void);
 
 void net_nfc_service_se_detected(net_nfc_request_msg_t *msg)
 {
 	net_nfc_request_target_detected_t *detail_msg = NULL;
-	net_nfc_target_handle_s *handle = detail_msg->handle;
+	net_nfc_target_handle_s *handle = NULL;
 	net_nfc_error_e state = NET_NFC_OK;
 	net_nfc_response_open_internal_se_t resp = { 0 };
 
@@ -59,6 +73,15 @@ void net_nfc_service_se_detected(net_nfc_request_msg_t *msg)
 	}
 
 	detail_msg = (net_nfc_request_target_detected_t *)(msg);
+	handle = detail_msg->handle;
+
+	if (g_se_setting.open_requested == false)
+	{
+		/* client which has requested to open is terminated before eSE is detected */
+		DEBUG_SERVER_MSG("open request is canceled, eSE is not connected");
+		return;
+	}
+
 	g_se_setting.current_ese_handle = handle;
 
 	DEBUG_SERVER_MSG("trying to connect to ESE = [0x%x]", handle);
@@ -67,11 +90,19 @@ void net_nfc_service_se_detected(net_nfc_request_msg_t *msg)
 	{
 		DEBUG_SERVER_MSG("connect failed = [%d]", state);
 		resp.result = state;
+
+		g_se_setting.current_ese_handle = NULL;
 	}
+	else
+	{
+		/* basic channel belongs to the client which has requested to open */
+		g_ese_channels[0].opened = true;
+		g_ese_channels[0].client_fd = g_se_setting.open_request_client_fd;
 
 #ifdef BROADCAST_MESSAGE
-	net_nfc_server_set_server_state( NET_NFC_SE_CONNECTED);
+		net_nfc_server_set_server_state( NET_NFC_SE_CONNECTED);
 #endif
+	}
 
 	resp.handle = handle;
 	resp.trans_param = g_se_setting.open_request_trans_param;
@@ -79,25 +110,298 @@ void net_nfc_service_se_detected(net_nfc_request_msg_t *msg)
 
 	DEBUG_SERVER_MSG("trans param = [%d]", resp.trans_param);
 
-	_net_nfc_send_response_msg(NET_NFC_MESSAGE_OPEN_INTERNAL_SE, &resp, sizeof(net_nfc_response_open_internal_se_t), NULL);
+	_net_nfc_send_response_msg_to_client(g_se_setting.open_request_client_fd, NET_NFC_MESSAGE_OPEN_INTERNAL_SE,
+		&resp, sizeof(net_nfc_response_open_internal_se_t), NULL);
 
 	g_se_setting.open_request_trans_param = NULL;
+	g_se_setting.open_request_client_fd = -1;
+	g_se_setting.open_requested = false;
+}
+
+/* eSE logical channels */
+static net_nfc_target_handle_s *_ese_channel_get_handle(int channel)
+{
+	/* basic channel uses the handle of eSE, others are identified by their slot */
+	if (channel == 0)
+		return g_se_setting.current_ese_handle;
+
+	return (net_nfc_target_handle_s *)&g_ese_channels[channel];
+}
+
+/* channel opened by other client is not found, result is set to NET_NFC_INVALID_HANDLE */
+static int _ese_channel_find(net_nfc_target_handle_s *handle, int client_fd, net_nfc_error_e *result)
+{
+	int channel;
+
+	if (handle == NULL || g_se_setting.current_ese_handle == NULL)
+		return -1;
+
+	for (channel = 0; channel < NET_NFC_ESE_CHANNEL_MAX; channel++)
+	{
+		if (g_ese_channels[channel].opened == true && _ese_channel_get_handle(channel) == handle)
+		{
+			if (g_ese_channels[channel].client_fd != client_fd)
+			{
+				DEBUG_SERVER_MSG("eSE channel [%d] is owned by client [%d], not [%d]", channel, g_ese_channels[channel].client_fd, client_fd);
+
+				if (result != NULL)
+					*result = NET_NFC_INVALID_HANDLE;
+
+				return -1;
+			}
+
+			return channel;
+		}
+	}
+
+	return -1;
+}
+
+static int _ese_channel_count(void)
+{
+	int channel;
+	int count = 0;
+
+	for (channel = 0; channel < NET_NFC_ESE_CHANNEL_MAX; channel++)
+	{
+		if (g_ese_channels[channel].opened == true)
+			count++;
+	}
+
+	return count;
+}
+
+/* ISO 7816-4 class byte, channel 0 ~ 3 use first interindustry class and channel 4 ~ 19 use further one */
+static uint8_t _ese_channel_get_cla(uint8_t cla, uint8_t channel)
+{
+	uint8_t chaining;
+	uint8_t secure;
+
+	/* proprietary class is not changed */
+	if ((cla & 0x80) != 0)
+		return cla;
+
+	chaining = cla & 0x10;
+
+	if ((cla & 0x40) != 0)
+		secure = ((cla & 0x20) != 0) ? 0x08 : 0x00;
+	else
+		secure = cla & 0x0C;
+
+	if (channel < 4)
+		return chaining | secure | channel;
+
+	return 0x40 | ((secure != 0) ? 0x20 : 0x00) | chaining | (channel - 4);
+}
+
+/* MANAGE CHANNEL on basic channel, channel is returned when opening */
+static bool _ese_manage_channel(uint8_t p1, uint8_t p2, uint8_t *channel, net_nfc_error_e *result)
+{
+	uint8_t command[] = { 0x00, 0x70, p1, p2, 0x01 };
+	net_nfc_transceive_info_s info;
+	data_s *data = NULL;
+
+	info.dev_type = NET_NFC_ISO14443_A_PICC;
+	info.trans_data.buffer = command;
+	info.trans_data.length = (channel != NULL) ? sizeof(command) : sizeof(command) - 1;
+
+	if (net_nfc_controller_transceive(g_se_setting.current_ese_handle, &info, &data, result) == false)
+	{
+		DEBUG_SERVER_MSG("manage channel is failed = [%d]", *result);
+		return false;
+	}
+
+	if (data == NULL || data->buffer == NULL || data->length < 2
+		|| data->buffer[data->length - 2] != 0x90 || data->buffer[data->length - 1] != 0x00)
+	{
+		DEBUG_SERVER_MSG("manage channel is rejected, p1 [0x%02x], p2 [0x%02x]", p1, p2);
+		*result = NET_NFC_OPERATION_FAIL;
+		return false;
+	}
+
+	if (channel != NULL)
+	{
+		if (data->length != 3)
+		{
+			DEBUG_SERVER_MSG("channel number is not received");
+			*result = NET_NFC_OPERATION_FAIL;
+			return false;
+		}
+
+		*channel = data->buffer[0];
+	}
+
+	return true;
+}
+
+static void _ese_channel_close(int channel, net_nfc_error_e *result)
+{
+	DEBUG_SERVER_MSG("close eSE channel [%d], client [%d]", channel, g_ese_channels[channel].client_fd);
+
+	g_ese_channels[channel].opened = false;
+
+	/* basic channel is always available while eSE is connected */
+	if (channel > 0)
+	{
+		_ese_manage_channel(0x80, channel, NULL, result);
+	}
+
+	if (_ese_channel_count() == 0)
+	{
+		DEBUG_SERVER_MSG("last eSE channel is closed, disconnect eSE");
+
+		if (net_nfc_controller_disconnect(g_se_setting.current_ese_handle, result) == false)
+		{
+			net_nfc_controller_exception_handler();
+		}
+
+#ifdef BROADCAST_MESSAGE
+		net_nfc_server_unset_server_state(NET_NFC_SE_CONNECTED);
+#endif
+		g_se_setting.current_ese_handle = NULL;
+	}
+}
+
+bool net_nfc_service_se_open_ese_channel(int client_fd, void *trans_param)
+{
+	net_nfc_response_open_internal_se_t resp = { 0 };
+	uint8_t channel = 0;
+
+	if (g_se_setting.open_requested == true)
+	{
+		DEBUG_SERVER_MSG("eSE is being connected");
+		resp.result = NET_NFC_BUSY;
+	}
+	else if (g_se_setting.current_ese_handle == NULL)
+	{
+		/* response is sent when eSE is detected in wired mode */
+		g_se_setting.open_requested = true;
+		g_se_setting.open_request_client_fd = client_fd;
+		g_se_setting.open_request_trans_param = trans_param;
+
+		return false;
+	}
+	else if (g_ese_channels[0].opened == false)
+	{
+		g_ese_channels[0].opened = true;
+		g_ese_channels[0].client_fd = client_fd;
+
+		resp.result = NET_NFC_OK;
+		resp.handle = _ese_channel_get_handle(0);
+	}
+	else if (_ese_manage_channel(0x00, 0x00, &channel, &resp.result) == true)
+	{
+		if (channel == 0 || channel >= NET_NFC_ESE_CHANNEL_MAX || g_ese_channels[channel].opened == true)
+		{
+			DEBUG_ERR_MSG("invalid channel is assigned = [%d]", channel);
+			resp.result = NET_NFC_OPERATION_FAIL;
+		}
+		else
+		{
+			g_ese_channels[channel].opened = true;
+			g_ese_channels[channel].client_fd = client_fd;
+
+			resp.result = NET_NFC_OK;
+			resp.handle = _ese_channel_get_handle(channel);
+		}
+	}
+
+	DEBUG_SERVER_MSG("open eSE channel, result [%d], channel [%d], client [%d]", resp.result, channel, client_fd);
+
+	resp.trans_param = trans_param;
+	resp.se_type = SECURE_ELEMENT_TYPE_ESE;
+
+	_net_nfc_send_response_msg_to_client(client_fd, NET_NFC_MESSAGE_OPEN_INTERNAL_SE, &resp, sizeof(net_nfc_response_open_internal_se_t), NULL);
+
+	return true;
+}
+
+bool net_nfc_service_se_close_ese_channel(net_nfc_target_handle_s *handle, int client_fd, net_nfc_error_e *result)
+{
+	int channel = _ese_channel_find(handle, client_fd, result);
+
+	if (channel < 0)
+		return false;
+
+	_ese_channel_close(channel, result);
+
+	return true;
+}
+
+void net_nfc_service_se_close_ese_channels(int client_fd)
+{
+	net_nfc_error_e result = NET_NFC_OK;
+	int channel;
+
+	if (g_se_setting.open_requested == true && g_se_setting.open_request_client_fd == client_fd)
+	{
+		DEBUG_SERVER_MSG("cancel open request of client [%d]", client_fd);
+
+		g_se_setting.open_requested = false;
+		g_se_setting.open_request_trans_param = NULL;
+		g_se_setting.open_request_client_fd = -1;
+	}
+
+	for (channel = 0; channel < NET_NFC_ESE_CHANNEL_MAX && g_se_setting.current_ese_handle != NULL; channel++)
+	{
+		if (g_ese_channels[channel].opened == true && g_ese_channels[channel].client_fd == client_fd)
+		{
+			_ese_channel_close(channel, &result);
+		}
+	}
+}
+
+bool net_nfc_service_se_is_ese_opened(void)
+{
+	return (g_se_setting.open_requested == true || _ese_channel_count() > 0);
+}
+
+net_nfc_target_handle_s *net_nfc_service_se_get_ese_channel_handle(net_nfc_target_handle_s *handle, int client_fd, data_s *apdu, net_nfc_error_e *result)
+{
+	int channel = _ese_channel_find(handle, client_fd, result);
+
+	if (channel < 0)
+		return NULL;
+
+	if (apdu != NULL && apdu->buffer != NULL && apdu->length > 0)
+	{
+		apdu->buffer[0] = _ese_channel_get_cla(apdu->buffer[0], channel);
+	}
+
+	return g_se_setting.current_ese_handle;
 }
 
 bool net_nfc_service_tapi_init(void)
 {
 	char **cpList = NULL;
 
+	/* connection is kept for next sessions */
+	if (uicc_handle != NULL)
+	{
+		DEBUG_SERVER_MSG("tapi is already initialized");
+
+		return net_nfc_service_check_sim_state();
+	}
+
 	DEBUG_SERVER_MSG("tapi init");
 
 	cpList = tel_get_cp_name_list();
+	if (cpList == NULL || cpList[0] == NULL)
+	{
+		DEBUG_SERVER_MSG("cp name is not found");
+		return false;
+	}
 
 	uicc_handle = tel_init(cpList[0]);
-	if (uicc_handle == NULL)
+	if (uicc_handle != NULL)
 	{
 		int error;
 
 		error = tel_register_noti_event(uicc_handle, TAPI_NOTI_SIM_STATUS, _uicc_status_noti_cb, NULL);
+		if (error != 0)
+		{
+			DEBUG_SERVER_MSG("tel_register_noti_event() failed = [%d]", error);
+		}
 	}
 	else
 	{
@@ -114,56 +418,557 @@ void net_nfc_service_tapi_deinit(void)
 {
 	DEBUG_SERVER_MSG("deinit tapi");
 
+	if (uicc_handle == NULL)
+		return;
+
 	tel_deregister_noti_event(uicc_handle, TAPI_NOTI_SIM_STATUS);
 
 	tel_deinit(uicc_handle);
+	uicc_handle = NULL;
+
+	/* responses of pending requests will not be delivered */
+	_uicc_request_cancel_all();
+	_uicc_atr_clear();
 }
 
-bool net_nfc_service_transfer_apdu(data_s *apdu, void *trans_param)
+/* apdu script */
+typedef struct _net_nfc_apdu_script_t
 {
-	TelSimApdu_t apdu_data = { 0 };
-	int result;
+	net_nfc_target_handle_s *handle;
+	void *trans_param;
+	int client_fd;
+	uint8_t *commands;
+	uint32_t commands_length;
+	uint32_t offset;
+	uint32_t count;
+	uint32_t executed;
+	uint16_t expected_sw;
+	uint16_t sw_mask;
+	uint8_t *responses;
+	uint32_t responses_length;
+	uint32_t responses_size;
+}
+net_nfc_apdu_script_t;
 
-	DEBUG_SERVER_MSG("tranfer apdu");
+static bool _apdu_script_get_next(net_nfc_apdu_script_t *script, data_s *apdu)
+{
+	if (script->executed >= script->count)
+		return false;
+
+	return net_nfc_util_get_apdu_script_command(script->commands, script->commands_length, &script->offset, &script->expected_sw, &script->sw_mask, apdu);
+}
+
+/* stores response and checks status word, returns false if the script should be aborted */
+static bool _apdu_script_add_response(net_nfc_apdu_script_t *script, uint8_t *buffer, uint32_t length)
+{
+	uint16_t sw;
+
+	if (script->responses_length + NET_NFC_APDU_SCRIPT_RESPONSE_LENGTH(length) > script->responses_size)
+	{
+		uint8_t *temp = NULL;
+		uint32_t size = MAX(script->responses_size * 2, script->responses_length + NET_NFC_APDU_SCRIPT_RESPONSE_LENGTH(length));
+
+		_net_nfc_manager_util_alloc_mem(temp, size);
+		if (temp == NULL)
+		{
+			DEBUG_ERR_MSG("alloc failed [%d]", size);
+			return false;
+		}
+
+		if (script->responses != NULL)
+		{
+			memcpy(temp, script->responses, script->responses_length);
+			_net_nfc_manager_util_free_mem(script->responses);
+		}
+
+		script->responses = temp;
+		script->responses_size = size;
+	}
+
+	net_nfc_util_append_llcp_batch_datagram(script->responses, script->responses_size, &script->responses_length, buffer, length);
+	script->executed++;
 
-	if (apdu == NULL)
+	if (script->sw_mask == 0)
+		return true;
+
+	if (buffer == NULL || length < 2)
+	{
+		DEBUG_SERVER_MSG("apdu script is aborted, no status word [%d]", script->executed);
+		return false;
+	}
+
+	sw = (buffer[length - 2] << 8) | buffer[length - 1];
+	if ((sw & script->sw_mask) != (script->expected_sw & script->sw_mask))
+	{
+		DEBUG_SERVER_MSG("apdu script is aborted, sw [0x%04x], expected [0x%04x/0x%04x], command [%d]", sw, script->expected_sw, script->sw_mask, script->executed);
 		return false;
+	}
+
+	return true;
+}
+
+static void _apdu_script_finish(net_nfc_apdu_script_t *script, net_nfc_error_e result)
+{
+	net_nfc_response_send_apdu_script_t resp = { 0, };
 
-	apdu_data.apdu = apdu->buffer;
-	apdu_data.apdu_len = apdu->length;
+	DEBUG_SERVER_MSG("apdu script is finished, result [%d], executed [%d/%d]", result, script->executed, script->count);
 
-	result = tel_req_sim_apdu(uicc_handle, &apdu_data, _uicc_transmit_apdu_cb, trans_param);
-	if (result == 0)
+	resp.result = result;
+	resp.count = script->executed;
+	resp.trans_param = script->trans_param;
+	resp.data.length = script->responses_length;
+
+	if (script->responses_length > 0)
 	{
-		DEBUG_SERVER_MSG("sim apdu request is success");
+		_net_nfc_send_response_msg_to_client(script->client_fd, NET_NFC_MESSAGE_SEND_APDU_SCRIPT_SE, (void *)&resp, sizeof(net_nfc_response_send_apdu_script_t),
+			script->responses, script->responses_length, NULL);
 	}
 	else
 	{
-		DEBUG_SERVER_MSG("request sim apdu is failed with error = [%d]", result);
+		_net_nfc_send_response_msg_to_client(script->client_fd, NET_NFC_MESSAGE_SEND_APDU_SCRIPT_SE, (void *)&resp, sizeof(net_nfc_response_send_apdu_script_t), NULL);
+	}
+
+	_net_nfc_manager_util_free_mem(script->responses);
+	_net_nfc_manager_util_free_mem(script->commands);
+	_net_nfc_manager_util_free_mem(script);
+}
+
+/* UICC transport, requests are queued and sent one by one through uicc_handle */
+typedef enum
+{
+	UICC_REQUEST_APDU,
+	UICC_REQUEST_SCRIPT,
+	UICC_REQUEST_ATR,
+}
+uicc_request_type_e;
+
+typedef struct _uicc_request_t
+{
+	uicc_request_type_e type;
+	data_s apdu;
+	void *user_data; /* trans_param, or script */
+}
+uicc_request_t;
+
+/* tapi callbacks are called in main loop, requests are pushed by dispatcher */
+static pthread_mutex_t uicc_lock = PTHREAD_MUTEX_INITIALIZER;
+static GQueue *uicc_queue = NULL;
+static uicc_request_t *uicc_current = NULL; /* waiting for tapi response */
+static data_s uicc_atr = { NULL, 0 };
+
+static void _apdu_script_transfer_uicc(net_nfc_apdu_script_t *script);
+
+static void _uicc_send_apdu_response(net_nfc_error_e result, uint8_t *buffer, uint32_t length, void *trans_param)
+{
+	net_nfc_response_send_apdu_t resp = { 0 };
+
+	resp.result = result;
+	resp.trans_param = trans_param;
+
+	DEBUG_MSG("send response send apdu msg");
+
+	if (buffer != NULL && length > 0)
+	{
+		resp.data.length = length;
+
+		_net_nfc_send_response_msg(NET_NFC_MESSAGE_SEND_APDU_SE, (void *)&resp, sizeof(net_nfc_response_send_apdu_t), buffer, length, NULL);
+	}
+	else
+	{
+		_net_nfc_send_response_msg(NET_NFC_MESSAGE_SEND_APDU_SE, (void *)&resp, sizeof(net_nfc_response_send_apdu_t), NULL);
+	}
+}
+
+static void _uicc_send_atr_response(net_nfc_error_e result, uint8_t *buffer, uint32_t length, void *trans_param)
+{
+	net_nfc_response_get_atr_t resp = { 0 };
+
+	resp.result = result;
+	resp.trans_param = trans_param;
+
+	DEBUG_MSG("send response get atr msg");
+
+	if (buffer != NULL && length > 0)
+	{
+		resp.data.length = length;
+
+		_net_nfc_send_response_msg(NET_NFC_MESSAGE_GET_ATR_SE, (void *)&resp, sizeof(net_nfc_response_get_atr_t), buffer, length, NULL);
+	}
+	else
+	{
+		_net_nfc_send_response_msg(NET_NFC_MESSAGE_GET_ATR_SE, (void *)&resp, sizeof(net_nfc_response_get_atr_t), NULL);
+	}
+}
+
+static void _uicc_atr_clear(void)
+{
+	pthread_mutex_lock(&uicc_lock);
+
+	net_nfc_util_free_data(&uicc_atr);
+
+	pthread_mutex_unlock(&uicc_lock);
+}
+
+static void _uicc_request_free(uicc_request_t *request)
+{
+	if (request == NULL)
+		return;
+
+	net_nfc_util_free_data(&request->apdu);
+	_net_nfc_manager_util_free_mem(request);
+}
+
+/* answers request which will not be sent */
+static void _uicc_request_fail(uicc_request_t *request)
+{
+	switch (request->type)
+	{
+	case UICC_REQUEST_APDU :
+		_uicc_send_apdu_response(NET_NFC_OPERATION_FAIL, NULL, 0, request->user_data);
+		break;
+
+	case UICC_REQUEST_SCRIPT :
+		_apdu_script_finish((net_nfc_apdu_script_t *)request->user_data, NET_NFC_OPERATION_FAIL);
+		break;
+
+	case UICC_REQUEST_ATR :
+		_uicc_send_atr_response(NET_NFC_OPERATION_FAIL, NULL, 0, request->user_data);
+		break;
+	}
+
+	_uicc_request_free(request);
+}
+
+static bool _uicc_request_send(uicc_request_t *request)
+{
+	int result = 0;
+
+	if (uicc_handle == NULL)
+	{
+		DEBUG_SERVER_MSG("tapi is not initialized");
+		return false;
+	}
+
+	switch (request->type)
+	{
+	case UICC_REQUEST_APDU :
+		{
+			TelSimApdu_t apdu_data = { 0 };
+
+			apdu_data.apdu = request->apdu.buffer;
+			apdu_data.apdu_len = request->apdu.length;
+
+			result = tel_req_sim_apdu(uicc_handle, &apdu_data, _uicc_transmit_apdu_cb, request);
+		}
+		break;
+
+	case UICC_REQUEST_SCRIPT :
+		/* script keeps the transport until its last command is answered */
+		_apdu_script_transfer_uicc((net_nfc_apdu_script_t *)request->user_data);
+		break;
+
+	case UICC_REQUEST_ATR :
+		result = tel_req_sim_atr(uicc_handle, _uicc_get_atr_cb, request);
+		break;
+	}
+
+	if (result != 0)
+	{
+		DEBUG_SERVER_MSG("tapi request is failed, type [%d], error [%d]", request->type, result);
 		return false;
 	}
 
 	return true;
 }
 
-bool net_nfc_service_request_atr(void *trans_param)
+static void _uicc_request_next(void)
 {
-	int result;
+	uicc_request_t *request = NULL;
+
+	while (true)
+	{
+		pthread_mutex_lock(&uicc_lock);
+
+		if (uicc_current != NULL || uicc_queue == NULL || (request = g_queue_pop_head(uicc_queue)) == NULL)
+		{
+			pthread_mutex_unlock(&uicc_lock);
+			return;
+		}
+
+		uicc_current = request;
+
+		pthread_mutex_unlock(&uicc_lock);
+
+		if (_uicc_request_send(request) == true)
+			return;
+
+		pthread_mutex_lock(&uicc_lock);
+
+		uicc_current = NULL;
+
+		pthread_mutex_unlock(&uicc_lock);
+
+		_uicc_request_fail(request);
+	}
+}
+
+/* called after the response of current request is delivered */
+static void _uicc_request_complete(void)
+{
+	uicc_request_t *request;
+
+	pthread_mutex_lock(&uicc_lock);
+
+	request = uicc_current;
+	uicc_current = NULL;
+
+	pthread_mutex_unlock(&uicc_lock);
 
-	result = tel_req_sim_atr(uicc_handle, _uicc_get_atr_cb, trans_param);
-	if(result == 0)
+	_uicc_request_free(request);
+	_uicc_request_next();
+}
+
+static void _uicc_request_push(uicc_request_type_e type, data_s *apdu, void *user_data)
+{
+	uicc_request_t *request = NULL;
+
+	_net_nfc_manager_util_alloc_mem(request, sizeof(uicc_request_t));
+	if (request == NULL)
 	{
-		DEBUG_SERVER_MSG("request is success");
+		DEBUG_ERR_MSG("alloc failed");
+		return;
 	}
-	else
+
+	request->type = type;
+	request->user_data = user_data;
+
+	if (apdu != NULL)
+	{
+		if (net_nfc_util_alloc_data(&request->apdu, apdu->length) == false)
+		{
+			DEBUG_ERR_MSG("alloc failed");
+			_uicc_request_fail(request);
+			return;
+		}
+
+		memcpy(request->apdu.buffer, apdu->buffer, apdu->length);
+	}
+
+	pthread_mutex_lock(&uicc_lock);
+
+	if (uicc_queue == NULL)
+		uicc_queue = g_queue_new();
+
+	g_queue_push_tail(uicc_queue, request);
+
+	DEBUG_SERVER_MSG("uicc request [%d] is queued, pending [%d]", type, g_queue_get_length(uicc_queue));
+
+	pthread_mutex_unlock(&uicc_lock);
+
+	_uicc_request_next();
+}
+
+static void _uicc_request_cancel_all(void)
+{
+	uicc_request_t *request;
+
+	pthread_mutex_lock(&uicc_lock);
+
+	request = uicc_current;
+	uicc_current = NULL;
+
+	pthread_mutex_unlock(&uicc_lock);
+
+	if (request != NULL)
+		_uicc_request_fail(request);
+
+	while (true)
 	{
-		DEBUG_SERVER_MSG("failed to request ATR  = [%d]", result);
+		pthread_mutex_lock(&uicc_lock);
+
+		request = (uicc_queue != NULL) ? g_queue_pop_head(uicc_queue) : NULL;
+
+		pthread_mutex_unlock(&uicc_lock);
+
+		if (request == NULL)
+			break;
+
+		_uicc_request_fail(request);
+	}
+}
+
+bool net_nfc_service_transfer_apdu(data_s *apdu, void *trans_param)
+{
+	DEBUG_SERVER_MSG("tranfer apdu");
+
+	if (apdu == NULL || apdu->buffer == NULL || apdu->length == 0)
 		return false;
+
+	_uicc_request_push(UICC_REQUEST_APDU, apdu, trans_param);
+
+	return true;
+}
+
+bool net_nfc_service_request_atr(void *trans_param)
+{
+	data_s atr = { NULL, 0 };
+
+	pthread_mutex_lock(&uicc_lock);
+
+	if (uicc_atr.buffer != NULL && net_nfc_util_alloc_data(&atr, uicc_atr.length) == true)
+	{
+		memcpy(atr.buffer, uicc_atr.buffer, uicc_atr.length);
 	}
 
+	pthread_mutex_unlock(&uicc_lock);
+
+	if (atr.buffer != NULL)
+	{
+		DEBUG_SERVER_MSG("cached atr is used");
+
+		_uicc_send_atr_response(NET_NFC_OK, atr.buffer, atr.length, trans_param);
+		net_nfc_util_free_data(&atr);
+
+		return true;
+	}
+
+	_uicc_request_push(UICC_REQUEST_ATR, NULL, trans_param);
+
 	return true;
 }
 
+static void _apdu_script_finish_uicc(net_nfc_apdu_script_t *script, net_nfc_error_e result)
+{
+	_apdu_script_finish(script, result);
+	_uicc_request_complete();
+}
+
+static void _apdu_script_transfer_ese(net_nfc_apdu_script_t *script)
+{
+	net_nfc_error_e result = NET_NFC_OK;
+	data_s apdu = { NULL, 0 };
+
+	/* every command is sent in this dispatcher pass */
+	while (_apdu_script_get_next(script, &apdu) == true)
+	{
+		net_nfc_transceive_info_s info;
+		net_nfc_target_handle_s *handle;
+		data_s *data = NULL;
+		bool passed;
+
+		handle = net_nfc_service_se_get_ese_channel_handle(script->handle, script->client_fd, &apdu, &result);
+		if (handle == NULL)
+		{
+			DEBUG_SERVER_MSG("eSE channel is not available = [%d]", result);
+			break;
+		}
+
+		info.dev_type = NET_NFC_ISO14443_A_PICC;
+		info.trans_data = apdu;
+
+		if (net_nfc_controller_transceive(handle, &info, &data, &result) == false)
+		{
+			DEBUG_SERVER_MSG("trasceive is failed = [%d]", result);
+			break;
+		}
+
+		if (data != NULL)
+			passed = _apdu_script_add_response(script, data->buffer, data->length);
+		else
+			passed = _apdu_script_add_response(script, NULL, 0);
+
+		if (passed == false)
+		{
+			result = NET_NFC_OPERATION_FAIL;
+			break;
+		}
+	}
+
+	_apdu_script_finish(script, result);
+}
+
+static void _apdu_script_transfer_uicc(net_nfc_apdu_script_t *script)
+{
+	TelSimApdu_t apdu_data = { 0 };
+	data_s apdu = { NULL, 0 };
+	int result;
+
+	if (_apdu_script_get_next(script, &apdu) == false)
+	{
+		_apdu_script_finish_uicc(script, NET_NFC_OK);
+		return;
+	}
+
+	apdu_data.apdu = apdu.buffer;
+	apdu_data.apdu_len = apdu.length;
+
+	/* next command is sent from the callback of previous one */
+	result = tel_req_sim_apdu(uicc_handle, &apdu_data, _uicc_script_apdu_cb, script);
+	if (result != 0)
+	{
+		DEBUG_SERVER_MSG("request sim apdu is failed with error = [%d]", result);
+		_apdu_script_finish_uicc(script, NET_NFC_OPERATION_FAIL);
+	}
+}
+
+void net_nfc_service_se_send_apdu_script(net_nfc_request_msg_t *msg)
+{
+	net_nfc_request_send_apdu_script_t *detail = (net_nfc_request_send_apdu_script_t *)msg;
+	net_nfc_apdu_script_t *script = NULL;
+	net_nfc_error_e result = NET_NFC_INVALID_PARAM;
+
+	if (detail->handle != (net_nfc_target_handle_s *)UICC_TARGET_HANDLE
+		&& net_nfc_service_se_get_ese_channel_handle(detail->handle, detail->client_fd, NULL, &result) == NULL)
+	{
+		net_nfc_response_send_apdu_script_t resp = { 0, };
+
+		DEBUG_SERVER_MSG("invalid se handle");
+
+		resp.result = result;
+		resp.trans_param = detail->trans_param;
+
+		_net_nfc_send_response_msg_to_client(detail->client_fd, NET_NFC_MESSAGE_SEND_APDU_SCRIPT_SE, (void *)&resp, sizeof(net_nfc_response_send_apdu_script_t), NULL);
+		return;
+	}
+
+	_net_nfc_manager_util_alloc_mem(script, sizeof(net_nfc_apdu_script_t));
+	if (script != NULL)
+	{
+		_net_nfc_manager_util_alloc_mem(script->commands, detail->data.length);
+	}
+
+	if (script == NULL || script->commands == NULL)
+	{
+		net_nfc_response_send_apdu_script_t resp = { 0, };
+
+		DEBUG_ERR_MSG("alloc failed");
+
+		if (script != NULL)
+			_net_nfc_manager_util_free_mem(script);
+
+		resp.result = NET_NFC_ALLOC_FAIL;
+		resp.trans_param = detail->trans_param;
+
+		_net_nfc_send_response_msg_to_client(detail->client_fd, NET_NFC_MESSAGE_SEND_APDU_SCRIPT_SE, (void *)&resp, sizeof(net_nfc_response_send_apdu_script_t), NULL);
+		return;
+	}
+
+	/* request message is released after dispatching, uicc commands are sent asynchronously */
+	memcpy(script->commands, detail->data.buffer, detail->data.length);
+	script->commands_length = detail->data.length;
+	script->count = MIN(detail->count, NET_NFC_APDU_SCRIPT_MAX_COUNT);
+	script->handle = detail->handle;
+	script->trans_param = detail->trans_param;
+	script->client_fd = detail->client_fd;
+
+	DEBUG_SERVER_MSG("apdu script, handle [%p], count [%d]", script->handle, script->count);
+
+	if (script->handle == (net_nfc_target_handle_s *)UICC_TARGET_HANDLE)
+		_uicc_request_push(UICC_REQUEST_SCRIPT, NULL, script);
+	else
+		_apdu_script_transfer_ese(script);
+}
+
 static bool net_nfc_service_check_sim_state(void)
 {
 	TelSimCardStatus_t state = (TelSimCardStatus_t)0;
@@ -197,55 +1002,97 @@ static bool net_nfc_service_check_sim_state(void)
 void _uicc_transmit_apdu_cb(TapiHandle *handle, int result, void *data, void *user_data)
 {
 	TelSimApduResp_t *apdu = (TelSimApduResp_t *)data;
-	net_nfc_response_send_apdu_t resp = { 0 };
+	uicc_request_t *request = (uicc_request_t *)user_data;
 
 	DEBUG_SERVER_MSG("_uicc_transmit_apdu_cb");
 
-	if (result == 0)
+	if (apdu != NULL && apdu->apdu_resp_len > 0)
 	{
-		resp.result = NET_NFC_OK;
+		_uicc_send_apdu_response((result == 0) ? NET_NFC_OK : NET_NFC_OPERATION_FAIL, apdu->apdu_resp, apdu->apdu_resp_len, request->user_data);
 	}
 	else
 	{
-		resp.result = NET_NFC_OPERATION_FAIL;
+		_uicc_send_apdu_response((result == 0) ? NET_NFC_OK : NET_NFC_OPERATION_FAIL, NULL, 0, request->user_data);
 	}
 
-	if (apdu != NULL && apdu->apdu_resp_len > 0)
-	{
-		resp.data.length = apdu->apdu_resp_len;
+	_uicc_request_complete();
+}
 
-		DEBUG_MSG("send response send apdu msg");
-		_net_nfc_send_response_msg(NET_NFC_MESSAGE_SEND_APDU_SE, (void *)&resp, sizeof(net_nfc_response_send_apdu_t), apdu->apdu_resp, apdu->apdu_resp_len, NULL);
-	}
-	else
+void _uicc_script_apdu_cb(TapiHandle *handle, int result, void *data, void *user_data)
+{
+	TelSimApduResp_t *apdu = (TelSimApduResp_t *)data;
+	net_nfc_apdu_script_t *script = (net_nfc_apdu_script_t *)user_data;
+	bool passed;
+
+	DEBUG_SERVER_MSG("_uicc_script_apdu_cb");
+
+	if (result != 0)
 	{
-		DEBUG_MSG("send response send apdu msg");
-		_net_nfc_send_response_msg(NET_NFC_MESSAGE_SEND_APDU_SE, (void *)&resp, sizeof(net_nfc_response_send_apdu_t), NULL);
+		_apdu_script_finish_uicc(script, NET_NFC_OPERATION_FAIL);
+		return;
 	}
+
+	if (apdu != NULL && apdu->apdu_resp_len > 0)
+		passed = _apdu_script_add_response(script, apdu->apdu_resp, apdu->apdu_resp_len);
+	else
+		passed = _apdu_script_add_response(script, NULL, 0);
+
+	if (passed == true)
+		_apdu_script_transfer_uicc(script);
+	else
+		_apdu_script_finish_uicc(script, NET_NFC_OPERATION_FAIL);
 }
 
 void _uicc_get_atr_cb(TapiHandle *handle, int result, void *data, void *user_data)
 {
-	/* TODO : response message */
+	TelSimAtrResp_t *atr = (TelSimAtrResp_t *)data;
+	uicc_request_t *request = (uicc_request_t *)user_data;
 
 	DEBUG_SERVER_MSG("_uicc_get_atr_cb");
+
+	if (result == 0 && atr != NULL && atr->atr_resp_len > 0)
+	{
+		/* atr is kept until sim status is changed */
+		pthread_mutex_lock(&uicc_lock);
+
+		if (uicc_atr.buffer == NULL && net_nfc_util_alloc_data(&uicc_atr, atr->atr_resp_len) == true)
+		{
+			memcpy(uicc_atr.buffer, atr->atr_resp, atr->atr_resp_len);
+		}
+
+		pthread_mutex_unlock(&uicc_lock);
+
+		_uicc_send_atr_response(NET_NFC_OK, atr->atr_resp, atr->atr_resp_len, request->user_data);
+	}
+	else
+	{
+		DEBUG_SERVER_MSG("failed to get atr = [%d]", result);
+
+		_uicc_send_atr_response(NET_NFC_OPERATION_FAIL, NULL, 0, request->user_data);
+	}
+
+	_uicc_request_complete();
 }
 
 void _uicc_status_noti_cb(TapiHandle *handle, const char *noti_id, void *data, void *user_data)
 {
 	TelSimCardStatus_t *status = (TelSimCardStatus_t *)data;
 
-	/* TODO :  */
 	DEBUG_SERVER_MSG("_uicc_status_noti_cb");
 
+	/* card may be changed */
+	_uicc_atr_clear();
+
 	switch (*status)
 	{
 	case TAPI_SIM_STATUS_SIM_INIT_COMPLETED :
 		DEBUG_SERVER_MSG("TAPI_SIM_STATUS_SIM_INIT_COMPLETED");
+		net_nfc_util_access_control_invalidate_list();
 		break;
 
 	case TAPI_SIM_STATUS_CARD_REMOVED :
 		DEBUG_SERVER_MSG("TAPI_SIM_STATUS_CARD_REMOVED");
+		net_nfc_util_access_control_invalidate_list();
 		break;
 
 	default :
@@ -253,3 +1100,246 @@ void _uicc_status_noti_cb(TapiHandle *handle, const char *noti_id, void *data, v
 		break;
 	}
 }
+
+/* SE transaction events */
+
+/* events of same aid arriving in this window are merged into one */
+#define SE_EVENT_COALESCE_WINDOW	100 /* ms */
+
+typedef struct _se_event_t
+{
+	uint32_t type;
+	data_s aid;
+	data_s param;
+	uint32_t count; /* number of merged events */
+}
+se_event_t;
+
+/* events are pushed by controller callback, and delivered by dispatcher */
+static pthread_mutex_t se_event_lock = PTHREAD_MUTEX_INITIALIZER;
+static GQueue *se_event_queue = NULL;
+static bool se_event_flush_scheduled = false;
+static uint32_t se_event_dropped = 0;
+
+static void _se_event_free(se_event_t *event)
+{
+	if (event == NULL)
+		return;
+
+	net_nfc_util_free_data(&event->aid);
+	net_nfc_util_free_data(&event->param);
+	_net_nfc_manager_util_free_mem(event);
+}
+
+static bool _se_event_copy_data(data_s *dest, net_nfc_data_s *src)
+{
+	if (src->length == 0)
+		return true;
+
+	return net_nfc_util_duplicate_data(dest, src);
+}
+
+static se_event_t *_se_event_find(uint32_t type, net_nfc_data_s *aid)
+{
+	GList *list;
+
+	/* events without aid (field on/off...) are never merged, order of them matters */
+	if (se_event_queue == NULL || aid->length == 0)
+		return NULL;
+
+	for (list = g_queue_peek_tail_link(se_event_queue); list != NULL; list = list->prev)
+	{
+		se_event_t *event = (se_event_t *)list->data;
+
+		/* merging over an event without aid changes the order */
+		if (event->aid.length == 0)
+			break;
+
+		if (event->type == type && event->aid.length == aid->length &&
+			memcmp(event->aid.buffer, aid->buffer, aid->length) == 0)
+		{
+			return event;
+		}
+	}
+
+	return NULL;
+}
+
+static gboolean _se_event_flush_timeout_cb(gpointer user_data)
+{
+	net_nfc_request_msg_t *req_msg = NULL;
+
+	_net_nfc_manager_util_alloc_mem(req_msg, sizeof(net_nfc_request_msg_t));
+	if (req_msg != NULL)
+	{
+		req_msg->length = sizeof(net_nfc_request_msg_t);
+		req_msg->request_type = NET_NFC_MESSAGE_SERVICE_SE_EVENT_FLUSH;
+
+		net_nfc_dispatcher_queue_push(req_msg);
+	}
+	else
+	{
+		DEBUG_ERR_MSG("alloc failed, queued se events are delivered with next event");
+
+		pthread_mutex_lock(&se_event_lock);
+		se_event_flush_scheduled = false;
+		pthread_mutex_unlock(&se_event_lock);
+	}
+
+	return FALSE;
+}
+
+void net_nfc_service_se_push_event(net_nfc_request_se_event_t *se_event)
+{
+	se_event_t *event;
+
+	pthread_mutex_lock(&se_event_lock);
+
+	if ((event = _se_event_find(se_event->request_type, &se_event->aid)) != NULL)
+	{
+		/* keep the latest parameter */
+		net_nfc_util_free_data(&event->param);
+		event->param.length = 0;
+
+		if (_se_event_copy_data(&event->param, &se_event->param) == false)
+		{
+			DEBUG_ERR_MSG("alloc failed, parameter is dropped");
+		}
+
+		event->count++;
+
+		DEBUG_SERVER_MSG("se event [%d] is merged, count [%d]", event->type, event->count);
+	}
+	else if (se_event_queue != NULL && g_queue_get_length(se_event_queue) >= NET_NFC_SE_EVENT_BATCH_MAX_COUNT)
+	{
+		se_event_dropped++;
+
+		DEBUG_ERR_MSG("se event queue is full, event [%d] is dropped, total dropped [%d]", se_event->request_type, se_event_dropped);
+	}
+	else
+	{
+		_net_nfc_manager_util_alloc_mem(event, sizeof(se_event_t));
+		if (event != NULL && _se_event_copy_data(&event->aid, &se_event->aid) == true &&
+			_se_event_copy_data(&event->param, &se_event->param) == true)
+		{
+			event->type = se_event->request_type;
+			event->count = 1;
+
+			if (se_event_queue == NULL)
+				se_event_queue = g_queue_new();
+
+			g_queue_push_tail(se_event_queue, event);
+		}
+		else
+		{
+			DEBUG_ERR_MSG("alloc failed, event [%d] is dropped", se_event->request_type);
+
+			_se_event_free(event);
+			se_event_dropped++;
+		}
+	}
+
+	if (se_event_flush_scheduled == false)
+	{
+		se_event_flush_scheduled = true;
+
+		g_timeout_add(SE_EVENT_COALESCE_WINDOW, _se_event_flush_timeout_cb, NULL);
+	}
+
+	pthread_mutex_unlock(&se_event_lock);
+}
+
+/* flush message is abandoned by dispatcher, queued events need another flush */
+void net_nfc_service_se_reschedule_events(void)
+{
+	pthread_mutex_lock(&se_event_lock);
+
+	if (se_event_queue != NULL && g_queue_get_length(se_event_queue) > 0)
+	{
+		se_event_flush_scheduled = true;
+
+		g_timeout_add(SE_EVENT_COALESCE_WINDOW, _se_event_flush_timeout_cb, NULL);
+	}
+	else
+	{
+		se_event_flush_scheduled = false;
+	}
+
+	pthread_mutex_unlock(&se_event_lock);
+}
+
+void net_nfc_service_se_flush_events(void)
+{
+	GQueue *queue;
+	uint32_t dropped;
+	uint32_t length = 0;
+	GList *list;
+	se_event_t *event;
+	int client_context = 0;
+
+	pthread_mutex_lock(&se_event_lock);
+
+	queue = se_event_queue;
+	se_event_queue = NULL;
+	dropped = se_event_dropped;
+	se_event_dropped = 0;
+	se_event_flush_scheduled = false;
+
+	pthread_mutex_unlock(&se_event_lock);
+
+	if (queue == NULL)
+		return;
+
+	DEBUG_SERVER_MSG("deliver [%d] se events, dropped [%d]", g_queue_get_length(queue), dropped);
+
+	for (list = g_queue_peek_head_link(queue); list != NULL; list = list->next)
+	{
+		event = (se_event_t *)list->data;
+
+		/* one launch for merged events */
+		net_nfc_app_util_launch_se_transaction_app(event->aid.buffer, event->aid.length, event->param.buffer, event->param.length);
+
+		length += NET_NFC_SE_EVENT_BATCH_LENGTH(event->aid.length, event->param.length);
+	}
+
+	if (net_nfc_server_get_current_client_context(&client_context) == true &&
+		net_nfc_server_check_client_is_running(&client_context) == true)
+	{
+		net_nfc_response_se_event_batch_t resp = { 0, };
+
+		if (net_nfc_util_alloc_data(&resp.data, length) == true)
+		{
+			uint32_t offset = 0;
+
+			for (list = g_queue_peek_head_link(queue); list != NULL; list = list->next)
+			{
+				event = (se_event_t *)list->data;
+
+				if (net_nfc_util_append_se_batch_event(resp.data.buffer, resp.data.length, &offset, event->type, &event->aid, &event->param) == true)
+					resp.count++;
+			}
+
+			resp.result = NET_NFC_OK;
+			resp.dropped = dropped;
+
+			if (_net_nfc_send_response_msg(NET_NFC_MESSAGE_SERVICE_SE_EVENT_BATCH, (void *)&resp, sizeof(net_nfc_response_se_event_batch_t),
+				(void *)resp.data.buffer, resp.data.length, NULL) == true)
+			{
+				DEBUG_SERVER_MSG("sending response is ok");
+			}
+
+			net_nfc_util_free_data(&resp.data);
+		}
+		else
+		{
+			DEBUG_ERR_MSG("alloc failed, [%d] se events are not delivered to client", g_queue_get_length(queue));
+		}
+	}
+
+	while ((event = (se_event_t *)g_queue_pop_head(queue)) != NULL)
+	{
+		_se_event_free(event);
+	}
+
+	g_queue_free(queue);
+}
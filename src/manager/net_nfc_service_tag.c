@@ -24,9 +24,12 @@
 #include "net_nfc_server_ipc_private.h"
 #include "net_nfc_server_dispatcher_private.h"
 #include "net_nfc_manager_util_private.h"
+#include "net_nfc_service_tag_private.h"
 
 #include <pthread.h>
 #include <malloc.h>
+#include <string.h>
+#include <glib.h>
 
 /* define */
 
@@ -82,6 +85,8 @@ void net_nfc_service_watch_dog(net_nfc_request_msg_t* req_msg)
 				net_nfc_controller_exception_handler();
 			}
 		}
+		net_nfc_service_tag_jewel_clear_memory();
+
 #ifdef BROADCAST_MESSAGE
 		net_nfc_server_set_server_state( NET_NFC_SERVER_IDLE);
 #endif
@@ -145,6 +150,8 @@ void net_nfc_service_clean_tag_context(net_nfc_request_target_detected_t* stand_
 		}
 	}
 
+	net_nfc_service_tag_jewel_clear_memory();
+
 #ifdef BROADCAST_MESSAGE
 	net_nfc_server_set_server_state(	NET_NFC_SERVER_IDLE);
 #endif
@@ -152,6 +159,632 @@ void net_nfc_service_clean_tag_context(net_nfc_request_target_detected_t* stand_
 }
 
 
+/* MIFARE classic blocks */
+
+#define MIFARE_CMD_AUTH_A	0x60U
+#define MIFARE_CMD_AUTH_B	0x61U
+#define MIFARE_CMD_READ	0x30U
+#define MIFARE_CMD_WRITE_BLOCK	0xA0U
+
+/* sector 0 ~ 31 has 4 blocks, sector 32 ~ 39 has 16 blocks */
+#define MIFARE_SMALL_SECTOR_BLOCKS	128
+
+static uint32_t _mifare_get_block_count(uint32_t dev_type)
+{
+	switch (dev_type)
+	{
+	case NET_NFC_MIFARE_MINI_PICC :
+		return 20;
+
+	case NET_NFC_MIFARE_1K_PICC :
+		return 64;
+
+	case NET_NFC_MIFARE_4K_PICC :
+		return 256;
+
+	default :
+		return 0;
+	}
+}
+
+static uint32_t _mifare_get_sector(uint32_t block)
+{
+	if (block < MIFARE_SMALL_SECTOR_BLOCKS)
+		return block / 4;
+	else
+		return 32 + (block - MIFARE_SMALL_SECTOR_BLOCKS) / 16;
+}
+
+static uint32_t _mifare_get_trailer(uint32_t sector)
+{
+	if (sector < 32)
+		return sector * 4 + 3;
+	else
+		return MIFARE_SMALL_SECTOR_BLOCKS + (sector - 32) * 16 + 15;
+}
+
+/* frame is wrapped like net_nfc_mifare_* and net_nfc_transceive of client do, command | CRC_A | CRC_A */
+static bool _mifare_transceive(net_nfc_request_mifare_blocks_t *request, uint8_t *command, uint32_t length, data_s **response, net_nfc_error_e *result)
+{
+	net_nfc_transceive_info_s info;
+	bool success;
+
+	if (net_nfc_util_alloc_data(&info.trans_data, length + 4) == false)
+	{
+		*result = NET_NFC_ALLOC_FAIL;
+		return false;
+	}
+
+	memcpy(info.trans_data.buffer, command, length);
+	net_nfc_util_compute_CRC(CRC_A, info.trans_data.buffer, length + 2);
+	net_nfc_util_compute_CRC(CRC_A, info.trans_data.buffer, length + 4);
+
+	info.dev_type = request->dev_type;
+
+	success = net_nfc_controller_transceive(request->handle, &info, response, result);
+
+	net_nfc_util_free_data(&info.trans_data);
+
+	return success;
+}
+
+static bool _mifare_authenticate(net_nfc_request_mifare_blocks_t *request, uint32_t sector, net_nfc_error_e *result)
+{
+	uint8_t command[2 + NET_NFC_MIFARE_UID_MAX_LENGTH + NET_NFC_MIFARE_KEY_LENGTH];
+	data_s *response = NULL;
+
+	command[0] = (request->key_type == NET_NFC_MIFARE_KEY_B) ? MIFARE_CMD_AUTH_B : MIFARE_CMD_AUTH_A;
+	command[1] = _mifare_get_trailer(sector);
+	memcpy(command + 2, request->uid, request->uid_length);
+	memcpy(command + 2 + request->uid_length, request->key, NET_NFC_MIFARE_KEY_LENGTH);
+
+	if (_mifare_transceive(request, command, 2 + request->uid_length + NET_NFC_MIFARE_KEY_LENGTH, &response, result) == false)
+	{
+		DEBUG_SERVER_MSG("authentication of sector [%d] is failed = [%d]", sector, *result);
+		return false;
+	}
+
+	return true;
+}
+
+void net_nfc_service_tag_mifare_blocks(net_nfc_request_msg_t *msg)
+{
+	net_nfc_request_mifare_blocks_t *request = (net_nfc_request_mifare_blocks_t *)msg;
+	net_nfc_response_mifare_blocks_t resp = { 0, };
+	bool is_read = (msg->request_type == NET_NFC_MESSAGE_MIFARE_READ_BLOCKS);
+	uint32_t blocks = _mifare_get_block_count(request->dev_type);
+	uint32_t auth_sector = (uint32_t)-1;
+	uint32_t block;
+	uint32_t i;
+
+	resp.result = NET_NFC_OK;
+	resp.trans_param = request->trans_param;
+
+	/* addr + count may wrap around */
+	if (request->count == 0 || request->uid_length > NET_NFC_MIFARE_UID_MAX_LENGTH ||
+		request->count > blocks || request->addr > blocks - request->count)
+	{
+		resp.result = NET_NFC_OUT_OF_BOUND;
+	}
+	else if (is_read == false && (request->data.length != request->count * NET_NFC_MIFARE_BLOCK_LENGTH ||
+		request->length < sizeof(net_nfc_request_mifare_blocks_t) + request->data.length))
+	{
+		resp.result = NET_NFC_INVALID_PARAM;
+	}
+	else if (is_read == true && net_nfc_util_alloc_data(&resp.data, request->count * NET_NFC_MIFARE_BLOCK_LENGTH) == false)
+	{
+		resp.result = NET_NFC_ALLOC_FAIL;
+	}
+
+	/* writing a sector trailer may lock the sector, it is done by single block write only */
+	for (i = 0; is_read == false && resp.result == NET_NFC_OK && i < request->count; i++)
+	{
+		block = request->addr + i;
+
+		if (block == _mifare_get_trailer(_mifare_get_sector(block)))
+		{
+			DEBUG_SERVER_MSG("block [%d] is sector trailer", block);
+			resp.result = NET_NFC_INVALID_PARAM;
+		}
+	}
+
+	for (i = 0; resp.result == NET_NFC_OK && i < request->count; i++)
+	{
+		uint8_t command[2 + NET_NFC_MIFARE_BLOCK_LENGTH];
+		data_s *response = NULL;
+
+		block = request->addr + i;
+
+		/* authentication is kept until another sector is accessed */
+		if (_mifare_get_sector(block) != auth_sector)
+		{
+			if (_mifare_authenticate(request, _mifare_get_sector(block), &resp.result) == false)
+				break;
+
+			auth_sector = _mifare_get_sector(block);
+		}
+
+		command[1] = block;
+
+		if (is_read == true)
+		{
+			command[0] = MIFARE_CMD_READ;
+
+			if (_mifare_transceive(request, command, 2, &response, &resp.result) == false)
+			{
+				DEBUG_SERVER_MSG("read block [%d] is failed = [%d]", block, resp.result);
+				break;
+			}
+
+			if (response == NULL || response->buffer == NULL || response->length < NET_NFC_MIFARE_BLOCK_LENGTH)
+			{
+				DEBUG_SERVER_MSG("read block [%d] returns short data", block);
+				resp.result = NET_NFC_TAG_READ_FAILED;
+				break;
+			}
+
+			memcpy(resp.data.buffer + i * NET_NFC_MIFARE_BLOCK_LENGTH, response->buffer, NET_NFC_MIFARE_BLOCK_LENGTH);
+		}
+		else
+		{
+			command[0] = MIFARE_CMD_WRITE_BLOCK;
+			memcpy(command + 2, request->data.buffer + i * NET_NFC_MIFARE_BLOCK_LENGTH, NET_NFC_MIFARE_BLOCK_LENGTH);
+
+			if (_mifare_transceive(request, command, sizeof(command), &response, &resp.result) == false)
+			{
+				DEBUG_SERVER_MSG("write block [%d] is failed = [%d]", block, resp.result);
+				break;
+			}
+		}
+
+		resp.count++;
+	}
+
+	DEBUG_SERVER_MSG("mifare blocks [%d] from [%d], processed [%d], result [%d]", request->count, request->addr, resp.count, resp.result);
+
+	if (_net_nfc_check_client_handle())
+	{
+		if (is_read == true && resp.count > 0)
+		{
+			resp.data.length = resp.count * NET_NFC_MIFARE_BLOCK_LENGTH;
+
+			_net_nfc_send_response_msg(msg->request_type, (void *)&resp, sizeof(net_nfc_response_mifare_blocks_t),
+				(void *)resp.data.buffer, resp.data.length, NULL);
+		}
+		else
+		{
+			resp.data.length = 0;
+
+			_net_nfc_send_response_msg(msg->request_type, (void *)&resp, sizeof(net_nfc_response_mifare_blocks_t), NULL);
+		}
+	}
+
+	net_nfc_util_free_data(&resp.data);
+}
+
+static bool _transceive_sequence_add_response(net_nfc_response_transceive_sequence_t *resp, uint32_t *size, net_nfc_error_e result, data_s *data)
+{
+	uint8_t *buffer = (data != NULL) ? data->buffer : NULL;
+	uint32_t length = (data != NULL && data->buffer != NULL) ? data->length : 0;
+
+	if (resp->data.length + NET_NFC_TRANSCEIVE_SEQUENCE_RESPONSE_LENGTH(length) > *size)
+	{
+		uint8_t *temp = NULL;
+		uint32_t temp_size = MAX(*size * 2, resp->data.length + NET_NFC_TRANSCEIVE_SEQUENCE_RESPONSE_LENGTH(length));
+
+		_net_nfc_manager_util_alloc_mem(temp, temp_size);
+		if (temp == NULL)
+		{
+			DEBUG_ERR_MSG("alloc failed [%d]", temp_size);
+			return false;
+		}
+
+		if (resp->data.buffer != NULL)
+		{
+			memcpy(temp, resp->data.buffer, resp->data.length);
+			_net_nfc_manager_util_free_mem(resp->data.buffer);
+		}
+
+		resp->data.buffer = temp;
+		*size = temp_size;
+	}
+
+	net_nfc_util_append_transceive_sequence_response(resp->data.buffer, *size, &resp->data.length, result, buffer, length);
+	resp->count++;
+
+	return true;
+}
+
+void net_nfc_service_tag_transceive_sequence(net_nfc_request_msg_t *msg)
+{
+	net_nfc_request_transceive_sequence_t *request = (net_nfc_request_transceive_sequence_t *)msg;
+	net_nfc_response_transceive_sequence_t resp = { 0, };
+	net_nfc_transceive_info_s info;
+	net_nfc_error_e last_error = NET_NFC_OK;
+	uint32_t size = 0;
+	uint32_t offset = 0;
+	uint32_t i;
+
+	resp.result = NET_NFC_OK;
+	resp.trans_param = request->trans_param;
+
+	if (request->count == 0 || request->count > NET_NFC_TRANSCEIVE_SEQUENCE_MAX_COUNT ||
+		request->length < sizeof(net_nfc_request_transceive_sequence_t) + request->data.length)
+	{
+		resp.result = NET_NFC_INVALID_PARAM;
+	}
+
+	info.dev_type = request->dev_type;
+
+	for (i = 0; resp.result == NET_NFC_OK && i < request->count; i++)
+	{
+		net_nfc_error_e result = NET_NFC_OK;
+		data_s prefix = { NULL, 0 };
+		data_s *response = NULL;
+
+		if (net_nfc_util_get_transceive_sequence_command(request->data.buffer, request->data.length, &offset, &prefix, &info.trans_data) == false)
+		{
+			DEBUG_ERR_MSG("command [%d] of sequence is malformed", i);
+			resp.result = NET_NFC_INVALID_PARAM;
+			break;
+		}
+
+		if (net_nfc_controller_transceive(request->handle, &info, &response, &result) == false)
+		{
+			DEBUG_SERVER_MSG("transceive [%d] of sequence is failed = [%d]", i, result);
+
+			if (_transceive_sequence_add_response(&resp, &size, result, NULL) == false)
+			{
+				resp.result = NET_NFC_ALLOC_FAIL;
+				break;
+			}
+
+			if (request->stop_on_error == true)
+			{
+				resp.result = result;
+				break;
+			}
+
+			/* the last error is reported as result of the sequence */
+			last_error = result;
+			continue;
+		}
+
+		net_nfc_service_tag_jewel_update_memory(request->handle, &info);
+
+		if (_transceive_sequence_add_response(&resp, &size, NET_NFC_OK, response) == false)
+		{
+			resp.result = NET_NFC_ALLOC_FAIL;
+			break;
+		}
+
+		if (prefix.length > 0 && (response == NULL || response->buffer == NULL || response->length < prefix.length ||
+			memcmp(response->buffer, prefix.buffer, prefix.length) != 0))
+		{
+			DEBUG_SERVER_MSG("response [%d] of sequence is not matched with prefix", i);
+			resp.result = NET_NFC_OPERATION_FAIL;
+			break;
+		}
+	}
+
+	if (resp.result == NET_NFC_OK)
+		resp.result = last_error;
+
+	DEBUG_SERVER_MSG("transceive sequence [%d], processed [%d], result [%d]", request->count, resp.count, resp.result);
+
+	if (_net_nfc_check_client_handle())
+	{
+		if (resp.count > 0)
+		{
+			_net_nfc_send_response_msg(msg->request_type, (void *)&resp, sizeof(net_nfc_response_transceive_sequence_t),
+				(void *)resp.data.buffer, resp.data.length, NULL);
+		}
+		else
+		{
+			resp.data.length = 0;
+
+			_net_nfc_send_response_msg(msg->request_type, (void *)&resp, sizeof(net_nfc_response_transceive_sequence_t), NULL);
+		}
+	}
+
+	_net_nfc_manager_util_free_mem(resp.data.buffer);
+}
+
+/* Jewel / Topaz memory image */
+
+#define JEWEL_CMD_RALL	0x00U
+#define JEWEL_CMD_READ8	0x02U
+#define JEWEL_CMD_RSEG	0x10U
+#define JEWEL_CMD_WRITE_E	0x53U
+#define JEWEL_CMD_WRITE_NE	0x1AU
+#define JEWEL_CMD_WRITE_E8	0x54U
+#define JEWEL_CMD_WRITE_NE8	0x1BU
+
+#define JEWEL_HR0_STATIC_MEMORY	0x11U
+#define JEWEL_STATIC_MEMORY_LENGTH	120
+#define JEWEL_BLOCK_LENGTH	8
+#define JEWEL_SEGMENT_LENGTH	128
+#define JEWEL_MAX_SEGMENT_COUNT	16
+#define JEWEL_CC_MAGIC	0xE1U
+
+typedef struct _jewel_memory_t
+{
+	net_nfc_target_handle_s *handle;
+	uint8_t uid[NET_NFC_JEWEL_UID_LENGTH];
+	uint8_t hr[2];
+	data_s image;
+} jewel_memory_t;
+
+/* image of the connected tag, it is kept until the tag is detached */
+static jewel_memory_t jewel_memory;
+
+void net_nfc_service_tag_jewel_clear_memory(void)
+{
+	net_nfc_util_free_data(&jewel_memory.image);
+	jewel_memory.image.length = 0;
+	jewel_memory.handle = NULL;
+	memset(jewel_memory.uid, 0, sizeof(jewel_memory.uid));
+}
+
+/* cmd | addr | data (1 or 8 bytes) | UID0 ~ 3 | CRC_B */
+static bool _jewel_transceive(net_nfc_target_handle_s *handle, uint8_t *uid, uint8_t command, uint8_t addr, uint32_t data_length, data_s **response, net_nfc_error_e *result)
+{
+	net_nfc_transceive_info_s info;
+	bool success;
+
+	if (net_nfc_util_alloc_data(&info.trans_data, 2 + data_length + NET_NFC_JEWEL_UID_LENGTH + 2) == false)
+	{
+		*result = NET_NFC_ALLOC_FAIL;
+		return false;
+	}
+
+	memset(info.trans_data.buffer, 0, info.trans_data.length);
+	info.trans_data.buffer[0] = command;
+	info.trans_data.buffer[1] = addr;
+	memcpy(info.trans_data.buffer + 2 + data_length, uid, NET_NFC_JEWEL_UID_LENGTH);
+	net_nfc_util_compute_CRC(CRC_B, info.trans_data.buffer, info.trans_data.length);
+
+	info.dev_type = NET_NFC_JEWEL_PICC;
+
+	success = net_nfc_controller_transceive(handle, &info, response, result);
+
+	net_nfc_util_free_data(&info.trans_data);
+
+	return success;
+}
+
+/* reads 8 bytes block with READ8, response is ADD8 | data */
+static bool _jewel_read_block(net_nfc_target_handle_s *handle, uint8_t *uid, uint32_t block, net_nfc_error_e *result)
+{
+	data_s *response = NULL;
+
+	if (_jewel_transceive(handle, uid, JEWEL_CMD_READ8, block, JEWEL_BLOCK_LENGTH, &response, result) == false)
+		return false;
+
+	if (response == NULL || response->buffer == NULL || response->length < 1 + JEWEL_BLOCK_LENGTH)
+	{
+		*result = NET_NFC_TAG_READ_FAILED;
+		return false;
+	}
+
+	memcpy(jewel_memory.image.buffer + block * JEWEL_BLOCK_LENGTH, response->buffer + 1, JEWEL_BLOCK_LENGTH);
+
+	return true;
+}
+
+/* reads 128 bytes segment with RSEG, response is ADDS | data */
+static bool _jewel_read_segment(net_nfc_target_handle_s *handle, uint8_t *uid, uint32_t segment, net_nfc_error_e *result)
+{
+	data_s *response = NULL;
+	uint32_t i;
+
+	if (_jewel_transceive(handle, uid, JEWEL_CMD_RSEG, segment << 4, JEWEL_BLOCK_LENGTH, &response, result) == true &&
+		response != NULL && response->buffer != NULL && response->length >= 1 + JEWEL_SEGMENT_LENGTH)
+	{
+		memcpy(jewel_memory.image.buffer + segment * JEWEL_SEGMENT_LENGTH, response->buffer + 1, JEWEL_SEGMENT_LENGTH);
+		return true;
+	}
+
+	DEBUG_SERVER_MSG("RSEG [%d] is failed, try READ8", segment);
+
+	*result = NET_NFC_OK;
+
+	for (i = 0; i < JEWEL_SEGMENT_LENGTH / JEWEL_BLOCK_LENGTH; i++)
+	{
+		if (_jewel_read_block(handle, uid, segment * (JEWEL_SEGMENT_LENGTH / JEWEL_BLOCK_LENGTH) + i, result) == false)
+			return false;
+	}
+
+	return true;
+}
+
+static bool _jewel_load_memory(net_nfc_target_handle_s *handle, uint8_t *uid, net_nfc_error_e *result)
+{
+	data_s *response = NULL;
+	uint32_t length = JEWEL_STATIC_MEMORY_LENGTH;
+	uint32_t segments = 0;
+	uint32_t i;
+
+	net_nfc_service_tag_jewel_clear_memory();
+
+	/* RALL returns HR0 | HR1 | blocks 0x0 ~ 0xE */
+	if (_jewel_transceive(handle, uid, JEWEL_CMD_RALL, 0, 1, &response, result) == false)
+		return false;
+
+	if (response == NULL || response->buffer == NULL || response->length < 2 + JEWEL_STATIC_MEMORY_LENGTH)
+	{
+		*result = NET_NFC_TAG_READ_FAILED;
+		return false;
+	}
+
+	/* dynamic memory size comes from TMS of capability container */
+	if (response->buffer[0] != JEWEL_HR0_STATIC_MEMORY && (response->buffer[0] & 0xF0) == 0x10 &&
+		response->buffer[2 + 8] == JEWEL_CC_MAGIC)
+	{
+		segments = ((response->buffer[2 + 10] + 1) * JEWEL_BLOCK_LENGTH + JEWEL_SEGMENT_LENGTH - 1) / JEWEL_SEGMENT_LENGTH;
+		if (segments > JEWEL_MAX_SEGMENT_COUNT)
+			segments = JEWEL_MAX_SEGMENT_COUNT;
+
+		length = segments * JEWEL_SEGMENT_LENGTH;
+	}
+
+	if (net_nfc_util_alloc_data(&jewel_memory.image, length) == false)
+	{
+		*result = NET_NFC_ALLOC_FAIL;
+		return false;
+	}
+
+	jewel_memory.hr[0] = response->buffer[0];
+	jewel_memory.hr[1] = response->buffer[1];
+	memcpy(jewel_memory.image.buffer, response->buffer + 2, JEWEL_STATIC_MEMORY_LENGTH);
+
+	if (segments > 0)
+	{
+		/* block 0xF is not returned by RALL */
+		if (_jewel_read_block(handle, uid, JEWEL_STATIC_MEMORY_LENGTH / JEWEL_BLOCK_LENGTH, result) == false)
+		{
+			net_nfc_service_tag_jewel_clear_memory();
+			return false;
+		}
+
+		for (i = 1; i < segments; i++)
+		{
+			if (_jewel_read_segment(handle, uid, i, result) == false)
+			{
+				net_nfc_service_tag_jewel_clear_memory();
+				return false;
+			}
+		}
+	}
+
+	jewel_memory.handle = handle;
+	memcpy(jewel_memory.uid, uid, sizeof(jewel_memory.uid));
+
+	DEBUG_SERVER_MSG("jewel memory is loaded, HR0 [0x%02x], length [%d]", jewel_memory.hr[0], jewel_memory.image.length);
+
+	return true;
+}
+
+void net_nfc_service_tag_jewel_read_memory(net_nfc_request_msg_t *msg)
+{
+	net_nfc_request_jewel_read_memory_t *request = (net_nfc_request_jewel_read_memory_t *)msg;
+	net_nfc_response_jewel_read_memory_t resp = { 0, };
+	uint32_t length = request->read_length;
+
+	resp.result = NET_NFC_OK;
+	resp.trans_param = request->trans_param;
+
+	/* handle may be reused by the next tag, so uid is compared too */
+	if (jewel_memory.handle != request->handle || jewel_memory.image.buffer == NULL ||
+		memcmp(jewel_memory.uid, request->uid, sizeof(jewel_memory.uid)) != 0)
+	{
+		_jewel_load_memory(request->handle, request->uid, &resp.result);
+	}
+
+	if (resp.result == NET_NFC_OK)
+	{
+		if (request->offset >= jewel_memory.image.length)
+		{
+			resp.result = NET_NFC_OUT_OF_BOUND;
+		}
+		else
+		{
+			if (length == 0)
+				length = jewel_memory.image.length - request->offset;
+
+			if (length > jewel_memory.image.length - request->offset)
+				resp.result = NET_NFC_OUT_OF_BOUND;
+		}
+	}
+
+	DEBUG_SERVER_MSG("jewel read memory [%d] from [%d], result [%d]", length, request->offset, resp.result);
+
+	if (_net_nfc_check_client_handle())
+	{
+		if (resp.result == NET_NFC_OK)
+		{
+			resp.data.length = length;
+
+			_net_nfc_send_response_msg(msg->request_type, (void *)&resp, sizeof(net_nfc_response_jewel_read_memory_t),
+				(void *)(jewel_memory.image.buffer + request->offset), length, NULL);
+		}
+		else
+		{
+			_net_nfc_send_response_msg(msg->request_type, (void *)&resp, sizeof(net_nfc_response_jewel_read_memory_t), NULL);
+		}
+	}
+}
+
+/* keeps the image same with the tag after jewel write commands are sent by transceive */
+void net_nfc_service_tag_jewel_update_memory(net_nfc_target_handle_s *handle, net_nfc_transceive_info_s *info)
+{
+	uint8_t *command = info->trans_data.buffer;
+	uint32_t uid_offset;
+	uint32_t addr;
+	uint32_t i;
+
+	if (jewel_memory.handle != handle || jewel_memory.image.buffer == NULL ||
+		info->dev_type != NET_NFC_JEWEL_PICC || command == NULL || info->trans_data.length < 3)
+		return;
+
+	switch (command[0])
+	{
+	case JEWEL_CMD_WRITE_E :
+	case JEWEL_CMD_WRITE_NE :
+		uid_offset = 3;
+		break;
+
+	case JEWEL_CMD_WRITE_E8 :
+	case JEWEL_CMD_WRITE_NE8 :
+		uid_offset = 2 + JEWEL_BLOCK_LENGTH;
+		break;
+
+	default :
+		return;
+	}
+
+	/* write addressed to other tag means the image is not of the current one */
+	if (info->trans_data.length >= uid_offset + NET_NFC_JEWEL_UID_LENGTH &&
+		memcmp(jewel_memory.uid, command + uid_offset, NET_NFC_JEWEL_UID_LENGTH) != 0)
+	{
+		net_nfc_service_tag_jewel_clear_memory();
+		return;
+	}
+
+	switch (command[0])
+	{
+	case JEWEL_CMD_WRITE_E :
+	case JEWEL_CMD_WRITE_NE :
+		addr = command[1];
+		if (addr < jewel_memory.image.length)
+		{
+			if (command[0] == JEWEL_CMD_WRITE_E)
+				jewel_memory.image.buffer[addr] = command[2];
+			else
+				jewel_memory.image.buffer[addr] |= command[2];
+		}
+		break;
+
+	case JEWEL_CMD_WRITE_E8 :
+	case JEWEL_CMD_WRITE_NE8 :
+		addr = command[1] * JEWEL_BLOCK_LENGTH;
+		if (info->trans_data.length >= 2 + JEWEL_BLOCK_LENGTH && addr + JEWEL_BLOCK_LENGTH <= jewel_memory.image.length)
+		{
+			for (i = 0; i < JEWEL_BLOCK_LENGTH; i++)
+			{
+				if (command[0] == JEWEL_CMD_WRITE_E8)
+					jewel_memory.image.buffer[addr + i] = command[2 + i];
+				else
+					jewel_memory.image.buffer[addr + i] |= command[2 + i];
+			}
+		}
+		break;
+
+	default :
+		break;
+	}
+}
+
 data_s* net_nfc_service_tag_process(net_nfc_target_handle_s* handle, int devType, net_nfc_error_e* result)
 {
 	net_nfc_error_e status = NET_NFC_OK;
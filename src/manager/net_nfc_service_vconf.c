@@ -24,6 +24,8 @@
 #include "net_nfc_util_private.h"
 #include "net_nfc_server_dispatcher_private.h"
 #include "net_nfc_app_util_private.h"
+#include "net_nfc_service_llcp_private.h"
+#include "net_nfc_service_llcp_handover_private.h"
 #include "aul.h"
 
 
@@ -100,12 +102,39 @@ static void net_nfc_service_airplane_mode_cb(keynode_t* key, void* data)
 
 
 
+static void net_nfc_service_bt_state_cb(keynode_t* key, void* data)
+{
+	DEBUG_SERVER_MSG("bluetooth state is changed");
+
+	/* prepare handover carrier record before next tap */
+	net_nfc_service_llcp_handover_refresh_carrier_cache(NET_NFC_CONN_HANDOVER_CARRIER_BT);
+	net_nfc_service_llcp_handover_refresh_bond_cache();
+}
+
+static void net_nfc_service_wifi_state_cb(keynode_t* key, void* data)
+{
+	DEBUG_SERVER_MSG("wifi state is changed");
+
+	net_nfc_service_llcp_handover_refresh_carrier_cache(NET_NFC_CONN_HANDOVER_CARRIER_WIFI_BSS);
+	net_nfc_service_llcp_handover_refresh_carrier_cache(NET_NFC_CONN_HANDOVER_CARRIER_WIFI_IBSS);
+}
+
 void net_nfc_service_vconf_register_notify_listener()
 {
 	vconf_notify_key_changed(VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL, net_nfc_service_airplane_mode_cb, NULL);
+	vconf_notify_key_changed(VCONFKEY_BT_STATUS, net_nfc_service_bt_state_cb, NULL);
+	vconf_notify_key_changed(VCONFKEY_WIFI_STATE, net_nfc_service_wifi_state_cb, NULL);
+
+	/* bluetooth may be enabled already */
+	net_nfc_service_llcp_handover_refresh_carrier_cache(NET_NFC_CONN_HANDOVER_CARRIER_BT);
+	net_nfc_service_llcp_handover_refresh_bond_cache();
 }
 
 void net_nfc_service_vconf_unregister_notify_listener()
 {
 	vconf_ignore_key_changed(VCONFKEY_SETAPPL_FLIGHT_MODE_BOOL, net_nfc_service_airplane_mode_cb);
+	vconf_ignore_key_changed(VCONFKEY_BT_STATUS, net_nfc_service_bt_state_cb);
+	vconf_ignore_key_changed(VCONFKEY_WIFI_STATE, net_nfc_service_wifi_state_cb);
+
+	net_nfc_service_llcp_handover_release_bond_cache();
 }
@@ -19,6 +19,8 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <string.h>
+#include <pthread.h>
+#include <glib.h>
 
 #include "SEService.h"
 #include "Reader.h"
@@ -29,6 +31,17 @@
 
 #include "net_nfc_debug_private.h"
 
+/* acls are read from secure elements again after this interval or refresh event */
+#define ACCESS_CONTROL_UPDATE_INTERVAL	(60 * G_USEC_PER_SEC)
+#define ACCESS_CONTROL_DECISION_MAX	256
+
+typedef struct _access_control_hash_t
+{
+	uint8_t hash[20];
+	uint32_t length;
+}
+access_control_hash_t;
+
 static bool initialized = false;
 static se_service_h se_service = NULL;
 static reader_h readers[10] = { NULL, };
@@ -36,6 +49,60 @@ static session_h sessions[10] = { NULL, };
 static channel_h channels[10] = { NULL, };
 static gp_se_acl_h acls[10] = { NULL, };
 
+/* guards acls and caches, events and app launch come from different threads */
+static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+static gint64 updated_time = 0;
+static GHashTable *hash_cache = NULL; /* package name -> certificate hash */
+static GHashTable *decision_cache = NULL; /* package name and aid -> result */
+
+static void _clear_cache(void)
+{
+	if (hash_cache != NULL)
+		g_hash_table_remove_all(hash_cache);
+
+	if (decision_cache != NULL)
+		g_hash_table_remove_all(decision_cache);
+}
+
+static bool _get_certificate_hash(const char *pkg_name, access_control_hash_t **hash)
+{
+	access_control_hash_t *temp;
+
+	if (hash_cache == NULL)
+		hash_cache = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+
+	if ((temp = g_hash_table_lookup(hash_cache, pkg_name)) == NULL)
+	{
+		temp = g_new0(access_control_hash_t, 1);
+		temp->length = sizeof(temp->hash);
+
+		if (signature_helper_get_certificate_hash(pkg_name, temp->hash, &temp->length) != 0)
+		{
+			g_free(temp);
+			return false;
+		}
+
+		g_hash_table_insert(hash_cache, g_strdup(pkg_name), temp);
+	}
+
+	*hash = temp;
+
+	return true;
+}
+
+static char *_get_decision_key(const char *pkg_name, uint8_t *aid, uint32_t length)
+{
+	GString *key = g_string_new(pkg_name);
+	uint32_t i;
+
+	g_string_append_c(key, ':');
+
+	for (i = 0; i < length; i++)
+		g_string_append_printf(key, "%02X", aid[i]);
+
+	return g_string_free(key, FALSE);
+}
+
 static void _session_open_channel_cb(channel_h channel, int error, void *userData)
 {
 	if (error == 0 && channel != NULL)
@@ -44,10 +111,16 @@ static void _session_open_channel_cb(channel_h channel, int error, void *userDat
 
 		DEBUG_MSG("channel [%p], error [%d], userdata [%d]", channel, error, (int)userData);
 
+		pthread_mutex_lock(&cache_lock);
+
 		channels[i] = channel;
 		acls[i] = gp_se_acl_create_instance(channel);
 
+		/* read all acls again with new one */
+		updated_time = 0;
 		initialized = true;
+
+		pthread_mutex_unlock(&cache_lock);
 	}
 	else
 	{
@@ -110,20 +183,53 @@ void net_nfc_util_access_control_initialize(void)
 	}
 }
 
-void net_nfc_util_access_control_update_list(void)
+bool net_nfc_util_access_control_update_list(void)
 {
+	bool result = false;
 	int i;
 
 	if (net_nfc_util_access_control_is_initialized() == true)
 	{
-		for (i = 0; i < (sizeof(acls) / sizeof(gp_se_acl_h)); i++)
+		gint64 now = g_get_monotonic_time();
+
+		pthread_mutex_lock(&cache_lock);
+
+		if (updated_time == 0 || now - updated_time >= ACCESS_CONTROL_UPDATE_INTERVAL)
 		{
-			if (acls[i] != NULL)
+			for (i = 0; i < (sizeof(acls) / sizeof(gp_se_acl_h)); i++)
 			{
-				gp_se_acl_update_acl(acls[i]);
+				if (acls[i] != NULL)
+				{
+					gp_se_acl_update_acl(acls[i]);
+				}
 			}
+
+			/* decisions and hashes are trusted until next update */
+			_clear_cache();
+			updated_time = now;
+
+			result = true;
 		}
+		else
+		{
+			DEBUG_MSG("acl is up to date");
+		}
+
+		pthread_mutex_unlock(&cache_lock);
 	}
+
+	return result;
+}
+
+void net_nfc_util_access_control_invalidate_list(void)
+{
+	DEBUG_MSG("acl will be updated");
+
+	pthread_mutex_lock(&cache_lock);
+
+	updated_time = 0;
+
+	pthread_mutex_unlock(&cache_lock);
 }
 
 bool net_nfc_util_access_control_is_authorized_package(const char* pkg_name, uint8_t *aid, uint32_t length)
@@ -135,27 +241,50 @@ bool net_nfc_util_access_control_is_authorized_package(const char* pkg_name, uin
 	if (net_nfc_util_access_control_is_initialized() == true)
 	{
 		int i;
-		uint8_t hash[20] = { 0, };
-		uint32_t hash_length = sizeof(hash);
+		access_control_hash_t *hash = NULL;
+		gpointer value = NULL;
+		char *key;
+
+		key = _get_decision_key(pkg_name, aid, length);
 
-		if (signature_helper_get_certificate_hash(pkg_name, hash, &hash_length) == 0)
+		pthread_mutex_lock(&cache_lock);
+
+		if (decision_cache == NULL)
+			decision_cache = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, NULL);
+
+		if (g_hash_table_lookup_extended(decision_cache, key, NULL, &value) == TRUE)
+		{
+			result = GPOINTER_TO_INT(value);
+			DEBUG_MSG("cached result = %s", (result) ? "true" : "false");
+		}
+		else if (_get_certificate_hash(pkg_name, &hash) == true)
 		{
-			DEBUG_MSG("%s hash : { %02X %02X %02X %02X ... }", pkg_name, hash[0], hash[1], hash[2], hash[3]);
+			DEBUG_MSG("%s hash : { %02X %02X %02X %02X ... }", pkg_name, hash->hash[0], hash->hash[1], hash->hash[2], hash->hash[3]);
 			for (i = 0; result == false && i < (sizeof(acls) / sizeof(gp_se_acl_h)); i++)
 			{
 				if (acls[i] != NULL)
 				{
 					DEBUG_MSG("acl[%d] exists : %s", i, reader_get_name(readers[i]));
-					result = gp_se_acl_is_authorized_access(acls[i], aid, length, hash, hash_length);
+					result = gp_se_acl_is_authorized_access(acls[i], aid, length, hash->hash, hash->length);
 					DEBUG_MSG("result = %s", (result) ? "true" : "false");
 				}
 			}
+
+			if (g_hash_table_size(decision_cache) >= ACCESS_CONTROL_DECISION_MAX)
+				g_hash_table_remove_all(decision_cache);
+
+			g_hash_table_insert(decision_cache, key, GINT_TO_POINTER(result));
+			key = NULL;
 		}
 		else
 		{
 			/* hash not found */
 			DEBUG_ERR_MSG("hash doesn't exist : %s", pkg_name);
 		}
+
+		pthread_mutex_unlock(&cache_lock);
+
+		g_free(key);
 	}
 
 	return result;
@@ -165,6 +294,8 @@ void net_nfc_util_access_control_release(void)
 {
 	int i;
 
+	pthread_mutex_lock(&cache_lock);
+
 	for (i = 0; i < (sizeof(acls) / sizeof(gp_se_acl_h)); i++)
 	{
 		if (acls[i] != NULL)
@@ -183,5 +314,20 @@ void net_nfc_util_access_control_release(void)
 		memset(channels, 0, sizeof(channels));
 	}
 
+	if (hash_cache != NULL)
+	{
+		g_hash_table_destroy(hash_cache);
+		hash_cache = NULL;
+	}
+
+	if (decision_cache != NULL)
+	{
+		g_hash_table_destroy(decision_cache);
+		decision_cache = NULL;
+	}
+
+	updated_time = 0;
 	initialized = false;
+
+	pthread_mutex_unlock(&cache_lock);
 }
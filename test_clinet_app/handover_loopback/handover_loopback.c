@@ -0,0 +1,1128 @@
+/*
+  * Copyright 2012  Samsung Electronics Co., Ltd
+  *
+  * Licensed under the Flora License, Version 1.0 (the "License");
+  * you may not use this file except in compliance with the License.
+  * You may obtain a copy of the License at
+
+  *     http://www.tizenopensource.org/license
+  *
+  * Unless required by applicable law or agreed to in writing, software
+  * distributed under the License is distributed on an "AS IS" BASIS,
+  * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+  * See the License for the specific language governing permissions and
+  * limitations under the License.
+  */
+
+/*
+ * stand-in controller plugin for connection handover benchmark.
+ *
+ * it is installed instead of /usr/lib/libnfc-plugin.so, and plays remote llcp peer in nfc-manager process.
+ * "make install" keeps vendor plugin as /usr/lib/libnfc-plugin.so.orig, and "make uninstall" restores it.
+ * p2p target is detected periodically, remote peer connects to handover server of nfc-manager with Hr,
+ * and it answers Hs when nfc-manager connects to handover server of remote peer (client requests handover).
+ *
+ * environment
+ *  NET_NFC_LOOPBACK_ROLE       : selector, requester or both, role of nfc-manager (default : selector)
+ *                                remote peer sends Hr on every link in selector and both mode, both mode makes collision
+ *                                when client requests handover. requester mode waits for the request of client.
+ *  NET_NFC_LOOPBACK_CARRIERS   : bt, wifi or mixed, carriers of remote peer (default : bt)
+ *  NET_NFC_LOOPBACK_ITERATIONS : number of p2p detection (default : 10)
+ *  NET_NFC_LOOPBACK_HOLD       : link time in ms after handover message is exchanged (default : 1000)
+ *  NET_NFC_LOOPBACK_REPORT     : report file (default : /tmp/nfc_handover_loopback.csv)
+ *
+ * report has latency from start of exchange and heap usage delta of nfc-manager for each step.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+#include <sys/time.h>
+
+#include <glib.h>
+
+#include "net_nfc_oem_controller.h"
+#include "net_nfc_typedef_private.h"
+#include "net_nfc_util_private.h"
+#include "net_nfc_util_ndef_message.h"
+#include "net_nfc_util_ndef_record.h"
+#include "net_nfc_util_handover.h"
+
+#define LOOPBACK_HANDOVER_SAN		"urn:nfc:sn:handover"
+#define LOOPBACK_MAX_SOCKET		16
+#define LOOPBACK_MAX_STEP		32
+#define LOOPBACK_BUFFER_SIZE		1024
+#define LOOPBACK_DETECT_INTERVAL	500
+
+typedef enum _loopback_socket_role_e
+{
+	LOOPBACK_SOCKET_NONE = 0,
+	LOOPBACK_SOCKET_OTHER, /* snep, npp or client sockets, never completed */
+	LOOPBACK_SOCKET_HANDOVER_SERVER, /* handover server of nfc-manager */
+	LOOPBACK_SOCKET_REMOTE_REQUESTER, /* accepted socket, remote peer sends Hr */
+	LOOPBACK_SOCKET_REMOTE_SELECTOR, /* nfc-manager connected to remote peer, remote peer answers Hs */
+} loopback_socket_role_e;
+
+typedef enum _loopback_carriers_e
+{
+	LOOPBACK_CARRIERS_BT = 0,
+	LOOPBACK_CARRIERS_WIFI,
+	LOOPBACK_CARRIERS_MIXED,
+} loopback_carriers_e;
+
+typedef struct _loopback_step_s
+{
+	const char *name;
+	long elapsed; /* us */
+	int heap_delta; /* bytes */
+} loopback_step_s;
+
+typedef struct _loopback_exchange_s
+{
+	bool active;
+	loopback_socket_role_e role;
+	struct timeval start;
+	int heap_start;
+	int count;
+	loopback_step_s steps[LOOPBACK_MAX_STEP];
+} loopback_exchange_s;
+
+typedef struct _loopback_socket_s
+{
+	net_nfc_llcp_socket_t id;
+	loopback_socket_role_e role;
+	void *user_param;
+	data_s *pending_recv; /* receive buffer of nfc-manager */
+	void *pending_recv_param;
+	uint8_t rx[LOOPBACK_BUFFER_SIZE]; /* message sent by nfc-manager */
+	uint32_t rx_length;
+	uint8_t tx[LOOPBACK_BUFFER_SIZE]; /* message which remote peer sends */
+	uint32_t tx_length;
+	loopback_exchange_s exchange;
+} loopback_socket_s;
+
+static target_detection_listener_cb detection_listener = NULL;
+static llcp_event_listener_cb llcp_listener = NULL;
+
+static loopback_socket_s sockets[LOOPBACK_MAX_SOCKET];
+static net_nfc_llcp_socket_t last_socket_id = 0;
+static net_nfc_target_handle_s *current_handle = NULL;
+
+static loopback_carriers_e carriers = LOOPBACK_CARRIERS_BT;
+static bool remote_requester_enabled = true;
+static int iterations = 10;
+static int iteration = 0;
+static int hold_time = 1000;
+static FILE *report = NULL;
+static bool detection_scheduled = false;
+static bool deactivation_scheduled = false;
+
+G_LOCK_DEFINE_STATIC(loopback);
+
+static const char *_loopback_role_name(loopback_socket_role_e role)
+{
+	switch (role)
+	{
+	case LOOPBACK_SOCKET_REMOTE_REQUESTER :
+		return "selector";
+
+	case LOOPBACK_SOCKET_REMOTE_SELECTOR :
+		return "requester";
+
+	default :
+		return "unknown";
+	}
+}
+
+static const char *_loopback_carriers_name(void)
+{
+	switch (carriers)
+	{
+	case LOOPBACK_CARRIERS_WIFI :
+		return "wifi";
+
+	case LOOPBACK_CARRIERS_MIXED :
+		return "mixed";
+
+	default :
+		return "bt";
+	}
+}
+
+static int _loopback_heap_usage(void)
+{
+	struct mallinfo info = mallinfo();
+
+	return info.uordblks + info.hblkhd;
+}
+
+static void _loopback_exchange_start(loopback_exchange_s *exchange, loopback_socket_role_e role)
+{
+	memset(exchange, 0x00, sizeof(loopback_exchange_s));
+
+	exchange->active = true;
+	exchange->role = role;
+	exchange->heap_start = _loopback_heap_usage();
+	gettimeofday(&exchange->start, NULL);
+}
+
+static void _loopback_exchange_mark(loopback_exchange_s *exchange, const char *name)
+{
+	struct timeval now;
+	loopback_step_s *step;
+
+	if (exchange->active == false || exchange->count >= LOOPBACK_MAX_STEP)
+		return;
+
+	gettimeofday(&now, NULL);
+
+	step = &exchange->steps[exchange->count++];
+	step->name = name;
+	step->elapsed = (now.tv_sec - exchange->start.tv_sec) * 1000000 + (now.tv_usec - exchange->start.tv_usec);
+	step->heap_delta = _loopback_heap_usage() - exchange->heap_start;
+}
+
+static void _loopback_exchange_finish(loopback_exchange_s *exchange)
+{
+	int i;
+
+	if (exchange->active == false)
+		return;
+
+	_loopback_exchange_mark(exchange, "finished");
+
+	if (report != NULL)
+	{
+		/* iteration, role of nfc-manager, carriers of remote peer, step, elapsed us, heap delta */
+		for (i = 0; i < exchange->count; i++)
+		{
+			fprintf(report, "%d,%s,%s,%s,%ld,%d\n", iteration, _loopback_role_name(exchange->role), _loopback_carriers_name(),
+				exchange->steps[i].name, exchange->steps[i].elapsed, exchange->steps[i].heap_delta);
+		}
+
+		fflush(report);
+	}
+
+	fprintf(stdout, "[handover loopback] iteration [%d], %s, %s : %ld us\n", iteration, _loopback_role_name(exchange->role),
+		_loopback_carriers_name(), exchange->steps[exchange->count - 1].elapsed);
+
+	exchange->active = false;
+}
+
+static loopback_socket_s *_loopback_find_socket(net_nfc_llcp_socket_t id)
+{
+	int i;
+
+	for (i = 0; i < LOOPBACK_MAX_SOCKET; i++)
+	{
+		if (sockets[i].role != LOOPBACK_SOCKET_NONE && sockets[i].id == id)
+			return &sockets[i];
+	}
+
+	return NULL;
+}
+
+static loopback_socket_s *_loopback_new_socket(loopback_socket_role_e role)
+{
+	int i;
+
+	for (i = 0; i < LOOPBACK_MAX_SOCKET; i++)
+	{
+		if (sockets[i].role == LOOPBACK_SOCKET_NONE)
+		{
+			memset(&sockets[i], 0x00, sizeof(loopback_socket_s));
+
+			sockets[i].id = ++last_socket_id;
+			sockets[i].role = role;
+
+			return &sockets[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void _loopback_post_llcp_event(uint32_t request_type, uint32_t length, net_nfc_request_llcp_msg_t *msg, void *user_param)
+{
+	/* message is freed by dispatcher of nfc-manager */
+	msg->length = length;
+	msg->request_type = request_type;
+	msg->result = NET_NFC_OK;
+
+	if (llcp_listener != NULL)
+	{
+		llcp_listener(msg, user_param);
+	}
+	else
+	{
+		free(msg);
+	}
+}
+
+static void _loopback_post_simple_event(uint32_t request_type, void *user_param)
+{
+	net_nfc_request_llcp_msg_t *msg = NULL;
+
+	_net_nfc_util_alloc_mem(msg, sizeof(net_nfc_request_llcp_msg_t));
+	if (msg != NULL)
+	{
+		_loopback_post_llcp_event(request_type, sizeof(net_nfc_request_llcp_msg_t), msg, user_param);
+	}
+}
+
+/* remote peer */
+
+static net_nfc_error_e _loopback_append_bt_carrier(ndef_message_s *message)
+{
+	net_nfc_error_e result;
+	net_nfc_carrier_config_s *config = NULL;
+	ndef_record_s *record = NULL;
+	uint8_t address[6] = { 0x00, 0x12, 0x34, 0x56, 0x78, 0x9a };
+	uint8_t cod[3] = { 0x0c, 0x02, 0x5a };
+
+	if ((result = net_nfc_util_create_carrier_config(&config, NET_NFC_CONN_HANDOVER_CARRIER_BT)) != NET_NFC_OK)
+		return result;
+
+	net_nfc_util_add_carrier_config_property(config, NET_NFC_BT_ATTRIBUTE_ADDRESS, sizeof(address), address);
+	net_nfc_util_add_carrier_config_property(config, NET_NFC_BT_ATTRIBUTE_OOB_COD, sizeof(cod), cod);
+	net_nfc_util_add_carrier_config_property(config, NET_NFC_BT_ATTRIBUTE_NAME, strlen("loopback"), (uint8_t *)"loopback");
+
+	if ((result = net_nfc_util_create_ndef_record_with_carrier_config(&record, config)) == NET_NFC_OK)
+	{
+		if ((result = net_nfc_util_append_carrier_config_record(message, record, NET_NFC_CONN_HANDOVER_CARRIER_ACTIVATE)) != NET_NFC_OK)
+		{
+			net_nfc_util_free_record(record);
+		}
+	}
+
+	net_nfc_util_free_carrier_config(config);
+
+	return result;
+}
+
+static net_nfc_error_e _loopback_append_wifi_carrier(ndef_message_s *message)
+{
+	net_nfc_error_e result;
+	net_nfc_carrier_config_s *config = NULL;
+	net_nfc_carrier_property_s *credential = NULL;
+	ndef_record_s *record = NULL;
+	uint8_t version = 0x10;
+	uint8_t net_index = 0x01;
+	uint8_t auth_type[2] = { 0x00, 0x20 };
+	uint8_t enc_type[2] = { 0x00, 0x08 };
+	uint8_t mac_address[6] = { 0x00, 0x12, 0x34, 0x56, 0x78, 0x9b };
+
+	if ((result = net_nfc_util_create_carrier_config(&config, NET_NFC_CONN_HANDOVER_CARRIER_WIFI_BSS)) != NET_NFC_OK)
+		return result;
+
+	net_nfc_util_add_carrier_config_property(config, NET_NFC_WIFI_ATTRIBUTE_VERSION, sizeof(version), &version);
+
+	if ((result = net_nfc_util_create_carrier_config_group(&credential, NET_NFC_WIFI_ATTRIBUTE_CREDENTIAL)) == NET_NFC_OK)
+	{
+		net_nfc_util_add_carrier_config_group_property(credential, NET_NFC_WIFI_ATTRIBUTE_NET_INDEX, sizeof(net_index), &net_index);
+		net_nfc_util_add_carrier_config_group_property(credential, NET_NFC_WIFI_ATTRIBUTE_SSID, strlen("loopback"), (uint8_t *)"loopback");
+		net_nfc_util_add_carrier_config_group_property(credential, NET_NFC_WIFI_ATTRIBUTE_AUTH_TYPE, sizeof(auth_type), auth_type);
+		net_nfc_util_add_carrier_config_group_property(credential, NET_NFC_WIFI_ATTRIBUTE_ENC_TYPE, sizeof(enc_type), enc_type);
+		net_nfc_util_add_carrier_config_group_property(credential, NET_NFC_WIFI_ATTRIBUTE_NET_KEY, strlen("12345678"), (uint8_t *)"12345678");
+		net_nfc_util_add_carrier_config_group_property(credential, NET_NFC_WIFI_ATTRIBUTE_MAC_ADDR, sizeof(mac_address), mac_address);
+
+		if ((result = net_nfc_util_append_carrier_config_group(config, credential)) != NET_NFC_OK)
+		{
+			net_nfc_util_free_carrier_group(credential);
+		}
+	}
+
+	if (result == NET_NFC_OK)
+	{
+		if ((result = net_nfc_util_create_ndef_record_with_carrier_config(&record, config)) == NET_NFC_OK)
+		{
+			if ((result = net_nfc_util_append_carrier_config_record(message, record, NET_NFC_CONN_HANDOVER_CARRIER_ACTIVATE)) != NET_NFC_OK)
+			{
+				net_nfc_util_free_record(record);
+			}
+		}
+	}
+
+	net_nfc_util_free_carrier_config(config);
+
+	return result;
+}
+
+static net_nfc_error_e _loopback_create_message(bool requester, data_s *rawdata)
+{
+	net_nfc_error_e result;
+	ndef_message_s *message = NULL;
+
+	if (requester == true)
+		result = net_nfc_util_create_handover_request_message(&message);
+	else
+		result = net_nfc_util_create_handover_select_message(&message);
+
+	if (result != NET_NFC_OK)
+		return result;
+
+	if (carriers == LOOPBACK_CARRIERS_BT || carriers == LOOPBACK_CARRIERS_MIXED)
+	{
+		result = _loopback_append_bt_carrier(message);
+	}
+
+	if (result == NET_NFC_OK && (carriers == LOOPBACK_CARRIERS_WIFI || carriers == LOOPBACK_CARRIERS_MIXED))
+	{
+		result = _loopback_append_wifi_carrier(message);
+	}
+
+	if (result == NET_NFC_OK)
+	{
+		if (net_nfc_util_get_ndef_message_length(message) <= rawdata->length)
+		{
+			rawdata->length = net_nfc_util_get_ndef_message_length(message);
+			result = net_nfc_util_convert_ndef_message_to_rawdata(message, rawdata);
+		}
+		else
+		{
+			result = NET_NFC_INSUFFICIENT_STORAGE;
+		}
+	}
+
+	net_nfc_util_free_ndef_message(message);
+
+	return result;
+}
+
+static bool _loopback_check_message(loopback_socket_s *item)
+{
+	ndef_message_s *message = NULL;
+	data_s rawdata = { item->rx, item->rx_length };
+	bool result = false;
+
+	if (net_nfc_util_create_ndef_message(&message) != NET_NFC_OK)
+		return false;
+
+	/* message may be sent in fragments, wait for rest of it if it is not complete */
+	if (net_nfc_util_convert_rawdata_to_ndef_message(&rawdata, message) == NET_NFC_OK)
+	{
+		result = true;
+	}
+
+	net_nfc_util_free_ndef_message(message);
+
+	return result;
+}
+
+static gboolean _loopback_deactivate(gpointer user_data);
+
+static void _loopback_schedule_deactivation(void)
+{
+	if (deactivation_scheduled == false)
+	{
+		deactivation_scheduled = true;
+
+		/* give time for carrier processing of nfc-manager */
+		g_timeout_add(hold_time, _loopback_deactivate, NULL);
+	}
+}
+
+static void _loopback_complete_recv(loopback_socket_s *item)
+{
+	net_nfc_request_receive_socket_t *msg = NULL;
+
+	if (item->pending_recv == NULL || item->tx_length == 0)
+		return;
+
+	_net_nfc_util_alloc_mem(msg, sizeof(net_nfc_request_receive_socket_t));
+	if (msg == NULL)
+		return;
+
+	item->pending_recv->length = MIN(item->pending_recv->length, item->tx_length);
+	memcpy(item->pending_recv->buffer, item->tx, item->pending_recv->length);
+	item->tx_length = 0;
+
+	msg->handle = current_handle;
+	msg->client_socket = item->id;
+	msg->oal_socket = item->id;
+
+	if (item->role == LOOPBACK_SOCKET_REMOTE_REQUESTER)
+	{
+		_loopback_exchange_mark(&item->exchange, "Hr received");
+	}
+	else
+	{
+		_loopback_exchange_mark(&item->exchange, "Hs received");
+		_loopback_exchange_finish(&item->exchange);
+		_loopback_schedule_deactivation();
+	}
+
+	_loopback_post_llcp_event(NET_NFC_MESSAGE_SERVICE_LLCP_RECEIVE, sizeof(net_nfc_request_receive_socket_t), (net_nfc_request_llcp_msg_t *)msg, item->pending_recv_param);
+
+	item->pending_recv = NULL;
+	item->pending_recv_param = NULL;
+}
+
+static gboolean _loopback_deactivate(gpointer user_data)
+{
+	net_nfc_request_llcp_msg_t *msg = NULL;
+	int i;
+
+	G_LOCK(loopback);
+
+	deactivation_scheduled = false;
+
+	for (i = 0; i < LOOPBACK_MAX_SOCKET; i++)
+	{
+		if (sockets[i].role != LOOPBACK_SOCKET_NONE)
+		{
+			_loopback_exchange_finish(&sockets[i].exchange);
+			sockets[i].role = LOOPBACK_SOCKET_NONE;
+		}
+	}
+
+	G_UNLOCK(loopback);
+
+	_net_nfc_util_alloc_mem(msg, sizeof(net_nfc_request_llcp_msg_t));
+	if (msg != NULL)
+	{
+		_loopback_post_llcp_event(NET_NFC_MESSAGE_SERVICE_LLCP_DEACTIVATED, sizeof(net_nfc_request_llcp_msg_t), msg, current_handle);
+	}
+
+	return FALSE;
+}
+
+static gboolean _loopback_detect(gpointer user_data)
+{
+	net_nfc_request_target_detected_t *msg = NULL;
+
+	G_LOCK(loopback);
+
+	detection_scheduled = false;
+
+	if (iteration >= iterations || current_handle != NULL)
+	{
+		G_UNLOCK(loopback);
+		return FALSE;
+	}
+
+	iteration++;
+
+	_net_nfc_util_alloc_mem(current_handle, sizeof(net_nfc_target_handle_s));
+	if (current_handle != NULL)
+	{
+		current_handle->connection_id = iteration;
+		current_handle->connection_type = NET_NFC_P2P_CONNECTION_TARGET;
+	}
+
+	G_UNLOCK(loopback);
+
+	if (current_handle == NULL)
+		return FALSE;
+
+	_net_nfc_util_alloc_mem(msg, sizeof(net_nfc_request_target_detected_t));
+	if (msg != NULL)
+	{
+		msg->length = sizeof(net_nfc_request_target_detected_t);
+		msg->request_type = NET_NFC_MESSAGE_SERVICE_STANDALONE_TARGET_DETECTED;
+		msg->handle = current_handle;
+		msg->devType = NET_NFC_NFCIP1_TARGET;
+
+		if (detection_listener != NULL)
+			detection_listener(msg, NULL);
+		else
+			free(msg);
+	}
+
+	return FALSE;
+}
+
+static void _loopback_schedule_detection(void)
+{
+	if (detection_scheduled == false && iteration < iterations)
+	{
+		detection_scheduled = true;
+		g_timeout_add(LOOPBACK_DETECT_INTERVAL, _loopback_detect, NULL);
+	}
+}
+
+static gboolean _loopback_connect_remote_requester(gpointer user_data)
+{
+	net_nfc_request_accept_socket_t *msg = NULL;
+	loopback_socket_s *server;
+	loopback_socket_s *item;
+	data_s rawdata = { NULL, 0 };
+	void *user_param;
+
+	G_LOCK(loopback);
+
+	server = _loopback_find_socket((net_nfc_llcp_socket_t)GPOINTER_TO_UINT(user_data));
+	if (server == NULL || current_handle == NULL || (item = _loopback_new_socket(LOOPBACK_SOCKET_REMOTE_REQUESTER)) == NULL)
+	{
+		G_UNLOCK(loopback);
+		return FALSE;
+	}
+
+	_loopback_exchange_start(&item->exchange, LOOPBACK_SOCKET_REMOTE_REQUESTER);
+
+	rawdata.buffer = item->tx;
+	rawdata.length = sizeof(item->tx);
+
+	if (_loopback_create_message(true, &rawdata) == NET_NFC_OK)
+	{
+		item->tx_length = rawdata.length;
+	}
+
+	_loopback_exchange_mark(&item->exchange, "Hr created");
+
+	user_param = server->user_param;
+
+	_net_nfc_util_alloc_mem(msg, sizeof(net_nfc_request_accept_socket_t));
+	if (msg != NULL)
+	{
+		msg->handle = current_handle;
+		msg->client_socket = server->id;
+		msg->incomming_socket = item->id;
+	}
+
+	G_UNLOCK(loopback);
+
+	if (msg != NULL)
+	{
+		_loopback_post_llcp_event(NET_NFC_MESSAGE_SERVICE_LLCP_ACCEPT, sizeof(net_nfc_request_accept_socket_t), (net_nfc_request_llcp_msg_t *)msg, user_param);
+	}
+
+	return FALSE;
+}
+
+/* controller interface */
+
+static bool net_nfc_loopback_init(net_nfc_error_e *result)
+{
+	const char *value;
+
+	if ((value = getenv("NET_NFC_LOOPBACK_ROLE")) != NULL)
+	{
+		remote_requester_enabled = (strcmp(value, "requester") != 0);
+	}
+
+	if ((value = getenv("NET_NFC_LOOPBACK_CARRIERS")) != NULL)
+	{
+		if (strcmp(value, "wifi") == 0)
+			carriers = LOOPBACK_CARRIERS_WIFI;
+		else if (strcmp(value, "mixed") == 0)
+			carriers = LOOPBACK_CARRIERS_MIXED;
+		else
+			carriers = LOOPBACK_CARRIERS_BT;
+	}
+
+	if ((value = getenv("NET_NFC_LOOPBACK_ITERATIONS")) != NULL)
+		iterations = atoi(value);
+
+	if ((value = getenv("NET_NFC_LOOPBACK_HOLD")) != NULL)
+		hold_time = atoi(value);
+
+	if ((value = getenv("NET_NFC_LOOPBACK_REPORT")) == NULL)
+		value = "/tmp/nfc_handover_loopback.csv";
+
+	if ((report = fopen(value, "w")) != NULL)
+	{
+		fprintf(report, "iteration,role,carriers,step,elapsed_us,heap_delta\n");
+	}
+
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_deinit(void)
+{
+	if (report != NULL)
+	{
+		fclose(report);
+		report = NULL;
+	}
+
+	return true;
+}
+
+static bool net_nfc_loopback_register_listener(target_detection_listener_cb target_detection_listener, se_transaction_listener_cb se_transaction_listener, llcp_event_listener_cb llcp_event_listener, net_nfc_error_e *result)
+{
+	detection_listener = target_detection_listener;
+	llcp_listener = llcp_event_listener;
+
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_unregister_listener(void)
+{
+	detection_listener = NULL;
+	llcp_listener = NULL;
+
+	return true;
+}
+
+static bool net_nfc_loopback_not_supported(net_nfc_error_e *result)
+{
+	*result = NET_NFC_NOT_SUPPORTED;
+
+	return false;
+}
+
+static bool net_nfc_loopback_get_firmware_version(data_s **data, net_nfc_error_e *result)
+{
+	return net_nfc_loopback_not_supported(result);
+}
+
+static bool net_nfc_loopback_ok(net_nfc_error_e *result)
+{
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_get_stack_information(net_nfc_stack_information_s *stack_info, net_nfc_error_e *result)
+{
+	stack_info->net_nfc_supported_tagetType = 0;
+	stack_info->net_nfc_fw_version = 0;
+
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_configure_discovery(net_nfc_discovery_mode_e mode, net_nfc_event_filter_e config, net_nfc_error_e *result)
+{
+	G_LOCK(loopback);
+
+	if (mode != NET_NFC_DISCOVERY_MODE_STOP)
+	{
+		_loopback_schedule_detection();
+	}
+
+	G_UNLOCK(loopback);
+
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_get_secure_element_list(net_nfc_secure_element_info_s *list, int *count, net_nfc_error_e *result)
+{
+	*count = 0;
+
+	return net_nfc_loopback_not_supported(result);
+}
+
+static bool net_nfc_loopback_set_secure_element_mode(net_nfc_secure_element_type_e element_type, net_nfc_secure_element_mode_e mode, net_nfc_error_e *result)
+{
+	return net_nfc_loopback_not_supported(result);
+}
+
+static bool net_nfc_loopback_check_presence(net_nfc_target_handle_s *handle, net_nfc_error_e *result)
+{
+	if (handle == NULL || handle != current_handle)
+	{
+		*result = NET_NFC_NOT_CONNECTED;
+		return false;
+	}
+
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_connect(net_nfc_target_handle_s *handle, net_nfc_error_e *result)
+{
+	return net_nfc_loopback_check_presence(handle, result);
+}
+
+static bool net_nfc_loopback_disconnect(net_nfc_target_handle_s *handle, net_nfc_error_e *result)
+{
+	G_LOCK(loopback);
+
+	if (handle == NULL || handle != current_handle)
+	{
+		G_UNLOCK(loopback);
+
+		*result = NET_NFC_NOT_CONNECTED;
+		return false;
+	}
+
+	/* handle is freed by controller */
+	_net_nfc_util_free_mem(current_handle);
+
+	_loopback_schedule_detection();
+
+	G_UNLOCK(loopback);
+
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_exception_handler(void)
+{
+	return true;
+}
+
+static bool net_nfc_loopback_config_llcp(net_nfc_llcp_config_info_s *config, net_nfc_error_e *result)
+{
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_check_llcp(net_nfc_target_handle_s *handle, net_nfc_error_e *result)
+{
+	return net_nfc_loopback_check_presence(handle, result);
+}
+
+static bool net_nfc_loopback_activate_llcp(net_nfc_target_handle_s *handle, net_nfc_error_e *result)
+{
+	return net_nfc_loopback_check_presence(handle, result);
+}
+
+static bool net_nfc_loopback_create_socket(net_nfc_llcp_socket_t *socket, net_nfc_socket_type_e socketType, uint16_t miu, uint8_t rw, net_nfc_error_e *result, void *user_param)
+{
+	loopback_socket_s *item;
+
+	G_LOCK(loopback);
+
+	item = _loopback_new_socket(LOOPBACK_SOCKET_OTHER);
+	if (item != NULL)
+	{
+		item->user_param = user_param;
+		*socket = item->id;
+	}
+
+	G_UNLOCK(loopback);
+
+	if (item == NULL)
+	{
+		*result = NET_NFC_INSUFFICIENT_STORAGE;
+		return false;
+	}
+
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_bind(net_nfc_llcp_socket_t socket, uint8_t service_access_point, net_nfc_error_e *result)
+{
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_listen(net_nfc_target_handle_s *handle, uint8_t *service_access_name, net_nfc_llcp_socket_t socket, net_nfc_error_e *result, void *user_param)
+{
+	loopback_socket_s *item;
+
+	G_LOCK(loopback);
+
+	if ((item = _loopback_find_socket(socket)) != NULL)
+	{
+		item->user_param = user_param;
+
+		if (service_access_name != NULL && strcmp((char *)service_access_name, LOOPBACK_HANDOVER_SAN) == 0)
+		{
+			item->role = LOOPBACK_SOCKET_HANDOVER_SERVER;
+
+			if (remote_requester_enabled == true)
+			{
+				/* remote peer sends handover request as soon as the server is ready */
+				g_idle_add(_loopback_connect_remote_requester, GUINT_TO_POINTER(item->id));
+			}
+		}
+	}
+
+	G_UNLOCK(loopback);
+
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_accept(net_nfc_llcp_socket_t socket, net_nfc_error_e *result)
+{
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_connect_by_url(net_nfc_target_handle_s *handle, net_nfc_llcp_socket_t socket, uint8_t *service_access_name, net_nfc_error_e *result, void *user_param)
+{
+	loopback_socket_s *item;
+	net_nfc_request_connect_socket_t *msg = NULL;
+
+	G_LOCK(loopback);
+
+	if ((item = _loopback_find_socket(socket)) == NULL)
+	{
+		G_UNLOCK(loopback);
+
+		*result = NET_NFC_LLCP_INVALID_SOCKET;
+		return false;
+	}
+
+	if (service_access_name != NULL && strcmp((char *)service_access_name, LOOPBACK_HANDOVER_SAN) == 0)
+	{
+		item->role = LOOPBACK_SOCKET_REMOTE_SELECTOR;
+		_loopback_exchange_start(&item->exchange, LOOPBACK_SOCKET_REMOTE_SELECTOR);
+		_loopback_exchange_mark(&item->exchange, "connected");
+
+		_net_nfc_util_alloc_mem(msg, sizeof(net_nfc_request_connect_socket_t));
+		if (msg != NULL)
+		{
+			msg->handle = handle;
+			msg->client_socket = socket;
+			msg->oal_socket = socket;
+		}
+	}
+
+	G_UNLOCK(loopback);
+
+	/* other services of remote peer do not answer */
+	if (msg != NULL)
+	{
+		_loopback_post_llcp_event(NET_NFC_MESSAGE_SERVICE_LLCP_CONNECT, sizeof(net_nfc_request_connect_socket_t), (net_nfc_request_llcp_msg_t *)msg, user_param);
+	}
+
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_connect_sap(net_nfc_target_handle_s *handle, net_nfc_llcp_socket_t socket, uint8_t service_access_point, net_nfc_error_e *result, void *user_param)
+{
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_disconnect_llcp(net_nfc_target_handle_s *handle, net_nfc_llcp_socket_t socket, net_nfc_error_e *result, void *user_param)
+{
+	_loopback_post_simple_event(NET_NFC_MESSAGE_SERVICE_LLCP_DISCONNECT, user_param);
+
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_socket_close(net_nfc_llcp_socket_t socket, net_nfc_error_e *result)
+{
+	loopback_socket_s *item;
+
+	G_LOCK(loopback);
+
+	if ((item = _loopback_find_socket(socket)) != NULL)
+	{
+		_loopback_exchange_finish(&item->exchange);
+		item->role = LOOPBACK_SOCKET_NONE;
+	}
+
+	G_UNLOCK(loopback);
+
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_recv(net_nfc_target_handle_s *handle, net_nfc_llcp_socket_t socket, data_s *data, net_nfc_error_e *result, void *user_param)
+{
+	loopback_socket_s *item;
+
+	G_LOCK(loopback);
+
+	if ((item = _loopback_find_socket(socket)) == NULL)
+	{
+		G_UNLOCK(loopback);
+
+		*result = NET_NFC_LLCP_INVALID_SOCKET;
+		return false;
+	}
+
+	item->pending_recv = data;
+	item->pending_recv_param = user_param;
+
+	if (item->role == LOOPBACK_SOCKET_REMOTE_REQUESTER || item->role == LOOPBACK_SOCKET_REMOTE_SELECTOR)
+	{
+		_loopback_exchange_mark(&item->exchange, "receive requested");
+		_loopback_complete_recv(item);
+	}
+
+	G_UNLOCK(loopback);
+
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_send(net_nfc_target_handle_s *handle, net_nfc_llcp_socket_t socket, data_s *data, net_nfc_error_e *result, void *user_param)
+{
+	loopback_socket_s *item;
+	net_nfc_request_send_socket_t *msg = NULL;
+
+	G_LOCK(loopback);
+
+	if ((item = _loopback_find_socket(socket)) == NULL)
+	{
+		G_UNLOCK(loopback);
+
+		*result = NET_NFC_LLCP_INVALID_SOCKET;
+		return false;
+	}
+
+	if (item->role == LOOPBACK_SOCKET_REMOTE_REQUESTER || item->role == LOOPBACK_SOCKET_REMOTE_SELECTOR)
+	{
+		if (item->rx_length + data->length <= sizeof(item->rx))
+		{
+			memcpy(item->rx + item->rx_length, data->buffer, data->length);
+			item->rx_length += data->length;
+		}
+
+		if (_loopback_check_message(item) == true)
+		{
+			if (item->role == LOOPBACK_SOCKET_REMOTE_SELECTOR)
+			{
+				data_s rawdata = { item->tx, sizeof(item->tx) };
+
+				_loopback_exchange_mark(&item->exchange, "Hr sent");
+
+				if (_loopback_create_message(false, &rawdata) == NET_NFC_OK)
+				{
+					item->tx_length = rawdata.length;
+				}
+
+				_loopback_exchange_mark(&item->exchange, "Hs created");
+			}
+			else
+			{
+				_loopback_exchange_mark(&item->exchange, "Hs sent");
+				_loopback_exchange_finish(&item->exchange);
+				_loopback_schedule_deactivation();
+			}
+
+			item->rx_length = 0;
+		}
+	}
+
+	_net_nfc_util_alloc_mem(msg, sizeof(net_nfc_request_send_socket_t));
+	if (msg != NULL)
+	{
+		msg->handle = handle;
+		msg->client_socket = socket;
+		msg->oal_socket = socket;
+	}
+
+	G_UNLOCK(loopback);
+
+	if (msg != NULL)
+	{
+		_loopback_post_llcp_event(NET_NFC_MESSAGE_SERVICE_LLCP_SEND, sizeof(net_nfc_request_send_socket_t), (net_nfc_request_llcp_msg_t *)msg, user_param);
+	}
+
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_recv_from(net_nfc_target_handle_s *handle, net_nfc_llcp_socket_t socket, data_s *data, net_nfc_error_e *result, void *user_param)
+{
+	/* connectionless services of remote peer do not send */
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_send_to(net_nfc_target_handle_s *handle, net_nfc_llcp_socket_t socket, data_s *data, uint8_t service_access_point, net_nfc_error_e *result, void *user_param)
+{
+	_loopback_post_simple_event(NET_NFC_MESSAGE_SERVICE_LLCP_SEND_TO, user_param);
+
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_reject(net_nfc_target_handle_s *handle, net_nfc_llcp_socket_t socket, net_nfc_error_e *result)
+{
+	return net_nfc_loopback_socket_close(socket, result);
+}
+
+static bool net_nfc_loopback_get_remote_config(net_nfc_target_handle_s *handle, net_nfc_llcp_config_info_s *config, net_nfc_error_e *result)
+{
+	config->miu = 128;
+	config->wks = 0x0013;
+	config->lto = 10;
+	config->option = 0;
+
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_get_remote_socket_info(net_nfc_target_handle_s *handle, net_nfc_llcp_socket_t socket, net_nfc_llcp_socket_option_s *option, net_nfc_error_e *result)
+{
+	option->miu = 128;
+	option->rw = 1;
+	option->type = NET_NFC_LLCP_SOCKET_TYPE_CONNECTIONORIENTED;
+
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+static bool net_nfc_loopback_support_nfc(net_nfc_error_e *result)
+{
+	*result = NET_NFC_OK;
+
+	return true;
+}
+
+__attribute__((visibility("default"))) bool onload(net_nfc_oem_interface_s *interfaces)
+{
+	if (interfaces == NULL)
+		return false;
+
+	memset(interfaces, 0x00, sizeof(net_nfc_oem_interface_s));
+
+	interfaces->init = net_nfc_loopback_init;
+	interfaces->deinit = net_nfc_loopback_deinit;
+	interfaces->register_listener = net_nfc_loopback_register_listener;
+	interfaces->unregister_listener = net_nfc_loopback_unregister_listener;
+	interfaces->get_firmware_version = net_nfc_loopback_get_firmware_version;
+	interfaces->check_firmware_version = net_nfc_loopback_not_supported;
+	interfaces->update_firmeware = net_nfc_loopback_not_supported;
+	interfaces->get_stack_information = net_nfc_loopback_get_stack_information;
+	interfaces->configure_discovery = net_nfc_loopback_configure_discovery;
+	interfaces->get_secure_element_list = net_nfc_loopback_get_secure_element_list;
+	interfaces->set_secure_element_mode = net_nfc_loopback_set_secure_element_mode;
+	interfaces->connect = net_nfc_loopback_connect;
+	interfaces->disconnect = net_nfc_loopback_disconnect;
+	interfaces->check_presence = net_nfc_loopback_check_presence;
+	interfaces->exception_handler = net_nfc_loopback_exception_handler;
+	interfaces->is_ready = net_nfc_loopback_ok;
+
+	interfaces->config_llcp = net_nfc_loopback_config_llcp;
+	interfaces->check_llcp_status = net_nfc_loopback_check_llcp;
+	interfaces->activate_llcp = net_nfc_loopback_activate_llcp;
+	interfaces->create_llcp_socket = net_nfc_loopback_create_socket;
+	interfaces->bind_llcp_socket = net_nfc_loopback_bind;
+	interfaces->listen_llcp_socket = net_nfc_loopback_listen;
+	interfaces->accept_llcp_socket = net_nfc_loopback_accept;
+	interfaces->connect_llcp_by_url = net_nfc_loopback_connect_by_url;
+	interfaces->connect_llcp = net_nfc_loopback_connect_sap;
+	interfaces->disconnect_llcp = net_nfc_loopback_disconnect_llcp;
+	interfaces->close_llcp_socket = net_nfc_loopback_socket_close;
+	interfaces->recv_llcp = net_nfc_loopback_recv;
+	interfaces->send_llcp = net_nfc_loopback_send;
+	interfaces->recv_from_llcp = net_nfc_loopback_recv_from;
+	interfaces->send_to_llcp = net_nfc_loopback_send_to;
+	interfaces->reject_llcp = net_nfc_loopback_reject;
+	interfaces->get_remote_config = net_nfc_loopback_get_remote_config;
+	interfaces->get_remote_socket_info = net_nfc_loopback_get_remote_socket_info;
+
+	interfaces->support_nfc = net_nfc_loopback_support_nfc;
+
+	return true;
+}